@@ -4,7 +4,10 @@
 #include "XRefOffsetMatch.hpp"
 #include "CallerXRefMatch.hpp"
 #include "ExternalMappingMatch.hpp"
+#include "NameMatch.hpp"
+#include "TypeMatch.hpp"
 #include "Helpers.h"
+#include "HVersion.hpp"
 
 #include "VectorSign.hpp"
 
@@ -28,8 +31,27 @@ std::shared_ptr<IDiffAlgo> MakeDiffAlgo(const AlgoCfg& config)
         return MakeVectorSignAlgo(config);
       case ALGO_EXTERNAL_MAPPING_MATCH:
         return MakeExternalMappingMatchAlgo(config);
+    case ALGO_NAME_MATCH:
+        return MakeNameMatchAlgo(config);
+    case ALGO_TYPE_MATCH:
+        return MakeTypeMatchAlgo(config);
     default:
         return nullptr;
     }
 }
+
+bool has_common_signature(const HVersion& version1, const HVersion& version2)
+{
+    bool found = false;
+    version1.walk_signatures([&](const HSignature& sign1)
+    {
+        version2.walk_signatures([&](const HSignature& sign2)
+        {
+            found = sign1 == sign2;
+            return found ? WALK_STOP : WALK_CONTINUE;
+        });
+        return found ? WALK_STOP : WALK_CONTINUE;
+    });
+    return found;
+}
 }
@@ -5,9 +5,11 @@
 namespace std { template<typename T> class shared_ptr; }
 struct IModel;
 struct Relation;
+struct HVersion;
 
 namespace yadiff
 {
+    class MemoryBudget;
 
     enum Algo_e
     {
@@ -16,6 +18,8 @@ namespace yadiff
         ALGO_CALLER_XREF_MATCH,
         ALGO_VECTOR_SIGN,
         ALGO_EXTERNAL_MAPPING_MATCH,
+        ALGO_NAME_MATCH,
+        ALGO_TYPE_MATCH,
     };
 
     enum AlgoFlag_e
@@ -32,7 +36,7 @@ namespace yadiff
 
     struct ExactMatchCfg
     {
-
+        bool CompositeKeys;
     };
 
     struct XRefOffsetMatchCfg
@@ -56,6 +60,16 @@ namespace yadiff
         int         RelationConfidence;
     };
 
+    struct NameMatchCfg
+    {
+
+    };
+
+    struct TypeMatchCfg
+    {
+
+    };
+
     struct AlgoCfg
     {
         Algo_e                  Algo;
@@ -64,8 +78,11 @@ namespace yadiff
         CallerXRefMatchCfg      CallerXRefMatch;
         VectorSignCfg           VectorSign;
         ExternalMappingMatchCfg ExternalMappingMatch;
+        NameMatchCfg            NameMatch;
+        TypeMatchCfg            TypeMatch;
         int                     NbThreads;
         bool                    bMultiThread;
+        MemoryBudget*           Budget;         // optional, big intermediates spill to disk above it
     };
 
     typedef std::function<bool (const Relation&)> OnRelationFn;
@@ -96,4 +113,7 @@ namespace yadiff
     };
 
     std::shared_ptr<IDiffAlgo> MakeDiffAlgo(const AlgoCfg& config);
+
+    // true when both versions share at least one signature
+    bool has_common_signature(const HVersion& version1, const HVersion& version2);
 }
@@ -4,11 +4,16 @@
 #include "Helpers.h"
 #include "Yatools.hpp"
 #include "IModel.hpp"
+#include "HVersion.hpp"
+#include "Signature.hpp"
 #include "VersionRelation.hpp"
 
+#include <algorithm>
 #include <utility>
 #include <memory>
 #include <chrono>
+#include <unordered_map>
+#include <unordered_set>
 
 #if 0
 #define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("exact", (FMT), ## __VA_ARGS__)
@@ -18,6 +23,123 @@
 
 namespace yadiff
 {
+namespace
+{
+    // cheap features read from the model, used to split signature collisions
+    // keys are tried in this order, each level splitting the previous buckets
+    enum CompositeKey_e
+    {
+        KEY_TYPE,
+        KEY_SIZE,
+        KEY_XREFS_FROM,
+        KEY_XREFS_TO,
+        KEY_CALLEES,
+        KEY_PARENT,
+        KEY_COUNT,
+    };
+
+    struct Candidate
+    {
+        HVersion version;
+        uint64_t keys[KEY_COUNT];
+    };
+
+    typedef std::vector<Candidate> Candidates;
+    typedef std::unordered_set<VersionIndex> Matched;
+
+    uint64_t get_signature_hash(const HVersion& version)
+    {
+        uint64_t hash = 0;
+        version.walk_signatures([&](const HSignature& signature)
+        {
+            hash = std::hash<Signature>()(signature.get());
+            return WALK_STOP;
+        });
+        return hash;
+    }
+
+    Candidate make_candidate(const IModel& db, const HVersion& version)
+    {
+        Candidate candidate;
+        candidate.version = version;
+        candidate.keys[KEY_TYPE] = version.type();
+        candidate.keys[KEY_SIZE] = version.size();
+
+        // callees are hashed as a multiset, independently of xref order
+        uint64_t xrefs_from = 0;
+        uint64_t callees = 0;
+        version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+        {
+            ++xrefs_from;
+            const auto type = xref.type();
+            if(type == OBJECT_TYPE_FUNCTION || type == OBJECT_TYPE_CODE)
+                callees += get_signature_hash(xref) * 2 + 1;
+            return WALK_CONTINUE;
+        });
+        candidate.keys[KEY_XREFS_FROM] = xrefs_from;
+        candidate.keys[KEY_CALLEES] = callees;
+
+        uint64_t xrefs_to = 0;
+        version.walk_xrefs_to([&](const HVersion&)
+        {
+            ++xrefs_to;
+            return WALK_CONTINUE;
+        });
+        candidate.keys[KEY_XREFS_TO] = xrefs_to;
+
+        const auto parent_id = version.parent_id();
+        candidate.keys[KEY_PARENT] = db.has(parent_id) ? get_signature_hash(db.get(parent_id)) : 0;
+        return candidate;
+    }
+
+    Candidates get_candidates(const IModel& db, const HSignature& signature, const Matched& matched)
+    {
+        Candidates candidates;
+        db.walk_matching(signature, [&](const HVersion& version)
+        {
+            /* Don't trust basic block for initial association */
+            if(version.type() == OBJECT_TYPE_BASIC_BLOCK)
+                return WALK_CONTINUE;
+
+            if(!matched.count(version.idx_))
+                candidates.push_back(make_candidate(db, version));
+            return WALK_CONTINUE;
+        });
+        return candidates;
+    }
+
+    typedef std::unordered_map<uint64_t, Candidates> Buckets;
+
+    Buckets split(const Candidates& candidates, size_t key)
+    {
+        Buckets buckets;
+        for(const auto& candidate : candidates)
+            buckets[candidate.keys[key]].push_back(candidate);
+        return buckets;
+    }
+
+    template<typename T>
+    void disambiguate(const Candidates& left, const Candidates& right, size_t key, const T& on_match)
+    {
+        if(left.size() == 1 && right.size() == 1 && left.front().version.type() == right.front().version.type())
+        {
+            on_match(left.front().version, right.front().version);
+            return;
+        }
+
+        if(key == KEY_COUNT)
+            return;
+
+        const auto right_buckets = split(right, key);
+        for(const auto& it : split(left, key))
+        {
+            const auto match = right_buckets.find(it.first);
+            if(match != right_buckets.end())
+                disambiguate(it.second, match->second, key + 1, on_match);
+        }
+    }
+}
+
 class ExactMatchAlgo: public IDiffAlgo
 {
 public:
@@ -90,6 +212,8 @@ bool ExactMatchAlgo::Analyse(const OnRelationFn& output, const RelationWalkerfn&
 
     LOG(DEBUG, "matching %zd objects version to %zd objects version\n", pDb1_->num_objects(), pDb2_->num_objects());
 
+    Matched matched1;
+    Matched matched2;
     pDb1_->walk_uniques([&](const HVersion& object_version, const HSignature& signature)
     {
         //cout << object_version << endl;
@@ -112,6 +236,8 @@ bool ExactMatchAlgo::Analyse(const OnRelationFn& output, const RelationWalkerfn&
             relation.version2_ = remote_object_version;
             LOG(INFO, "associate %lx(%s) <-> %lx(%s)\n", relation.version1_.address(), relation.version1_.username().value, relation.version2_.address(), relation.version2_.username().value);
             output(relation);
+            matched1.insert(relation.version1_.idx_);
+            matched2.insert(relation.version2_.idx_);
 
             exactMatchInitial++;
 
@@ -127,6 +253,46 @@ bool ExactMatchAlgo::Analyse(const OnRelationFn& output, const RelationWalkerfn&
         return WALK_CONTINUE;
     });
 
+    if(!config_.ExactMatch.CompositeKeys)
+        return true;
+
+    // split colliding signatures with composite keys until both sides are unique
+    int compositeMatch = 0;
+    std::unordered_set<HSignature> visited;
+    pDb1_->walk([&](const HVersion& object_version)
+    {
+        object_version.walk_signatures([&](const HSignature& signature)
+        {
+            if(!visited.insert(signature).second)
+                return WALK_CONTINUE;
+
+            const auto size1 = pDb1_->size_matching(signature);
+            const auto size2 = pDb2_->size_matching(signature);
+            if(!size2 || (size1 == 1 && size2 == 1))
+                return WALK_CONTINUE;
+
+            const auto left = get_candidates(*pDb1_, signature, matched1);
+            const auto right = get_candidates(*pDb2_, signature, matched2);
+            if(left.empty() || right.empty())
+                return WALK_CONTINUE;
+
+            disambiguate(left, right, KEY_TYPE, [&](const HVersion& version1, const HVersion& version2)
+            {
+                relation.version1_ = version1;
+                relation.version2_ = version2;
+                LOG(INFO, "associate %lx(%s) <-> %lx(%s) with composite key\n", version1.address(), version1.username().value, version2.address(), version2.username().value);
+                output(relation);
+                matched1.insert(version1.idx_);
+                matched2.insert(version2.idx_);
+                compositeMatch++;
+            });
+            return WALK_CONTINUE;
+        });
+        return WALK_CONTINUE;
+    });
+    LOG(INFO, "%d objects version matched with composite keys\n", compositeMatch);
+    UNUSED(compositeMatch);
+
     //    this->sortRelations();
     return true;
 }
@@ -12,7 +12,11 @@
 #include <chrono>
 #include <fstream>
 #include <iostream>
-#include <unordered_map>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <sstream>
 
 #ifdef _MSC_VER
 #   include <filesystem>
@@ -27,17 +31,292 @@ using namespace std::experimental;
 
 using json = nlohmann::json;
 
-namespace yadiff
+namespace
 {
-  struct ExternalMappingEntry
-  {
-      offset_t      src;
-      offset_t      dst;
-      std::string   comment;
+    struct ExternalMappingEntry
+    {
+        offset_t            src;
+        offset_t            dst;
+        YaToolObjectType_e  type;   // OBJECT_TYPE_UNKNOWN matches any type
+    };
+
+    struct AddressEntry
+    {
+        offset_t            ea;
+        YaToolObjectType_e  type;
+        HVersion            version;
+    };
+
+    using OnMappingEntryFn = std::function<void(const ExternalMappingEntry&)>;
+    using AddressIndex = std::vector<AddressEntry>;
+
+    // compact binary mapping: magic, then packed little-endian records
+    const char      binary_magic[] = {'y', 'a', 'm', 'a', 'p', '0', '0', '1'};
+    const size_t    binary_record_size = sizeof(uint64_t) * 2 + sizeof(uint32_t);
+
+    bool read_offset(offset_t& dst, const char* value)
+    {
+        char* end = nullptr;
+        errno = 0;
+        dst = std::strtoull(value, &end, 0);
+        return !errno && end != value;
+    }
+
+    bool read_offset(offset_t& dst, const json& value)
+    {
+        if(value.is_number_unsigned())
+        {
+            dst = value.get<offset_t>();
+            return true;
+        }
+        if(value.is_string())
+            return read_offset(dst, value.get<std::string>().data());
+        return false;
+    }
+
+    YaToolObjectType_e read_type(const std::string& value)
+    {
+        if(value.empty())
+            return OBJECT_TYPE_UNKNOWN;
+        const auto type = get_object_type(value.data());
+        if(type == OBJECT_TYPE_UNKNOWN)
+            LOG(WARNING, "unknown object type %s, matching any type\n", value.data());
+        return type;
+    }
+
+    bool read_json_entry(ExternalMappingEntry& entry, const json& element)
+    {
+        const auto it_src = element.find("src");
+        if(it_src == element.end() || !read_offset(entry.src, *it_src))
+        {
+            LOG(WARNING, "invalid JSON entry, no src in it\n");
+            return false;
+        }
+        const auto it_dst = element.find("dst");
+        if(it_dst == element.end() || !read_offset(entry.dst, *it_dst))
+        {
+            LOG(WARNING, "invalid JSON entry, no dst in it\n");
+            return false;
+        }
+        const auto it_type = element.find("type");
+        if(it_type != element.end() && it_type->is_string())
+            entry.type = read_type(it_type->get<std::string>());
+        return true;
+    }
+
+    void read_json_element(const std::string& text, const OnMappingEntryFn& on_entry)
+    {
+        ExternalMappingEntry entry{0, 0, OBJECT_TYPE_UNKNOWN};
+        try
+        {
+            if(!read_json_entry(entry, json::parse(text)))
+                return;
+        }
+        catch(const std::exception& err)
+        {
+            LOG(WARNING, "invalid JSON entry: %s\n", err.what());
+            return;
+        }
+        on_entry(entry);
+    }
+
+    // streams a JSON array of flat objects, parsing one element at a time
+    // so that large mappings never build a whole document in memory
+    bool read_json_mapping(std::istream& stream, const OnMappingEntryFn& on_entry)
+    {
+        std::string text;
+        int depth = 0;
+        bool in_string = false;
+        bool escaped = false;
+        char c;
+        while(stream.get(c))
+        {
+            if(depth)
+                text += c;
+            if(in_string)
+            {
+                if(escaped)
+                    escaped = false;
+                else if(c == '\\')
+                    escaped = true;
+                else if(c == '"')
+                    in_string = false;
+                continue;
+            }
+            switch(c)
+            {
+                case '"':
+                    in_string = !!depth;
+                    break;
+
+                case '{':
+                    if(!depth++)
+                        text.assign(1, c);
+                    break;
+
+                case '}':
+                    if(!depth)
+                    {
+                        LOG(ERROR, "invalid JSON mapping, unbalanced braces\n");
+                        return false;
+                    }
+                    if(!--depth)
+                        read_json_element(text, on_entry);
+                    break;
+            }
+        }
+        if(depth)
+        {
+            LOG(ERROR, "invalid JSON mapping, truncated entry\n");
+            return false;
+        }
+        return true;
+    }
+
+    // one "src,dst[,type]" line per entry, '#' starts a comment
+    bool read_csv_mapping(std::istream& stream, const OnMappingEntryFn& on_entry)
+    {
+        std::string line;
+        std::string src;
+        std::string dst;
+        std::string type;
+        size_t lineno = 0;
+        while(std::getline(stream, line))
+        {
+            ++lineno;
+            const auto comment = line.find('#');
+            if(comment != std::string::npos)
+                line.resize(comment);
+            if(line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+
+            std::istringstream fields(line);
+            src.clear();
+            dst.clear();
+            type.clear();
+            std::getline(fields, src, ',');
+            std::getline(fields, dst, ',');
+            std::getline(fields, type, ',');
+            const auto trim = [](std::string& value)
+            {
+                const auto begin = value.find_first_not_of(" \t\r");
+                const auto end = value.find_last_not_of(" \t\r");
+                value = begin == std::string::npos ? std::string() : value.substr(begin, end - begin + 1);
+            };
+            trim(src);
+            trim(dst);
+            trim(type);
+
+            ExternalMappingEntry entry{0, 0, OBJECT_TYPE_UNKNOWN};
+            if(!read_offset(entry.src, src.data()) || !read_offset(entry.dst, dst.data()))
+            {
+                LOG(WARNING, "invalid CSV entry at line %zd\n", lineno);
+                continue;
+            }
+            entry.type = read_type(type);
+            on_entry(entry);
+        }
+        return true;
+    }
+
+    template<typename T>
+    T read_le(const char* src)
+    {
+        T value = 0;
+        for(size_t i = 0; i < sizeof value; ++i)
+            value |= static_cast<T>(static_cast<uint8_t>(src[i])) << (i * 8);
+        return value;
+    }
 
-      ExternalMappingEntry(offset_t s_, offset_t d_, std::string c_): src(s_), dst(d_), comment(c_){}
-  };
+    bool read_binary_mapping(std::istream& stream, const OnMappingEntryFn& on_entry)
+    {
+        std::vector<char> buffer(binary_record_size * 4096);
+        size_t left = 0;
+        while(stream)
+        {
+            stream.read(&buffer[left], buffer.size() - left);
+            const auto size = left + static_cast<size_t>(stream.gcount());
+            size_t pos = 0;
+            for(; pos + binary_record_size <= size; pos += binary_record_size)
+            {
+                const auto record = &buffer[pos];
+                const auto type = read_le<uint32_t>(&record[sizeof(uint64_t) * 2]);
+                on_entry({
+                    read_le<uint64_t>(&record[0]),
+                    read_le<uint64_t>(&record[sizeof(uint64_t)]),
+                    type < OBJECT_TYPE_COUNT ? static_cast<YaToolObjectType_e>(type) : OBJECT_TYPE_UNKNOWN,
+                });
+            }
+            left = size - pos;
+            std::copy(buffer.begin() + pos, buffer.begin() + size, buffer.begin());
+        }
+        if(left)
+        {
+            LOG(ERROR, "invalid binary mapping, truncated record\n");
+            return false;
+        }
+        return true;
+    }
+
+    bool read_mapping(const std::string& path, const OnMappingEntryFn& on_entry)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if(!stream)
+        {
+            LOG(ERROR, "unable to open %s\n", path.data());
+            return false;
+        }
+
+        char magic[sizeof binary_magic];
+        stream.read(magic, sizeof magic);
+        if(stream.gcount() == sizeof magic && !memcmp(magic, binary_magic, sizeof magic))
+            return read_binary_mapping(stream, on_entry);
+
+        stream.clear();
+        stream.seekg(0);
+        if(filesystem::path(path).extension() == ".csv")
+            return read_csv_mapping(stream, on_entry);
+        return read_json_mapping(stream, on_entry);
+    }
+
+    bool operator<(const AddressEntry& a, const AddressEntry& b)
+    {
+        return std::make_pair(a.ea, a.type) < std::make_pair(b.ea, b.type);
+    }
 
+    AddressIndex make_address_index(const IModel& db)
+    {
+        AddressIndex index;
+        db.walk([&](const HVersion& hver)
+        {
+            index.push_back({hver.address(), hver.type(), hver});
+            return WALK_CONTINUE;
+        });
+        std::stable_sort(index.begin(), index.end());
+        return index;
+    }
+
+    using AddressRange = std::pair<AddressIndex::const_iterator, AddressIndex::const_iterator>;
+
+    AddressRange find_address(const AddressIndex& index, offset_t ea, YaToolObjectType_e type)
+    {
+        if(type != OBJECT_TYPE_UNKNOWN)
+            return std::equal_range(index.begin(), index.end(), AddressEntry{ea, type, HVersion()});
+
+        const auto begin = std::lower_bound(index.begin(), index.end(), ea, [](const AddressEntry& a, offset_t b)
+        {
+            return a.ea < b;
+        });
+        const auto end = std::upper_bound(begin, index.end(), ea, [](offset_t a, const AddressEntry& b)
+        {
+            return a < b.ea;
+        });
+        return std::make_pair(begin, end);
+    }
+}
+
+namespace yadiff
+{
 class ExternalMappingMatchAlgo: public IDiffAlgo
 {
 public:
@@ -89,40 +368,30 @@ bool ExternalMappingMatchAlgo::Prepare(const IModel& db1, const IModel& db2)
     pDb1_ = &db1;
     pDb2_ = &db2;
 
-
-    // load JSON mapping
+    // load mapping, either JSON, CSV or binary
     if(!filesystem::exists(filesystem::path(config_.ExternalMappingMatch.MappingFilePath)))
       {
-        LOG(ERROR, "json file %s does not exist\n", config_.ExternalMappingMatch.MappingFilePath);
+        LOG(ERROR, "mapping file %s does not exist\n", config_.ExternalMappingMatch.MappingFilePath);
         return false;
       }
-    std::ifstream file(config_.ExternalMappingMatch.MappingFilePath);
-    json data = json::parse(file);
-    for(auto it = data.begin(); it != data.end(); ++it)
-      {
-        const auto element = *it;
-        auto it_src = element.find("src");
-        if(it_src == element.end())
-          {
-            LOG(WARNING, "invalid JSON entry, no src in it\n");
-            continue;
-          }
-        auto it_dst = element.find("dst");
-        if(it_dst == element.end())
-        {
-            LOG(WARNING, "JSON entry, no dst in it\n");
-            continue;
-          }
-        auto it_comment = element.find("comment");
-        if(it_comment == element.end())
-        {
-            LOG(WARNING, "invalid JSON entry, no comment in it\n");
-            continue;
-          }
-        mapping_.emplace_back(ExternalMappingEntry{*it_src, *it_dst, *it_comment});
-      }
-
+    mapping_.clear();
+    const auto ok = read_mapping(config_.ExternalMappingMatch.MappingFilePath, [&](const ExternalMappingEntry& entry)
+    {
+        mapping_.push_back(entry);
+    });
+    if(!ok)
+        return false;
 
+    // keep the first entry for any src address & type
+    std::stable_sort(mapping_.begin(), mapping_.end(), [](const ExternalMappingEntry& a, const ExternalMappingEntry& b)
+    {
+        return std::make_pair(a.src, a.type) < std::make_pair(b.src, b.type);
+    });
+    const auto end = std::unique(mapping_.begin(), mapping_.end(), [](const ExternalMappingEntry& a, const ExternalMappingEntry& b)
+    {
+        return a.src == b.src && a.type == b.type;
+    });
+    mapping_.erase(end, mapping_.end());
     return true;
 }
 
@@ -136,14 +405,6 @@ bool ExternalMappingMatchAlgo::Analyse(const OnRelationFn& output, const Relatio
     if(nullptr == pDb2_)
         return false;
 
-//    std::vector<offset_t> src_offset_to_treat;
-    std::unordered_map<offset_t, offset_t> offset_to_treat;
-    for(const auto entry : mapping_)
-      {
-        offset_to_treat.emplace(std::make_pair(entry.src, entry.dst));
-//        src_offset_to_treat.push_back(entry.src);
-      }
-
     Relation relation;
     memset(&relation, 0, sizeof relation);
     if(config_.ExternalMappingMatch.CustomRelationConfidence)
@@ -152,45 +413,39 @@ bool ExternalMappingMatchAlgo::Analyse(const OnRelationFn& output, const Relatio
       relation.confidence_ = RELATION_CONFIDENCE_GOOD;
     relation.direction_ = RELATION_DIRECTION_BOTH;
 
-    pDb1_->walk([&](const HVersion& src_version)
+    // sorted (address, type) indexes resolve every entry in O(log n)
+    const auto index1 = make_address_index(*pDb1_);
+    const auto index2 = make_address_index(*pDb2_);
+    for(const auto& entry : mapping_)
     {
-        const auto match = offset_to_treat.find(src_version.address());
-        if(match == offset_to_treat.end())
-            return WALK_CONTINUE;
-
-        // src address found, stat looking for dst address
-        pDb2_->walk([&](const HVersion& dst_version)
+        // both ranges are sorted by type: only pair objects of the same type,
+        // and only the first object of each type at either address
+        auto src = find_address(index1, entry.src, entry.type);
+        auto dst = find_address(index2, entry.dst, entry.type);
+        while(src.first != src.second && dst.first != dst.second)
         {
-            if(match->second != dst_version.address())
-                return WALK_CONTINUE;
-
-            // check signatures
-            relation.type_ = RELATION_TYPE_DIFF;
-            bool sign_found = false;
-            src_version.walk_signatures([&](const HSignature& src_sign)
+            if(src.first->type < dst.first->type)
             {
-                dst_version.walk_signatures([&](const HSignature& dst_sign)
-                {
-                    if(src_sign == dst_sign)
-                    {
-                        sign_found = true;
-                        relation.type_ = RELATION_TYPE_EXACT_MATCH;
-                        return WALK_STOP;
-                    }
-                    return WALK_CONTINUE;
-                });
-                return sign_found ? WALK_STOP : WALK_CONTINUE;
-            });
-            relation.version1_ = src_version;
-            relation.version2_ = dst_version;
+                ++src.first;
+                continue;
+            }
+            if(dst.first->type < src.first->type)
+            {
+                ++dst.first;
+                continue;
+            }
+
+            const auto type = src.first->type;
+            relation.version1_ = src.first->version;
+            relation.version2_ = dst.first->version;
+            relation.type_ = has_common_signature(relation.version1_, relation.version2_) ? RELATION_TYPE_EXACT_MATCH : RELATION_TYPE_DIFF;
             output(relation);
-            offset_to_treat.erase(match->first);
-            return WALK_STOP;
-        });
-
-        // if there is no more mapping to do, stop iterating
-        return offset_to_treat.empty() ? WALK_STOP : WALK_CONTINUE;
-    });
+            while(src.first != src.second && src.first->type == type)
+                ++src.first;
+            while(dst.first != dst.second && dst.first->type == type)
+                ++dst.first;
+        }
+    }
 
     return true;
 }
@@ -0,0 +1,209 @@
+#include "NameMatch.hpp"
+#include "Algo.hpp"
+
+#include "IModel.hpp"
+#include "HVersion.hpp"
+#include "VersionRelation.hpp"
+#include "Helpers.h"
+#include "Utils.hpp"
+#include "Yatools.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("names", (FMT), ## __VA_ARGS__)
+
+namespace
+{
+    struct NameEntry
+    {
+        YaToolObjectType_e  type;
+        std::string         key;    // normalized name
+        const_string_ref    name;   // raw name, owned by the model
+        HVersion            version;
+    };
+
+    bool operator<(const NameEntry& a, const NameEntry& b)
+    {
+        if(a.type != b.type)
+            return a.type < b.type;
+        return a.key < b.key;
+    }
+
+    // only objects whose names are unique in their namespace
+    // members & basic blocks reuse names across parents
+    bool is_named_type(YaToolObjectType_e type)
+    {
+        switch(type)
+        {
+            case OBJECT_TYPE_DATA:
+            case OBJECT_TYPE_CODE:
+            case OBJECT_TYPE_FUNCTION:
+            case OBJECT_TYPE_STRUCT:
+            case OBJECT_TYPE_ENUM:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool starts_with(const const_string_ref& value, const char* prefix)
+    {
+        const auto size = strlen(prefix);
+        return value.size >= size && !memcmp(value.value, prefix, size);
+    }
+
+    // removes decorations which depend on the toolchain or the calling convention
+    // but not on the symbol itself: import prefixes, leading underscores
+    // & stdcall/fastcall argument sizes
+    std::string normalize(const_string_ref name)
+    {
+        if(starts_with(name, "__imp_"))
+            name = {name.value + 6, name.size - 6};
+        while(name.size && (name.value[0] == '_' || name.value[0] == '@'))
+            name = {name.value + 1, name.size - 1};
+
+        // msvc c++ names start with '?' and use '@' as separators
+        const auto is_msvc_mangled = name.size && name.value[0] == '?';
+        if(!is_msvc_mangled)
+        {
+            auto size = name.size;
+            while(size && isdigit(static_cast<unsigned char>(name.value[size - 1])))
+                --size;
+            if(size && size < name.size && name.value[size - 1] == '@')
+                name.size = size - 1;
+        }
+        return make_string(name);
+    }
+
+    std::vector<NameEntry> get_names(const IModel& db)
+    {
+        std::vector<NameEntry> names;
+        db.walk([&](const HVersion& version)
+        {
+            const auto type = version.type();
+            if(!is_named_type(type))
+                return WALK_CONTINUE;
+
+            const auto name = version.username();
+            if(!name.size || is_default_name(name))
+                return WALK_CONTINUE;
+
+            auto key = normalize(name);
+            if(key.empty())
+                return WALK_CONTINUE;
+
+            names.push_back({type, std::move(key), name, version});
+            return WALK_CONTINUE;
+        });
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+}
+
+namespace yadiff
+{
+class NameMatchAlgo: public IDiffAlgo
+{
+public:
+    NameMatchAlgo(const AlgoCfg& config);
+
+    /*
+     * prepares input signature databases
+     */
+    bool Prepare(const IModel& db1, const IModel& db2) override;
+
+    /*
+     * matches objects with identical user names in both databases
+     */
+    bool Analyse(const OnRelationFn& output, const RelationWalkerfn& input) override;
+
+    const char* GetName() const override;
+
+private:
+    const IModel* pDb1_;
+    const IModel* pDb2_;
+};
+
+std::shared_ptr<IDiffAlgo> MakeNameMatchAlgo(const AlgoCfg& config)
+{
+    return std::make_shared<NameMatchAlgo>(config);
+}
+
+const char* NameMatchAlgo::GetName() const
+{
+    return "NameMatchAlgo";
+}
+
+NameMatchAlgo::NameMatchAlgo(const AlgoCfg& config)
+    : pDb1_(nullptr)
+    , pDb2_(nullptr)
+{
+    UNUSED(config);
+}
+
+bool NameMatchAlgo::Prepare(const IModel& db1, const IModel& db2)
+{
+    pDb1_ = &db1;
+    pDb2_ = &db2;
+    return true;
+}
+
+bool NameMatchAlgo::Analyse(const OnRelationFn& output, const RelationWalkerfn& input)
+{
+    UNUSED(input);
+    if(!pDb1_ || !pDb2_)
+        return false;
+
+    const auto names1 = get_names(*pDb1_);
+    const auto names2 = get_names(*pDb2_);
+
+    Relation relation;
+    memset(&relation, 0, sizeof relation);
+    relation.direction_ = RELATION_DIRECTION_BOTH;
+
+    // merge-join both sorted name lists
+    // duplicated names on either side are ambiguous & skipped
+    size_t matched = 0;
+    size_t ambiguous = 0;
+    auto it1 = names1.begin();
+    auto it2 = names2.begin();
+    while(it1 != names1.end() && it2 != names2.end())
+    {
+        if(*it1 < *it2)
+        {
+            ++it1;
+            continue;
+        }
+        if(*it2 < *it1)
+        {
+            ++it2;
+            continue;
+        }
+        const auto end1 = std::upper_bound(it1, names1.end(), *it1);
+        const auto end2 = std::upper_bound(it2, names2.end(), *it2);
+        if(std::distance(it1, end1) == 1 && std::distance(it2, end2) == 1)
+        {
+            relation.version1_ = it1->version;
+            relation.version2_ = it2->version;
+            // normalized names only are weaker than identical names
+            relation.confidence_ = it1->name == it2->name ? RELATION_CONFIDENCE_MAX : RELATION_CONFIDENCE_GOOD;
+            relation.type_ = has_common_signature(relation.version1_, relation.version2_) ? RELATION_TYPE_EXACT_MATCH : RELATION_TYPE_DIFF;
+            output(relation);
+            ++matched;
+        }
+        else
+        {
+            ++ambiguous;
+        }
+        it1 = end1;
+        it2 = end2;
+    }
+    LOG(INFO, "%zd objects matched by name, %zd ambiguous names\n", matched, ambiguous);
+    return true;
+}
+}
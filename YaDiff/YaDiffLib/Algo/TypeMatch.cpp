@@ -0,0 +1,410 @@
+#include "TypeMatch.hpp"
+#include "Algo.hpp"
+
+#include "IModel.hpp"
+#include "HVersion.hpp"
+#include "VersionRelation.hpp"
+#include "Helpers.h"
+#include "Utils.hpp"
+#include "Yatools.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("types", (FMT), ## __VA_ARGS__)
+
+namespace
+{
+    // nested types are hashed up to this depth, deeper ones only by kind & size
+    const int MAX_NESTED_DEPTH = 2;
+
+    const YaToolObjectType_e type_kinds[] =
+    {
+        OBJECT_TYPE_STRUCT,
+        OBJECT_TYPE_ENUM,
+        OBJECT_TYPE_STACKFRAME,
+        OBJECT_TYPE_LOCAL_TYPE,
+    };
+
+    bool is_type(YaToolObjectType_e type)
+    {
+        return std::find(std::begin(type_kinds), std::end(type_kinds), type) != std::end(type_kinds);
+    }
+
+    bool is_member(YaToolObjectType_e type)
+    {
+        switch(type)
+        {
+            case OBJECT_TYPE_STRUCT_MEMBER:
+            case OBJECT_TYPE_ENUM_MEMBER:
+            case OBJECT_TYPE_STACKFRAME_MEMBER:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    uint64_t mix(uint64_t seed, uint64_t value)
+    {
+        return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+    }
+
+    uint64_t mix(uint64_t seed, const const_string_ref& value)
+    {
+        // fnv-1a
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for(size_t i = 0; i < value.size; ++i)
+            hash = (hash ^ static_cast<uint8_t>(value.value[i])) * 0x100000001B3ull;
+        return mix(seed, hash);
+    }
+
+    bool is_ident(char c)
+    {
+        return isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+    }
+
+    // builtin type names & qualifiers, every other identifier names a type,
+    // a member or an argument and depends on the database
+    bool is_builtin(const std::string& token)
+    {
+        static const std::unordered_set<std::string> builtins =
+        {
+            "void", "char", "short", "int", "long", "float", "double", "signed", "unsigned",
+            "bool", "wchar_t", "const", "volatile", "struct", "union", "enum",
+            "__int8", "__int16", "__int32", "__int64", "__int128",
+            "_BYTE", "_WORD", "_DWORD", "_QWORD", "_OWORD", "_TBYTE", "_BOOL1", "_BOOL2", "_BOOL4",
+            "__cdecl", "__stdcall", "__fastcall", "__thiscall", "__usercall", "__userpurge",
+            "__near", "__far", "__ptr32", "__ptr64", "__unaligned", "__hidden", "__return_ptr",
+        };
+        return builtins.count(token) > 0;
+    }
+
+    // replaces user identifiers with a placeholder, keeping builtin types,
+    // punctuation & array sizes: "struct foo *bar[4]" becomes "struct $ *$[4]"
+    std::string get_shape(const const_string_ref& prototype)
+    {
+        std::string shape;
+        shape.reserve(prototype.size);
+        size_t i = 0;
+        while(i < prototype.size)
+        {
+            const auto c = prototype.value[i];
+            if(isspace(static_cast<unsigned char>(c)))
+            {
+                ++i;
+                continue;
+            }
+            if(!is_ident(c) || isdigit(static_cast<unsigned char>(c)))
+            {
+                shape += c;
+                ++i;
+                continue;
+            }
+            const auto begin = i;
+            while(i < prototype.size && is_ident(prototype.value[i]))
+                ++i;
+            const auto token = std::string(&prototype.value[begin], i - begin);
+            shape += is_builtin(token) ? token : "$";
+            shape += ' ';
+        }
+        return shape;
+    }
+
+    // database-independent layout hashes
+    struct Layouts
+    {
+        // nested types are hashed by depth, so cyclic types
+        // hash the same whatever the walk order
+        uint64_t get_type(const HVersion& version, int depth)
+        {
+            const auto type = version.type();
+            auto hash = mix(mix(0, type), version.size());
+            hash = mix(hash, version.flags());
+            if(depth > MAX_NESTED_DEPTH)
+                return hash;
+
+            if(type == OBJECT_TYPE_LOCAL_TYPE)
+                return mix(hash, make_string_ref(get_shape(version.prototype())));
+
+            // members are sorted by offset then layout, union members share offset zero
+            std::vector<std::pair<uint64_t, uint64_t>> members;
+            version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& member)
+            {
+                if(is_member(member.type()))
+                    members.emplace_back(member.address(), get_member(member, depth));
+                return WALK_CONTINUE;
+            });
+            std::sort(members.begin(), members.end());
+            hash = mix(hash, members.size());
+            for(const auto& it : members)
+                hash = mix(mix(hash, it.first), it.second);
+            return hash;
+        }
+
+        uint64_t get_member(const HVersion& member, int depth)
+        {
+            // enum members are only defined by their value & mask
+            auto hash = mix(mix(0, member.size()), member.flags());
+            if(member.type() == OBJECT_TYPE_ENUM_MEMBER)
+                return hash;
+
+            hash = mix(hash, make_string_ref(get_shape(member.prototype())));
+            uint64_t nested = 0;
+            member.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+            {
+                if(is_type(xref.type()))
+                    nested += get(xref, depth + 1) * 2 + 1;
+                return WALK_CONTINUE;
+            });
+            return mix(hash, nested);
+        }
+
+        uint64_t get(const HVersion& version, int depth)
+        {
+            auto& cache = cache_[depth];
+            const auto it = cache.find(version.id());
+            if(it != cache.end())
+                return it->second;
+            const auto hash = get_type(version, depth);
+            cache.emplace(version.id(), hash);
+            return hash;
+        }
+
+        std::unordered_map<YaToolObjectId, uint64_t> cache_[MAX_NESTED_DEPTH + 2];
+    };
+
+    uint64_t get_member_names(const HVersion& version)
+    {
+        if(version.type() == OBJECT_TYPE_LOCAL_TYPE)
+            return mix(0, version.prototype());
+
+        std::vector<std::pair<offset_t, std::string>> names;
+        version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& member)
+        {
+            if(is_member(member.type()))
+                names.emplace_back(member.address(), make_string(member.username()));
+            return WALK_CONTINUE;
+        });
+        std::sort(names.begin(), names.end());
+        uint64_t hash = 0;
+        for(const auto& it : names)
+            hash = mix(hash, make_string_ref(it.second));
+        return hash;
+    }
+
+    // keys are tried in this order, each level splitting the previous buckets
+    enum TypeKey_e
+    {
+        KEY_LAYOUT,
+        KEY_MEMBER_NAMES,
+        KEY_NAME,
+        KEY_COUNT,
+    };
+
+    struct Candidate
+    {
+        HVersion version;
+        uint64_t keys[KEY_COUNT];
+    };
+
+    typedef std::vector<Candidate> Candidates;
+    typedef std::unordered_set<YaToolObjectId> Matched;
+
+    Candidates get_candidates(const IModel& db, const Matched& matched)
+    {
+        Layouts layouts;
+        Candidates candidates;
+        for(const auto type : type_kinds)
+            db.walk_range(db.type_range(type), [&](const HVersion& version)
+            {
+                if(matched.count(version.id()))
+                    return WALK_CONTINUE;
+
+                Candidate candidate;
+                candidate.version = version;
+                candidate.keys[KEY_LAYOUT] = layouts.get(version, 0);
+                candidate.keys[KEY_MEMBER_NAMES] = get_member_names(version);
+                candidate.keys[KEY_NAME] = mix(0, version.username());
+                candidates.push_back(candidate);
+                return WALK_CONTINUE;
+            });
+        return candidates;
+    }
+
+    typedef std::map<uint64_t, Candidates> Buckets;
+
+    Buckets split(const Candidates& candidates, size_t key)
+    {
+        Buckets buckets;
+        for(const auto& candidate : candidates)
+            buckets[candidate.keys[key]].push_back(candidate);
+        return buckets;
+    }
+
+    template<typename T>
+    void disambiguate(const Candidates& left, const Candidates& right, size_t key, const T& on_match)
+    {
+        if(left.size() == 1 && right.size() == 1)
+        {
+            on_match(left.front(), right.front());
+            return;
+        }
+
+        if(key == KEY_COUNT)
+            return;
+
+        const auto right_buckets = split(right, key);
+        for(const auto& it : split(left, key))
+        {
+            const auto match = right_buckets.find(it.first);
+            if(match != right_buckets.end())
+                disambiguate(it.second, match->second, key + 1, on_match);
+        }
+    }
+
+    typedef std::pair<offset_t, flags_t> MemberKey;
+    typedef std::map<MemberKey, HVersion> Members;
+
+    // struct & stack members are keyed by offset, enum members by value & mask
+    Members get_members(const HVersion& version)
+    {
+        Members members;
+        std::set<MemberKey> duplicates;
+        version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& member)
+        {
+            if(!is_member(member.type()))
+                return WALK_CONTINUE;
+            const auto flags = member.type() == OBJECT_TYPE_ENUM_MEMBER ? member.flags() : 0;
+            const auto key = std::make_pair(member.address(), flags);
+            if(!members.emplace(key, member).second)
+                duplicates.insert(key);
+            return WALK_CONTINUE;
+        });
+        // union members share their offset & are skipped
+        for(const auto& key : duplicates)
+            members.erase(key);
+        return members;
+    }
+}
+
+namespace yadiff
+{
+class TypeMatchAlgo: public IDiffAlgo
+{
+public:
+    TypeMatchAlgo(const AlgoCfg& config);
+
+    /*
+     * prepares input signature databases
+     */
+    bool Prepare(const IModel& db1, const IModel& db2) override;
+
+    /*
+     * matches structs, enums, stack frames & local types with identical layouts
+     */
+    bool Analyse(const OnRelationFn& output, const RelationWalkerfn& input) override;
+
+    const char* GetName() const override;
+
+private:
+    const IModel* pDb1_;
+    const IModel* pDb2_;
+};
+
+std::shared_ptr<IDiffAlgo> MakeTypeMatchAlgo(const AlgoCfg& config)
+{
+    return std::make_shared<TypeMatchAlgo>(config);
+}
+
+const char* TypeMatchAlgo::GetName() const
+{
+    return "TypeMatchAlgo";
+}
+
+TypeMatchAlgo::TypeMatchAlgo(const AlgoCfg& config)
+    : pDb1_(nullptr)
+    , pDb2_(nullptr)
+{
+    UNUSED(config);
+}
+
+bool TypeMatchAlgo::Prepare(const IModel& db1, const IModel& db2)
+{
+    pDb1_ = &db1;
+    pDb2_ = &db2;
+    return true;
+}
+
+bool TypeMatchAlgo::Analyse(const OnRelationFn& output, const RelationWalkerfn& input)
+{
+    if(!pDb1_ || !pDb2_)
+        return false;
+
+    // types already matched, by name for example, are left as is
+    Matched matched1;
+    Matched matched2;
+    input([&](const Relation& relation)
+    {
+        if(is_type(relation.version1_.type()))
+        {
+            matched1.insert(relation.version1_.id());
+            matched2.insert(relation.version2_.id());
+        }
+        return true;
+    });
+
+    const auto candidates1 = get_candidates(*pDb1_, matched1);
+    const auto candidates2 = get_candidates(*pDb2_, matched2);
+
+    Relation relation;
+    memset(&relation, 0, sizeof relation);
+    relation.direction_ = RELATION_DIRECTION_BOTH;
+
+    size_t matched = 0;
+    size_t members = 0;
+    const auto on_match = [&](const Candidate& left, const Candidate& right)
+    {
+        // identical layouts are only trusted when names agree
+        const auto same_names = left.keys[KEY_MEMBER_NAMES] == right.keys[KEY_MEMBER_NAMES];
+        const auto same_name = same_names && left.version.username() == right.version.username();
+        relation.version1_ = left.version;
+        relation.version2_ = right.version;
+        relation.confidence_ = same_names ? RELATION_CONFIDENCE_MAX : RELATION_CONFIDENCE_GOOD;
+        relation.type_ = same_name ? RELATION_TYPE_EXACT_MATCH : RELATION_TYPE_DIFF;
+        output(relation);
+        ++matched;
+
+        // members of identical layouts match one to one
+        const auto members2 = get_members(right.version);
+        for(const auto& it : get_members(left.version))
+        {
+            const auto match = members2.find(it.first);
+            if(match == members2.end())
+                continue;
+            relation.version1_ = it.second;
+            relation.version2_ = match->second;
+            relation.type_ = it.second.username() == match->second.username() ? RELATION_TYPE_EXACT_MATCH : RELATION_TYPE_DIFF;
+            output(relation);
+            ++members;
+        }
+    };
+    // member & type names only split colliding layouts
+    const auto layouts2 = split(candidates2, KEY_LAYOUT);
+    for(const auto& it : split(candidates1, KEY_LAYOUT))
+    {
+        const auto match = layouts2.find(it.first);
+        if(match != layouts2.end())
+            disambiguate(it.second, match->second, KEY_MEMBER_NAMES, on_match);
+    }
+    LOG(INFO, "%zd types matched by layout with %zd members\n", matched, members);
+    return true;
+}
+}
@@ -11,6 +11,7 @@
 #include "VectorSign/InstructionVector.hpp"
 #include "VectorSign/IArch.hpp"
 #include "Algo.hpp"
+#include "MemoryBudget.hpp"
 #include "HVersion.hpp"
 #include "VersionRelation.hpp"
 #include "Helpers.h"
@@ -70,8 +71,7 @@ struct FunctionSignature_t
     std::vector <YaToolObjectId>                children;       // The pointers to the children functions
     std::map<int, std::vector<YaToolObjectId>>  equiLevelMap;   // for joining BBs
     yadiff::FunctionData_t                      function_data;
-    std::vector<double>                         vector;
-    std::vector<double>                         concatenated_vector;
+    size_t                                      row;            // The row of this function in the feature matrices
 };
 
 // Basic Block Map
@@ -88,6 +88,8 @@ struct VectorSignDatabase
     yadiff::VectorTree_t                          idTree;                // Used as a tree, same vector = same group
     yadiff::VectorSignatureSet_t                  vectSet;
     yadiff::VectorGroups_t                        vectorGroups;
+    yadiff::FeatureMatrix_t                       features;              // One row per function
+    yadiff::FeatureMatrix_t                       concatenated_features; // Features, then father & child statistics
     const IModel*                                 pDb;
 };
 
@@ -109,7 +111,7 @@ struct VectorSignAlgo : public yadiff::IDiffAlgo
     void SetFunctionFields(const HVersion& fctVersion, FunctionSignatureMap_t& fsMap);
 
     // The Main prepare function, create a signature for all function and store it in a map (now global)
-    void CreateFunctionSignatureMap(FunctionSignatureMap_t& functionSignatureMap, const IModel& db, const yadiff::AlgoCfg& config);
+    void CreateFunctionSignatureMap(VectorSignDatabase& database, const IModel& db, const yadiff::AlgoCfg& config);
 
     // TODO
     // void MakeGroups(FunctionSignatureMap_t fsMap, VectorTree_t fctGroup);
@@ -118,11 +120,11 @@ struct VectorSignAlgo : public yadiff::IDiffAlgo
     void CalculateAllFunctionDistanceToLeave(FunctionSignatureMap_t& functionSignatureMap);
     void CalculateAllFunctionDistanceToRoot(FunctionSignatureMap_t& functionSignatureMap, const IModel& db1);
 
-    // Print some data of the FunctionSIgnature or just the name of these data if bIsFirstLine
-    void PrintFunctionSignature(std::ostream& dst, const FunctionSignature_t& functionSignature, bool is_first_line, std::vector<std::string>* pconcatenated_string);
+    // Print the concatenated features of the FunctionSignature
+    void PrintFunctionSignature(std::ostream& dst, const FunctionSignature_t& functionSignature, const yadiff::FeatureMatrix_t& features);
 
     // Print the map, recursively calling PrintFunctionSign
-    void PrintFunctionSignatureMap(const FunctionSignatureMap_t& functionSignatureMap);
+    void PrintFunctionSignatureMap(const VectorSignDatabase& database);
 
     // TODO must return something, see YaDiff relations currently, just printing them
     void GetAllFunctionRelation(const yadiff::OnRelationFn& output, const yadiff::VectorGroups_t& vectorGroups1, const yadiff::VectorTree_t& fctGroup2);
@@ -161,13 +163,13 @@ bool VectorSignAlgo::Prepare(const IModel& db1, const IModel& db2)
     vectorSignDatabase2.pDb = &db2;
 
     LOG(INFO, "Treat First database\n");
-    CreateFunctionSignatureMap(vectorSignDatabase1.functionSignatureMap, db1, config_);
+    CreateFunctionSignatureMap(vectorSignDatabase1, db1, config_);
 
     // Log when wait
     if (config_.VectorSign.mapDestination != NULL)
     {
         LOG(INFO, "MaxLow then Min Hight \n");
-        PrintFunctionSignatureMap(vectorSignDatabase1.functionSignatureMap);
+        PrintFunctionSignatureMap(vectorSignDatabase1);
     }
 
     return true;
@@ -251,7 +253,8 @@ bool VectorSignAlgo::ControlFlowGraphHorizontalWalk(const HVersion& fctVersion,
 {
     std::queue<HVersion>                     bb_to_visit_now;
     std::map<int, std::vector<YaToolObjectId>>     equiLevelMap;
-    std::vector<int>                               height_vector;                // the dist_to_root of all leaves
+    yadiff::Moments_t<int>                         height_moments;               // the dist_to_root of all leaves
+    int                                            height_max = 0;
     std::vector<int>                               size_vector;                  // TODO not used : the size of all bb
     BasicBlockSignatureMap_t                       bbsMap;
     auto&                                          fctSign = functionSignatureMap[fctVersion.id()];
@@ -315,14 +318,17 @@ bool VectorSignAlgo::ControlFlowGraphHorizontalWalk(const HVersion& fctVersion,
         });
 
         if (bDoBBRet)
-            height_vector.push_back(iFatherDistToRoot);
+        {
+            height_moments.Add(iFatherDistToRoot);
+            height_max = std::max(height_max, iFatherDistToRoot);
+        }
     }
 
 
     // TODO Get height min
-    function_data.cfg.height = *std::max_element(height_vector.begin(), height_vector.end()) + 1;
-    double height_mean = static_cast<double>(function_data.cfg.height) / height_vector.size();
-    function_data.cfg.height_disp =  yadiff::GetVariance(height_vector, height_mean);
+    function_data.cfg.height = height_max + 1;
+    double height_mean = static_cast<double>(function_data.cfg.height) / height_moments.Weight();
+    function_data.cfg.height_disp = height_moments.Weight() ? std::sqrt(height_moments.Variance(height_mean)) : DEFAULT_DOUBLE;
 
 
     // Get the max width  and the mean width
@@ -355,7 +361,7 @@ void VectorSignAlgo::SetFunctionFields(const HVersion& fctVersion, FunctionSigna
     const auto           functionId                = fctVersion.id();
     auto&                functionSignature         = fsMap[functionId];
     auto&                function_data             = functionSignature.function_data;
-    std::vector<int>     bbSizeVector;
+    yadiff::Moments_t<int> bbSizeMoments;
 
     // Init some (easy) parameters, the rest was null initiated before by my caller
     functionSignature.addr                          = fctVersion.address();
@@ -403,7 +409,7 @@ void VectorSignAlgo::SetFunctionFields(const HVersion& fctVersion, FunctionSigna
         function_data.cfg.bb_nb++;
 
         // Add the size of current BB for the size dispersion
-        bbSizeVector.push_back((int) fctSonVersion.size());
+        bbSizeMoments.Add((int) fctSonVersion.size());
 
         // We suppose that this is a return BB, if we find him a son, we will set that to false
         // We also suppose that it has no son. If it has one and I found an other, it will be a jcc block.
@@ -457,9 +463,7 @@ void VectorSignAlgo::SetFunctionFields(const HVersion& fctVersion, FunctionSigna
 
     // Calculate size_disp
     double mean_size = function_data.cfg.size / function_data.cfg.bb_nb;
-    for (int i : bbSizeVector)
-        function_data.cfg.size_disp += std::pow(i - mean_size, 2);
-    function_data.cfg.size_disp /= function_data.cfg.bb_nb;
+    function_data.cfg.size_disp = bbSizeMoments.Variance(mean_size);
 }
 
 
@@ -588,192 +592,151 @@ void VectorSignAlgo::CalculateAllFunctionDistanceToRoot(FunctionSignatureMap_t&
 }
 
 
-void VectorSignAlgo::PrintFunctionSignature(std::ostream& dst, const FunctionSignature_t& functionSignature, bool is_first_line, std::vector<std::string>* pconcatenated_string)
+// Prefixes of each FunctionData_FIELD_COUNT block of the concatenated features
+const char* const g_concatenated_prefixes[] =
 {
+    "",
+    "father_median_",
+    "father_mean_",
+    "father_disp_",
+    "child_median_",
+    "child_mean_",
+    "child_disp_",
+};
+const size_t CONCATENATED_FIELD_COUNT = COUNT_OF(g_concatenated_prefixes) * FunctionData_FIELD_COUNT;
 
+void VectorSignAlgo::PrintFunctionSignature(std::ostream& dst, const FunctionSignature_t& functionSignature, const yadiff::FeatureMatrix_t& features)
+{
     // 0: Name of the function
-    if (is_first_line)
-        dst << "#Name: ";
-    else
-        dst << functionSignature.name.value << ": ";
+    dst << functionSignature.name.value << ": ";
 
     // 0.1 Addr of the function
-    if (is_first_line)
-        dst << "addr, ";
-    else
-        dst << "0x" << std::hex << functionSignature.addr << ", ";
+    dst << "0x" << std::hex << functionSignature.addr << ", ";
 
     // 2: Global Scalars
-    if (is_first_line)
+    const double* row = features.Row(functionSignature.row);
+    for (size_t i = 0; i < features.Cols(); i++)
     {
-        for (std::string s : *pconcatenated_string)
-        {
-            dst << s << ",";
-        }
-    }
-    else
-    {
-        for (double d : functionSignature.concatenated_vector)
-        {
-            dst << d << ",";
-        }
+        dst << row[i] << ",";
     }
 
     dst << std::endl;
 }
 
-void CreateConcatenatedString(std::vector<std::string>* concatenated_string);
-void VectorSignAlgo::PrintFunctionSignatureMap(const FunctionSignatureMap_t& functionSignatureMap)
+void VectorSignAlgo::PrintFunctionSignatureMap(const VectorSignDatabase& database)
 {
     std::ofstream output;
-    FunctionSignature_t function_signature;
-    std::vector<std::string> concatenated_string;
-
-    CreateConcatenatedString(&concatenated_string);
 
     output.open(config_.VectorSign.mapDestination);
 
-    PrintFunctionSignature(output, function_signature, true, &concatenated_string);
+    // Header, names come from the static schema
+    const auto& names = yadiff::GetFeatureSchema().names;
+    output << "#Name: addr, ";
+    for (const auto prefix : g_concatenated_prefixes)
+    {
+        for (const auto& name : names)
+        {
+            output << prefix << name << ",";
+        }
+    }
+    output << std::endl;
 
-    for (const auto& it : functionSignatureMap)
+    for (const auto& it : database.functionSignatureMap)
     {
-        PrintFunctionSignature(output, it.second, false, NULL);
+        PrintFunctionSignature(output, it.second, database.concatenated_features);
     }
 }
 
-// return matrix_col[col][line] = matrix_line[line][col]
-yadiff::Matrix InvertMatrix(yadiff::Matrix matrix_line)
+/*@brief :  Write median, mean & dispersion of the family features
+* @param :  <dst>       Output row, median at dst, mean at dst + N, disp at dst + 2 * N
+*           <family>    Rows of the family members in features
+*           <column>    Scratch buffer
+* @remark:  A function without family has null statistics
+*/
+void SetFamilyFeatures(double* dst, const yadiff::FeatureMatrix_t& features, const std::vector<size_t>& family, yadiff::Vector& column)
 {
-    yadiff::Matrix matrix_col = yadiff::Matrix();
-    // TODO escape if null
-
-    // Create a vector for each col
-    int line_size = static_cast<int>(matrix_line[0].size());
-    int col_size = static_cast<int>(matrix_line.size());
-    for (auto& coord1 : matrix_line[0])
+    if (family.empty())
     {
-        UNUSED(coord1);
-        matrix_col.push_back(yadiff::Vector(col_size, 0));
+        return;
     }
 
-    // Fill
-    for (int line = 0; line < line_size; line++)
+    column.resize(family.size());
+    for (size_t col = 0; col < FunctionData_FIELD_COUNT; col++)
     {
-        for (int col = 0; col < col_size; col++)
+        yadiff::Moments_t<double> moments;
+        for (size_t i = 0; i < family.size(); i++)
         {
-            matrix_col[line][col] = matrix_line[col][line];
+            column[i] = features.Row(family[i])[col];
+            moments.Add(column[i]);
         }
-    }
-
-    return matrix_col;
-}
 
+        const double mean = moments.Mean();
+        dst[FunctionData_FIELD_COUNT + col] = mean;
+        dst[2 * FunctionData_FIELD_COUNT + col] = std::sqrt(moments.Variance(mean));
 
-void ConcatenateFamilly(FunctionSignature_t& function_signature,
-    yadiff::Matrix& matrix_line)
-{
-    int size = static_cast<int>(function_signature.vector.size());
-
-    // 1.15: If I have no parents make a null
-    // TODO make an other branch ?,
-    if (matrix_line.size() == 0)
-    {
-        matrix_line.push_back(yadiff::Vector(size, 0));
+        // Don't fully sort, last as it reorders column
+        const size_t n = column.size() / 2;
+        std::nth_element(column.begin(), column.begin() + n, column.end());
+        dst[col] = column[n];
     }
+}
 
-    std::vector<double> mean = std::vector<double>();
-    mean.reserve(size);
-    std::vector<double> median = std::vector<double>();
-    median.reserve(size);
-    std::vector<double> disp = std::vector<double>();
-    disp.reserve(size);
-
-    // 1.2: Invert matrix
-    yadiff::Matrix matrix_col = InvertMatrix(matrix_line);
-
-    // 1.3: Fill median mean, disp vectors
-    for (const yadiff::Vector col_vector : matrix_col)
+void GetFamilyRows(std::vector<size_t>& rows, const FunctionSignatureMap_t& functionSignatureMap, const std::vector<YaToolObjectId>& family)
+{
+    rows.clear();
+    for (const auto& id : family)
     {
-        median.push_back(yadiff::GetMedian(col_vector));
-        double coordinate_mean = yadiff::GetMean(col_vector);
-        mean.push_back(coordinate_mean);
-        disp.push_back(yadiff::GetVariance(col_vector, coordinate_mean));
+        const auto it = functionSignatureMap.find(id);
+        if (it != functionSignatureMap.end())
+            rows.push_back(it->second.row);
     }
-
-    // 1.4 Concatenate
-    function_signature.concatenated_vector.insert(function_signature.concatenated_vector.end(),
-        median.begin(), median.end());
-    function_signature.concatenated_vector.insert(function_signature.concatenated_vector.end(),
-        mean.begin(), mean.end());
-    function_signature.concatenated_vector.insert(function_signature.concatenated_vector.end(),
-        disp.begin(), disp.end());
 }
 
-
-void CreateConcatenatedVector(FunctionSignatureMap_t& functionSignatureMap)
+void CreateConcatenatedVector(VectorSignDatabase& database, yadiff::MemoryBudget* budget)
 {
-    // Get all vector
+    auto& functionSignatureMap = database.functionSignatureMap;
+    const auto function_count = functionSignatureMap.size();
+
+    // Get all vector, directly in their row
+    database.features.Reset(function_count, FunctionData_FIELD_COUNT, budget);
+    size_t row = 0;
     for (auto& it : functionSignatureMap)
     {
         FunctionSignature_t& function_signature = it.second;
-        function_signature.vector = FunctionData2Vector(function_signature.function_data, NULL, "");
+        function_signature.row = row++;
+        yadiff::FunctionData2Row(database.features.Row(function_signature.row), function_signature.function_data);
     }
 
     // For all function
-    for (auto& it: functionSignatureMap)
+    database.concatenated_features.Reset(function_count, CONCATENATED_FIELD_COUNT, budget);
+    std::vector<size_t> family;
+    yadiff::Vector column;
+    for (const auto& it : functionSignatureMap)
     {
-        FunctionSignature_t& function_signature = it.second;
+        const FunctionSignature_t& function_signature = it.second;
+        const double* src = database.features.Row(function_signature.row);
+        double* dst = database.concatenated_features.Row(function_signature.row);
 
         // 0: Me
-        function_signature.concatenated_vector = function_signature.vector;
+        std::copy(src, src + FunctionData_FIELD_COUNT, dst);
+        dst += FunctionData_FIELD_COUNT;
 
         // 1: Father
-        // 1.1: Get matrix
-        yadiff::Matrix matrix_line = std::vector<std::vector<double>>();
-        for (auto& parent_id : function_signature.parents)
-        {
-            std::vector<double> parent_vector = functionSignatureMap[parent_id].vector;
-            matrix_line.push_back(parent_vector);
-        }
-        // 1.2 Conc
-        ConcatenateFamilly(function_signature, matrix_line);
+        GetFamilyRows(family, functionSignatureMap, function_signature.parents);
+        SetFamilyFeatures(dst, database.features, family, column);
+        dst += 3 * FunctionData_FIELD_COUNT;
 
         // 2: Child
-        // 2.1: Get matrix
-        matrix_line = std::vector<std::vector<double>>();
-        for (auto& child_id : function_signature.children)
-        {
-            std::vector<double> child_vector = functionSignatureMap[child_id].vector;
-            matrix_line.push_back(child_vector);
-        }
-        // 2.2 Conc
-        ConcatenateFamilly(function_signature, matrix_line);
-
+        GetFamilyRows(family, functionSignatureMap, function_signature.children);
+        SetFamilyFeatures(dst, database.features, family, column);
     }
 }
 
 
-void CreateConcatenatedString(std::vector<std::string>* concatenated_string)
-{
-    yadiff::FunctionData_t null_function_data;
-
-    FunctionData2Vector(null_function_data, concatenated_string, "");
-    FunctionData2Vector(null_function_data, concatenated_string, "father_median_");
-    FunctionData2Vector(null_function_data, concatenated_string, "father_mean_");
-    FunctionData2Vector(null_function_data, concatenated_string, "father_disp_");
-    FunctionData2Vector(null_function_data, concatenated_string, "child_median_");
-    FunctionData2Vector(null_function_data, concatenated_string, "child_mean_");
-    FunctionData2Vector(null_function_data, concatenated_string, "child_disp_");
-}
-
-
-
-
-
-
-void VectorSignAlgo::CreateFunctionSignatureMap(FunctionSignatureMap_t& functionSignatureMap, const IModel& db, const yadiff::AlgoCfg& config)
+void VectorSignAlgo::CreateFunctionSignatureMap(VectorSignDatabase& database, const IModel& db, const yadiff::AlgoCfg& config)
 {
     yadiff::BinaryInfo_t binary_info = yadiff::BinaryInfo_t(db, config);
+    auto& functionSignatureMap = database.functionSignatureMap;
 
     // 1/ Create : For all functions : Create an entry in the signatureMap
     db.walk([&](const HVersion& fctVersion)
@@ -812,5 +775,7 @@ void VectorSignAlgo::CreateFunctionSignatureMap(FunctionSignatureMap_t& function
     CalculateAllFunctionDistanceToRoot(functionSignatureMap, db);
 
     // 4/ Father and Son
-    CreateConcatenatedVector(functionSignatureMap);
+    CreateConcatenatedVector(database, config.Budget);
+    if (config.Budget)
+        config.Budget->Log("vector sign");
 }
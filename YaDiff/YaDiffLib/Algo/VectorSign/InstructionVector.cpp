@@ -189,15 +189,17 @@ void yadiff::SetDisassemblyFields(
     }  
 
     // For all BB, fill the structures 
+    std::vector<uint8_t> scratch;
     fctVersion.walk_xrefs_from([&](offset_t /*offset2*/, operand_t /*operand2*/, const HVersion& bbVersion)
     {
         if (bbVersion.type() != OBJECT_TYPE_BASIC_BLOCK)
             return WALK_CONTINUE;
 
-        // 1.1 Disassemble blob
-        size_t bbAddr = static_cast<size_t>(bbVersion.address() - binary_info.text_address);
+        // 1.1 Disassemble bytes, straight from the code image when possible
         size_t bbSize = static_cast<size_t>(bbVersion.size());
-        const uint8_t* bbBlob = &(binary_info.blob[bbAddr]);
+        const uint8_t* bbBlob = binary_info.code.Read(bbVersion.address(), bbSize, scratch);
+        if (!bbBlob)
+            return WALK_CONTINUE;
         const auto bbInstructions = Disass(bbBlob, bbSize, binary_info);
 
         // 1.15 Increment inst number
@@ -213,11 +215,12 @@ void yadiff::SetDisassemblyFields(
     // For all inst type
     for (int i = 0; i < INST_TYPE_COUNT; i++)
     {
-        std::vector<int> fctInstVect;
+        Moments_t<int> perBBMoments;
+        int total = 0;
         auto& disassStruct = structVector[i];
         auto& instruction_data = function_data.insts[i];
 
-        // Create vector on BB coordinates : for all BB 
+        // Accumulate on BB coordinates : for all BB 
         for (const auto& it : disassStruct.bbFields)
         {
             int number_of_inst = 0;
@@ -229,13 +232,14 @@ void yadiff::SetDisassemblyFields(
                     number_of_inst++;
                 }
             }
-            fctInstVect.push_back(number_of_inst);
+            total += number_of_inst;
+            perBBMoments.Add(number_of_inst);
         }
 
         // Set the per BB statistic fieds.
-        instruction_data.total = std::accumulate(fctInstVect.begin(), fctInstVect.end(), 0);
+        instruction_data.total = total;
         instruction_data.mean_per_bb = instruction_data.total / function_data.cfg.bb_nb;
-        instruction_data.variance_per_bb = GetVariance(fctInstVect, instruction_data.mean_per_bb);
+        instruction_data.variance_per_bb = perBBMoments.Weight() ? sqrt(perBBMoments.Variance(instruction_data.mean_per_bb)) : DEFAULT_DOUBLE;
 
         // Set the per (min) distance (in inst) to root statistic fields
         const auto flattenFunctionInst = FlattenFuction(equiLevelMap,  disassStruct);
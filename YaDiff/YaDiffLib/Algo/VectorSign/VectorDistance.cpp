@@ -124,10 +124,17 @@ void PutVectorInTree(VectorTree_t& vectorTree, VectorGroups_t& vectorGroups, con
 
 
 double GetVectorDistance(const Vector& v1, const Vector& v2)
+{
+    return GetVectorDistance(v1.data(), v2.data(), v1.size());
+}
+
+
+// Works on FeatureMatrix_t rows
+double GetVectorDistance(const double* v1, const double* v2, size_t size)
 {
     double distance = 0;
 
-    for (size_t i = 0; i < v1.size(); i++)
+    for (size_t i = 0; i < size; i++)
     {
         distance += std::abs(v1[i] - v2[i]) / gUnityVector[i];
     }
@@ -25,6 +25,7 @@ void SetDichotomicBorder(const VectorSignatureSet_t& vectSet);
 void PutVectorInTree(VectorTree_t& vectorTree, VectorGroups_t& vectorGroups, const VectorSignatureSet_t& vectSet);
 
 double GetVectorDistance(const Vector& v1, const Vector& v2);
+double GetVectorDistance(const double* v1, const double* v2, size_t size);
 
 void GetClosestVectorIdNaive(uint64_t& idOut, double& closestDistanceOut, const Vector& vectToLocalize, const std::vector<uint64_t>& idInDatabase,  VectorSignatureSet_t& vectSet);
 
@@ -10,7 +10,7 @@ namespace yadiff
 
 /*@brief :  Get a distribution central moment (like in physics)
 * @param :  <doubleVector>   Ordered vector : the weight (number of instruction) at each instruction offset.
-*           <size>           Size of the output.
+*           <size>           Size of the output, moments above the 4th are null.
 * @return:  Central moment list
 * @remark:  Mean is the instruction offset, starts at 0
 */
@@ -19,50 +19,36 @@ Vector GetCentralMomentByte(const Vector& byteVector, size_t size)
     Vector res = Vector(size);
 
     // -1: Check input
-    if (byteVector.empty())
+    if (byteVector.empty() || !size)
     {
         return res;
     }
 
-    // 0: Get Weight
-    res[0] = 0;
+    // 0: Get weight, mean, variance, skew & kurt in one pass
+    Moments_t<double> moments;
     for (size_t i = 0; i < byteVector.size(); i++)
     {
-        res[0] += byteVector[i];
+        moments.Add(i + 0.5, byteVector[i]);
     }
+    res[0] = moments.Weight();
     if (res[0] == 0)
     {
         return res;
     }
-
-    // 1: Get Mean
-    for (size_t i = 0; i < byteVector.size(); i++)
+    if (size > 1)
     {
-        res[1] += byteVector[i] * (i + 0.5);
+        res[1] = moments.Mean();
     }
-    res[1] /= res[0];
 
-    // 2: Get Variance, skew, kurt
-    for (size_t i = 0; i < byteVector.size(); i++)
+    // 1: Root Variance, Skew, Kurt
+    for (size_t moment = 2; moment < std::min<size_t>(size, 5); moment++)
     {
-        for (size_t moment = 2; moment < size; moment++)
-        {
-            res[moment] += byteVector[i] * pow((i + 0.5) - res[1], moment);
-        }
-    }
-
-    // 3: Root Variance, Skew, Kurt
-    for (size_t moment = 2; moment < size; moment++)
-    {
-        // 3.1: Divide by mass (not null)
-        res[moment] /= res[0];
-
-        // 3.2: Root
-        double sign = 1 - 2 * std::signbit(res[moment]);
-        res[moment] = sign * pow(sign * res[moment], 1. / moment);
+        const double value = moments.Central(moment);
+        double sign = 1 - 2 * std::signbit(value);
+        res[moment] = sign * pow(sign * value, 1. / moment);
     }
 
-    // 4 : Normalize all for a 1 length vector
+    // 2 : Normalize all for a 1 length vector
     for (size_t i = 1; i < size; i++)
     {
         res[i] /= byteVector.size();
@@ -84,38 +70,6 @@ double GetMean(const Vector& doubleVector)
     return sum / doubleVector.size();
 }
 
-//
-double GetVariance(const Vector& doubleVector, double mean)
-{
-    // Check
-    if (doubleVector.empty())
-    {
-        return DEFAULT_DOUBLE;
-    }
-
-    double res = 0;
-    std::for_each(doubleVector.begin(), doubleVector.end(), [&](const double d) {
-        res += (d - mean) * (d - mean);
-    });
-    return sqrt(res / doubleVector.size());
-}
-
-// TODO template function to mutualize
-double GetVariance(const std::vector<int>& doubleVector, double mean)
-{
-    // Check
-    if (doubleVector.empty())
-    {
-        return DEFAULT_DOUBLE;
-    }
-
-    double res = 0;
-    std::for_each(doubleVector.begin(), doubleVector.end(), [&](const double d) {
-        res += (d - mean) * (d - mean);
-    });
-    return sqrt(res / doubleVector.size());
-}
-
 //
 double GetMedian(const Vector& doubleVector)
 {
@@ -4,6 +4,7 @@
 
 */
 #pragma once
+#include <math.h>
 #include <stddef.h>
 #include <vector>
 #include "VectorTypes.hpp"
@@ -13,11 +14,94 @@ namespace yadiff
 
 {
 
+/* MOMENTS
+    Streaming weighted central moments, up to the 4th order.
+    Values are added one at a time, in one pass, with numerically stable
+    updates (West, Terriberry & Pebay): there is no need to know the mean first.
+*/
+template<typename T>
+class Moments_t
+{
+public:
+    /*@brief :  Add value with weight, null weights are ignored
+    */
+    void Add(T value, double weight = 1)
+    {
+        if (weight == 0)
+            return;
+
+        const double w      = weight_;
+        const double n      = w + weight;
+        const double delta  = static_cast<double>(value) - mean_;
+        const double ratio  = delta * weight / n;
+        const double term   = delta * ratio * w;
+
+        // update higher orders first, they need previous lower orders
+        m4_   += term * ratio * ratio * (w * w - w * weight + weight * weight) / (weight * weight)
+               + 6 * ratio * ratio * m2_ - 4 * ratio * m3_;
+        m3_   += term * ratio * (w - weight) / weight - 3 * ratio * m2_;
+        m2_   += term;
+        mean_ += ratio;
+        weight_ = n;
+    }
+
+    double Weight() const { return weight_; }
+    double Mean() const { return mean_; }
+
+    /*@brief :  Get the k-th central moment, divided by the total weight
+    * @param :  <k> moment order, in [2, 4]
+    */
+    double Central(size_t k) const
+    {
+        if (weight_ == 0)
+            return 0;
+        switch (k)
+        {
+            case 2:     return m2_ / weight_;
+            case 3:     return m3_ / weight_;
+            case 4:     return m4_ / weight_;
+            default:    return 0;
+        }
+    }
+
+    /*@brief :  Get the mean squared deviation around any point
+    */
+    double Variance(double around) const
+    {
+        if (weight_ == 0)
+            return 0;
+        const double shift = mean_ - around;
+        return m2_ / weight_ + shift * shift;
+    }
+
+private:
+    double weight_  = 0;
+    double mean_    = 0;
+    double m2_      = 0;
+    double m3_      = 0;
+    double m4_      = 0;
+};
+
 Vector GetCentralMomentByte(const Vector& byteVector, size_t size);
 double GetMedian(const Vector& doubleVector);
 double GetMean(const Vector& doubleVector);
-double GetVariance(const Vector& doubleVector, double mean);
-double GetVariance(const std::vector<int>& doubleVector, double mean);
+
+/*@brief :  Get the root mean squared deviation of values around mean
+*/
+template<typename T>
+double GetVariance(const std::vector<T>& values, double mean)
+{
+    // Check
+    if (values.empty())
+    {
+        return DEFAULT_DOUBLE;
+    }
+
+    Moments_t<T> moments;
+    for (const auto& value : values)
+        moments.Add(value);
+    return sqrt(moments.Variance(mean));
+}
 
 
 } // End namespace yadiff
\ No newline at end of file
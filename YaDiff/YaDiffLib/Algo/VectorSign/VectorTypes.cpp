@@ -8,99 +8,148 @@
 #include "Helpers.h"
 
 
+#include <algorithm>
 #include <assert.h>
 #include <memory>
+#include <stdlib.h>
+#include <string.h>
 
 namespace yadiff
 {
 
-void TryPush(std::vector<std::string>* s_vector, std::string string)
+namespace
 {
-    // TODO make it a macor : too slow
-    if (s_vector != NULL)
+#define CFG_FIELD(NAME, KIND)  {#NAME, offsetof(FunctionData_t, cfg) + offsetof(FunctionControlFlowGraphData_t, NAME), KIND}
+#define CG_FIELD(NAME, KIND)   {#NAME, offsetof(FunctionData_t, cg) + offsetof(FunctionCallGraphData_t, NAME), KIND}
+#define INST_FIELD(NAME, KIND) {#NAME, offsetof(InstructionData_t, NAME), KIND}
+
+// Control Flow Graph
+const FeatureField_t g_cfg_fields[] =
+{
+    CFG_FIELD(bb_nb,        FEATURE_KIND_INT),      // 1
+    CFG_FIELD(edge_nb,      FEATURE_KIND_INT),      // 2
+    CFG_FIELD(ret_nb,       FEATURE_KIND_INT),      // 3
+    CFG_FIELD(inst_nb,      FEATURE_KIND_INT),      // 4
+    CFG_FIELD(jcc_nb,       FEATURE_KIND_INT),      // 5
+    CFG_FIELD(back_edge_nb, FEATURE_KIND_INT),      // 6
+    CFG_FIELD(diamond_nb,   FEATURE_KIND_INT),      // 7
+    CFG_FIELD(size,         FEATURE_KIND_INT),      // 8
+    CFG_FIELD(size_disp,    FEATURE_KIND_DOUBLE),   // 9
+    CFG_FIELD(height,       FEATURE_KIND_INT),      // 10
+    CFG_FIELD(height_disp,  FEATURE_KIND_DOUBLE),   // 11
+    CFG_FIELD(width,        FEATURE_KIND_INT),      // 12
+    CFG_FIELD(width_disp,   FEATURE_KIND_DOUBLE),   // 13
+    CFG_FIELD(flat_len,     FEATURE_KIND_INT),      // 14
+};
+static_assert(COUNT_OF(g_cfg_fields) == FunctionControlFlowGraphData_FIELD_COUNT, "invalid cfg schema");
+
+// Call Graph
+const FeatureField_t g_cg_fields[] =
+{
+    CG_FIELD(in_degree,     FEATURE_KIND_INT),      // 1
+    CG_FIELD(out_degree,    FEATURE_KIND_INT),      // 2
+    CG_FIELD(dist_to_root,  FEATURE_KIND_INT),      // 3
+    CG_FIELD(dist_to_leave, FEATURE_KIND_INT),      // 4
+    CG_FIELD(arg_nb,        FEATURE_KIND_INT),      // 5
+    CG_FIELD(lib_nb,        FEATURE_KIND_INT),      // 6
+};
+static_assert(COUNT_OF(g_cg_fields) == FunctionCallGraphData_FIELD_COUNT, "invalid cg schema");
+
+// Instruction Distribution, offsets are relative to each InstructionData_t
+const FeatureField_t g_inst_fields[] =
+{
+    INST_FIELD(total,                       FEATURE_KIND_INT),      // 1
+    INST_FIELD(mean_per_bb,                 FEATURE_KIND_DOUBLE),   // 2
+    INST_FIELD(variance_per_bb,             FEATURE_KIND_DOUBLE),   // 3
+    INST_FIELD(offset_mean_per_inst,        FEATURE_KIND_DOUBLE),   // 4
+    INST_FIELD(offset_variance_per_inst,    FEATURE_KIND_DOUBLE),   // 5
+    INST_FIELD(offset_skew_per_inst,        FEATURE_KIND_DOUBLE),   // 6
+    INST_FIELD(offset_kurt_per_inst,        FEATURE_KIND_DOUBLE),   // 7
+};
+static_assert(COUNT_OF(g_inst_fields) == InstructionData_FIELD_COUNT, "invalid inst schema");
+
+#undef CFG_FIELD
+#undef CG_FIELD
+#undef INST_FIELD
+
+// Names are stored in the schema itself, so it must be filled in place
+bool InitFeatureSchema(FeatureSchema_t& schema)
+{
+    size_t i = 0;
+    for (const auto& field : g_cfg_fields)
+    {
+        schema.fields[i] = field;
+        schema.names[i++] = field.name;
+    }
+    for (const auto& field : g_cg_fields)
     {
-        s_vector->push_back(string);
+        schema.fields[i] = field;
+        schema.names[i++] = field.name;
     }
+    for (int type = 0; type < INST_TYPE_COUNT; type++)
+    {
+        const auto inst_type = static_cast<InstructionType_e>(type);
+        const auto inst_offset = offsetof(FunctionData_t, insts) + type * sizeof(InstructionData_t);
+        for (const auto& field : g_inst_fields)
+        {
+            schema.names[i] = std::string("inst_") + InstTypeToString(inst_type) + "_" + field.name;
+            schema.fields[i] = field;
+            schema.fields[i].name = schema.names[i].data();
+            schema.fields[i].offset += inst_offset;
+            i++;
+        }
+    }
+    assert(i == FunctionData_FIELD_COUNT);
+    return true;
 }
 
-std::vector<double> FunctionData2Vector(const FunctionData_t& function_data,
-    std::vector<std::string>* s_vector, std::string s_base)
-{
-    std::vector<double> res = std::vector<double>();
-
-
-    // Control Flow Graph
-    res.push_back(static_cast<double>(function_data.cfg.bb_nb));            // 1
-    TryPush(s_vector, s_base + "bb_nb");
-    res.push_back(static_cast<double>(function_data.cfg.edge_nb));          // 2
-    TryPush(s_vector, s_base + "edge_nb");
-    res.push_back(static_cast<double>(function_data.cfg.ret_nb));           // 3
-    TryPush(s_vector, s_base + "ret_nb");
-    res.push_back(static_cast<double>(function_data.cfg.inst_nb));          // 4
-	TryPush(s_vector, s_base + "inst_nb");
-    res.push_back(static_cast<double>(function_data.cfg.jcc_nb));           // 5
-	TryPush(s_vector, s_base + "jcc_nb");
-    res.push_back(static_cast<double>(function_data.cfg.back_edge_nb));     // 6
-	TryPush(s_vector, s_base + "back_edge_nb");
-    res.push_back(static_cast<double>(function_data.cfg.diamond_nb));       // 7
-	TryPush(s_vector, s_base + "diamond_nb");
-    res.push_back(static_cast<double>(function_data.cfg.size));             // 8
-	TryPush(s_vector, s_base + "size");
-    res.push_back(static_cast<double>(function_data.cfg.size_disp));        // 9
-	TryPush(s_vector, s_base + "size_disp");
-    res.push_back(static_cast<double>(function_data.cfg.height));           // 10
-	TryPush(s_vector, s_base + "height");
-    res.push_back(static_cast<double>(function_data.cfg.height_disp));      // 11
-	TryPush(s_vector, s_base + "height_disp");
-    res.push_back(static_cast<double>(function_data.cfg.width));            // 12
-	TryPush(s_vector, s_base + "width");
-    res.push_back(static_cast<double>(function_data.cfg.width_disp));       // 13
-	TryPush(s_vector, s_base + "width_disp");
-    res.push_back(static_cast<double>(function_data.cfg.flat_len));         // 14
-	TryPush(s_vector, s_base + "flat_len");
-
-    // Call Graph
-    res.push_back(static_cast<double>(function_data.cg.in_degree));         // 1
-	TryPush(s_vector, s_base + "in_degree");
-    res.push_back(static_cast<double>(function_data.cg.out_degree));        // 2
-	TryPush(s_vector, s_base + "out_degree");
-    res.push_back(static_cast<double>(function_data.cg.dist_to_root));      // 3
-	TryPush(s_vector, s_base + "dist_to_root");
-    res.push_back(static_cast<double>(function_data.cg.dist_to_leave));     // 4
-	TryPush(s_vector, s_base + "dist_to_leave");
-    res.push_back(static_cast<double>(function_data.cg.arg_nb));            // 5
-	TryPush(s_vector, s_base + "arg_nb");
-    res.push_back(static_cast<double>(function_data.cg.lib_nb));            // 6
-	TryPush(s_vector, s_base + "lib_nb");
-
-    // Instruction Distribution
-    for (int i = 0; i < INST_TYPE_COUNT; i++)
-    {
-        InstructionType_e inst_type = static_cast<InstructionType_e>(i);
-        InstructionData_t instruction_data = function_data.insts[(InstructionType_e)i];
-        res.push_back(static_cast<double>(instruction_data.total));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_total");
-        res.push_back(static_cast<double>(instruction_data.mean_per_bb));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_mean_per_bb");
-        res.push_back(static_cast<double>(instruction_data.variance_per_bb));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_variance_per_bb");
-        res.push_back(static_cast<double>(instruction_data.offset_mean_per_inst));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_offset_mean_per_inst");
-        res.push_back(static_cast<double>(instruction_data.offset_variance_per_inst));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_offset_variance_per_inst");
-        res.push_back(static_cast<double>(instruction_data.offset_skew_per_inst));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_offset_skew_per_inst");
-        res.push_back(static_cast<double>(instruction_data.offset_kurt_per_inst));
-		TryPush(s_vector, s_base + "inst_" + InstTypeToString(inst_type) + "_offset_kurt_per_inst");
+// Rows are padded to a multiple of a cache line
+const size_t CACHE_LINE_SIZE = 64;
+const size_t ROW_ALIGN = CACHE_LINE_SIZE / sizeof(double);
+}
+
+const FeatureSchema_t& GetFeatureSchema()
+{
+    static FeatureSchema_t schema;
+    static const bool ready = InitFeatureSchema(schema);
+    UNUSED(ready);
+    return schema;
+}
+
+void FunctionData2Row(double* row, const FunctionData_t& function_data)
+{
+    const auto& fields = GetFeatureSchema().fields;
+    const auto base = reinterpret_cast<const uint8_t*>(&function_data);
+    for (size_t i = 0; i < FunctionData_FIELD_COUNT; i++)
+    {
+        const auto& field = fields[i];
+        if (field.kind == FEATURE_KIND_INT)
+            row[i] = static_cast<double>(*reinterpret_cast<const int*>(base + field.offset));
+        else
+            row[i] = *reinterpret_cast<const double*>(base + field.offset);
     }
+}
 
 
-    // Check Size
-    assert(res.size() == FunctionControlFlowGraphData_FIELD_COUNT
-             + FunctionCallGraphData_FIELD_COUNT
-             + INST_TYPE_COUNT * InstructionData_FIELD_COUNT);
+FeatureMatrix_t::FeatureMatrix_t()
+    : base_  (nullptr)
+    , rows_  (0)
+    , cols_  (0)
+    , stride_(0)
+{
+}
 
-    return res;
+void FeatureMatrix_t::Reset(size_t rows, size_t cols, MemoryBudget* budget)
+{
+    rows_   = rows;
+    cols_   = cols;
+    stride_ = (cols + ROW_ALIGN - 1) & ~(ROW_ALIGN - 1);
+
+    // Over-allocate one cache line to align the first row
+    buffer_.Reset((rows_ * stride_ + ROW_ALIGN) * sizeof(double), budget);
+    auto ptr = reinterpret_cast<uintptr_t>(buffer_.Data());
+    ptr = (ptr + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    base_ = reinterpret_cast<double*>(ptr);
 }
 
 
@@ -111,39 +160,103 @@ DECLARE_REF(g_format, "format");
 
 
 
-void SetBlobText(yadiff::BinaryInfo_t& binary_info, const IModel& db)
+DECLARE_REF(g_perm, "perm");
+DECLARE_REF(g_type, "type");
+
+
+namespace
+{
+// see IDA segment_t::perm & segment_t::type
+const int SEGPERM_EXEC = 1;
+const int SEG_CODE = 2;
+
+bool IsExecutableSegment(const HVersion& segment)
+{
+    int perm = 0;
+    int type = 0;
+    segment.walk_attributes([&](const const_string_ref& key, const const_string_ref& val)
+    {
+        if(key == g_perm)
+            perm = atoi(make_string(val).data());
+        else if(key == g_type)
+            type = atoi(make_string(val).data());
+        return WALK_CONTINUE;
+    });
+
+    // perm is zero when unknown
+    return perm ? !!(perm & SEGPERM_EXEC) : type == SEG_CODE;
+}
+}
+
+
+void CodeImage_t::Add(offset_t address, const uint8_t* data, size_t size)
 {
-    std::vector<uint8_t> vector_1000;
+    if(!size)
+        return;
+    pieces_.push_back({address, data, size});
+    size_ += size;
+}
+
+void CodeImage_t::Finish()
+{
+    std::sort(pieces_.begin(), pieces_.end(), [](const Piece_t& a, const Piece_t& b)
+    {
+        return a.address < b.address;
+    });
+}
 
-    // Get the .text segment
+const uint8_t* CodeImage_t::Read(offset_t address, size_t size, std::vector<uint8_t>& scratch) const
+{
+    const auto end = address + size;
+
+    // first piece ending after address
+    auto it = std::upper_bound(pieces_.begin(), pieces_.end(), address, [](offset_t ea, const Piece_t& piece)
+    {
+        return ea < piece.address + piece.size;
+    });
+    if(it == pieces_.end() || it->address >= end)
+        return nullptr;
+
+    if(it->address <= address && end <= it->address + it->size)
+        return it->data + (address - it->address);
+
+    scratch.assign(size, 0);
+    for(; it != pieces_.end() && it->address < end; ++it)
+    {
+        const auto from = std::max(address, it->address);
+        const auto to = std::min(end, it->address + it->size);
+        memcpy(&scratch[from - address], it->data + (from - it->address), to - from);
+    }
+    return &scratch[0];
+}
+
+
+void SetCodeImage(CodeImage_t& image, const IModel& db)
+{
     db.walk([&](const HVersion& segmentVersion)
     {
-        if (segmentVersion.type() != OBJECT_TYPE_SEGMENT)
+        if(segmentVersion.type() != OBJECT_TYPE_SEGMENT)
             return WALK_CONTINUE;
 
-        std::string segmentName = make_string(segmentVersion.username());
-        if (segmentName.find(".text") == std::string::npos)
+        if(!IsExecutableSegment(segmentVersion))
             return WALK_CONTINUE;
 
-        binary_info.text_address = segmentVersion.address();
         segmentVersion.walk_xrefs_from([&](offset_t /*offset*/, operand_t /*operand*/, const HVersion& chunkVersion)
         {
-            if (chunkVersion.type() != OBJECT_TYPE_SEGMENT_CHUNK)
+            if(chunkVersion.type() != OBJECT_TYPE_SEGMENT_CHUNK)
                 return WALK_CONTINUE;
 
-            //res.reserve(chunkVersion.get_size());
+            const auto chunk_address = chunkVersion.address();
             chunkVersion.walk_blobs([&](offset_t offset, const void* data, size_t len)
             {
-                UNUSED(offset);
-                const uint8_t* pi8Data = (const uint8_t*)data;
-                vector_1000 = std::vector<uint8_t>(pi8Data, pi8Data + len);
-                binary_info.blob.insert(binary_info.blob.end(), vector_1000.begin(), vector_1000.end());
+                image.Add(chunk_address + offset, static_cast<const uint8_t*>(data), len);
                 return WALK_CONTINUE;
             });
             return WALK_CONTINUE;
         });
         return WALK_CONTINUE;
     });
+    image.Finish();
 }
 
 
@@ -151,12 +264,13 @@ void SetBlobText(yadiff::BinaryInfo_t& binary_info, const IModel& db)
 */
 BinaryInfo_t::BinaryInfo_t(const IModel& db, const yadiff::AlgoCfg& /*config*/)
     : base_address(0)
-    , text_address(0)
     , h_capstone(0)
     , cs_error_val(CS_ERR_OK)
     , cs_arch_val(CS_ARCH_MAX)
     , cs_mode_val(CS_MODE_LITTLE_ENDIAN)
 {
+    format[0] = 0;
+
     // 1: Get architecture, base_addr from database
     db.walk([&](const HVersion& binaryVersion)
     {
@@ -175,8 +289,8 @@ BinaryInfo_t::BinaryInfo_t(const IModel& db, const yadiff::AlgoCfg& /*config*/)
         return WALK_CONTINUE;
     });
 
-    // 1.2: Set blob text
-    SetBlobText(*this, db);
+    // 1.2: Map code of every executable segment
+    SetCodeImage(code, db);
 
     // 2: Branch on arch
     if (strstr(format, "80386") != NULL)
@@ -7,6 +7,7 @@
 
 // Config, logger
 #include "../Algo.hpp"
+#include "MemoryBudget.hpp"
 
 #include <capstone/capstone.h>
 #include <memory>
@@ -81,6 +82,110 @@ struct FunctionData_t
     FunctionCallGraphData_t             cg;
     InstructionData_t                   insts[INST_TYPE_COUNT];
 };
+#define FunctionData_FIELD_COUNT (FunctionControlFlowGraphData_FIELD_COUNT \
+                                + FunctionCallGraphData_FIELD_COUNT \
+                                + yadiff::INST_TYPE_COUNT * InstructionData_FIELD_COUNT)
+
+
+// Static feature schema : one entry per FunctionData_t scalar, in vector order
+enum FeatureKind_e
+{
+    FEATURE_KIND_INT,
+    FEATURE_KIND_DOUBLE,
+};
+
+struct FeatureField_t
+{
+    const char*     name;               // Feature name, without prefix
+    size_t          offset;             // Offset of the field in FunctionData_t
+    FeatureKind_e   kind;               // Type of the field in FunctionData_t
+};
+
+struct FeatureSchema_t
+{
+    FeatureField_t  fields[FunctionData_FIELD_COUNT];
+    std::string     names[FunctionData_FIELD_COUNT];
+};
+
+/*@brief :  Get the feature schema, names are materialized on first call only
+*/
+const FeatureSchema_t& GetFeatureSchema();
+
+/*@brief :  Write all function_data features to a FunctionData_FIELD_COUNT row
+*/
+void FunctionData2Row(double* row, const FunctionData_t& function_data);
+
+
+/* FEATURE MATRIX
+    Contiguous row-major matrix, one row per function.
+    Rows are padded to a cache line & the first row is cache line aligned.
+    The matrix spills to disk when it does not fit the memory budget.
+*/
+class FeatureMatrix_t
+{
+public:
+    FeatureMatrix_t();
+
+    // rows point into the owned buffer
+    FeatureMatrix_t(const FeatureMatrix_t&) = delete;
+    FeatureMatrix_t& operator=(const FeatureMatrix_t&) = delete;
+
+    void            Reset(size_t rows, size_t cols, MemoryBudget* budget = nullptr);
+    size_t          Rows() const { return rows_; }
+    size_t          Cols() const { return cols_; }
+    size_t          Stride() const { return stride_; }
+    double*         Row(size_t row) { return base_ + row * stride_; }
+    const double*   Row(size_t row) const { return base_ + row * stride_; }
+
+private:
+    SpillBuffer         buffer_;
+    double*             base_;
+    size_t              rows_;
+    size_t              cols_;
+    size_t              stride_;
+};
+
+
+/* CODE IMAGE
+    Sparse address-indexed view of the code bytes of a binary.
+    Pieces point directly into model blobs: the model must outlive the image.
+*/
+class CodeImage_t
+{
+public:
+    /*@brief :  Add bytes mapped at address, pieces must not overlap
+    */
+    void            Add(offset_t address, const uint8_t* data, size_t size);
+
+    /*@brief :  Sort pieces, must be called once after the last Add
+    */
+    void            Finish();
+
+    /*@brief :  Get size bytes mapped at address
+    * @return:  A pointer into the image when the range fits in one piece,
+    *           else a pointer to scratch filled with the mapped bytes (zero in holes),
+    *           or nullptr when no byte of the range is mapped
+    */
+    const uint8_t*  Read(offset_t address, size_t size, std::vector<uint8_t>& scratch) const;
+
+    size_t          Size() const { return size_; }
+    bool            Empty() const { return pieces_.empty(); }
+
+private:
+    struct Piece_t
+    {
+        offset_t        address;
+        const uint8_t*  data;
+        size_t          size;
+    };
+
+    std::vector<Piece_t>    pieces_;
+    size_t                  size_ = 0;
+};
+
+/*@brief :  Add every blob of every executable segment of db to image
+*/
+void SetCodeImage(CodeImage_t& image, const IModel& db);
 
 
 #define FORMAT_MAX_SIZE   256
@@ -88,9 +193,8 @@ class BinaryInfo_t
 {
 public:
     offset_t                                        base_address;
-    offset_t                                        text_address;
     char                                            format[FORMAT_MAX_SIZE+1];
-    std::vector<uint8_t>                            blob;
+    CodeImage_t                                     code;
     csh                                             h_capstone;
     cs_err                                          cs_error_val;
     cs_arch                                         cs_arch_val;
@@ -104,8 +208,5 @@ public:
 
 
 
-std::vector<double> FunctionData2Vector(const FunctionData_t& function_data,
-    std::vector<std::string>* s_vector, std::string s_base);
-
 
 } // End of namespace yadiff
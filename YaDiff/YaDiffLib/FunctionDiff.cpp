@@ -0,0 +1,552 @@
+#include "FunctionDiff.hpp"
+
+#include <Algo/Algo.hpp>
+#include <Algo/VectorSign/VectorTypes.hpp>
+#include "Relation.hpp"
+#include "Signature.hpp"
+#include "Parallel.hpp"
+#include "HVersion.hpp"
+#include "IModel.hpp"
+#include "Yatools.hpp"
+#include "Helpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("diff", (FMT), ## __VA_ARGS__)
+
+namespace yadiff
+{
+namespace
+{
+    // bigger blocks are aligned by position instead of longest common subsequence
+    const size_t MAX_LCS_CELLS = 1 << 20;
+
+    uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+    {
+        // fnv-1a
+        const auto bytes = static_cast<const uint8_t*>(data);
+        for(size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+        return hash;
+    }
+
+    const uint64_t HASH_SEED = 0xCBF29CE484222325ull;
+
+    struct Instruction
+    {
+        offset_t    address;
+        uint64_t    key;    // normalized mnemonic & operands
+    };
+
+    struct Block
+    {
+        HVersion                    version;
+        std::vector<Instruction>    instructions;
+        std::vector<size_t>         successors;
+        uint64_t                    key;
+    };
+
+    // one capstone handle per worker, handles are not thread-safe
+    struct Disassembler
+    {
+        Disassembler(const BinaryInfo_t& info)
+            : info_(info)
+            , handle_(0)
+            , ok_(false)
+        {
+            if(info.cs_error_val != CS_ERR_OK)
+                return;
+            ok_ = cs_open(info.cs_arch_val, info.cs_mode_val, &handle_) == CS_ERR_OK;
+            if(ok_)
+                cs_option(handle_, CS_OPT_DETAIL, CS_OPT_ON);
+        }
+
+        ~Disassembler()
+        {
+            if(ok_)
+                cs_close(&handle_);
+        }
+
+        bool is_address(offset_t value)
+        {
+            return !!info_.code.Read(value, 1, scratch_);
+        }
+
+        // replaces numbers with a placeholder when they hold an address:
+        // direct branch targets, pc-relative operands, xref targets
+        // & values inside the code image, other immediates are kept
+        std::string normalize(const cs_insn& insn, const std::vector<offset_t>& targets)
+        {
+            const auto ops = insn.op_str;
+            const auto size = strlen(ops);
+            const auto branch = cs_insn_group(handle_, &insn, CS_GRP_JUMP)
+                             || cs_insn_group(handle_, &insn, CS_GRP_CALL);
+
+            // split operands on top-level commas, arm memory operands contain commas
+            struct Operand
+            {
+                size_t  begin;
+                size_t  end;
+                bool    relative;
+            };
+            std::vector<Operand> operands;
+            int depth = 0;
+            size_t begin = 0;
+            for(size_t i = 0; i <= size; ++i)
+            {
+                const auto c = i < size ? ops[i] : ',';
+                if(c == '[' || c == '{')
+                    ++depth;
+                else if(c == ']' || c == '}')
+                    --depth;
+                if(c == ',' && depth <= 0)
+                {
+                    operands.push_back({begin, i, false});
+                    begin = i + 1;
+                }
+            }
+            for(auto& op : operands)
+                for(size_t i = op.begin; i < op.end && !op.relative;)
+                {
+                    if(!isalpha(static_cast<unsigned char>(ops[i])))
+                    {
+                        ++i;
+                        continue;
+                    }
+                    const auto token_begin = i;
+                    while(i < op.end && isalnum(static_cast<unsigned char>(ops[i])))
+                        ++i;
+                    const auto token = std::string(&ops[token_begin], i - token_begin);
+                    op.relative = token == "rip" || token == "eip" || token == "pc";
+                }
+            // direct branch target is the last operand, outside of any memory operand
+            if(branch && !operands.empty())
+            {
+                auto& last = operands.back();
+                last.relative |= std::find(&ops[last.begin], &ops[last.end], '[') == &ops[last.end];
+            }
+
+            std::string reply = insn.mnemonic;
+            reply += ' ';
+            size_t op_idx = 0;
+            for(size_t i = 0; i < size;)
+            {
+                while(op_idx + 1 < operands.size() && i >= operands[op_idx].end)
+                    ++op_idx;
+                const auto c = static_cast<unsigned char>(ops[i]);
+                if(isalpha(c) || c == '_')
+                {
+                    // registers may contain digits
+                    while(i < size && (isalnum(static_cast<unsigned char>(ops[i])) || ops[i] == '_'))
+                        reply += ops[i++];
+                    continue;
+                }
+                if(!isdigit(c))
+                {
+                    if(!isspace(c))
+                        reply += ops[i];
+                    ++i;
+                    continue;
+                }
+                char* end = nullptr;
+                const auto value = strtoull(&ops[i], &end, 0);
+                const auto next = static_cast<size_t>(end - ops);
+                const auto is_target = std::find(targets.begin(), targets.end(), value) != targets.end();
+                if(operands[op_idx].relative || is_target || is_address(value))
+                    reply += '$';
+                else
+                    reply.append(&ops[i], next - i);
+                i = next;
+            }
+            return reply;
+        }
+
+        std::vector<Instruction> disassemble(const HVersion& block)
+        {
+            std::vector<Instruction> instructions;
+            const auto address = block.address();
+            const auto size = static_cast<size_t>(block.size());
+            std::vector<uint8_t> bytes;
+            const auto data = ok_ && size ? info_.code.Read(address, size, bytes) : nullptr;
+            if(!data)
+            {
+                // without code, the stored block signature stands for all its instructions
+                uint64_t key = hash_bytes(HASH_SEED, &size, sizeof size);
+                block.walk_signatures([&](const HSignature& signature)
+                {
+                    const auto& sig = signature.get();
+                    key = hash_bytes(HASH_SEED, sig.buffer, sig.size);
+                    return WALK_STOP;
+                });
+                instructions.push_back({address, key});
+                return instructions;
+            }
+
+            std::multimap<offset_t, offset_t> xrefs;
+            block.walk_xrefs_from([&](offset_t offset, operand_t, const HVersion& target)
+            {
+                xrefs.emplace(offset, target.address());
+                return WALK_CONTINUE;
+            });
+
+            cs_insn* insns = nullptr;
+            const auto count = cs_disasm(handle_, data, size, address, 0, &insns);
+            for(size_t i = 0; i < count; ++i)
+            {
+                const auto& insn = insns[i];
+                targets_.clear();
+                const auto range = xrefs.equal_range(insn.address - address);
+                for(auto it = range.first; it != range.second; ++it)
+                    targets_.push_back(it->second);
+                const auto text = normalize(insn, targets_);
+                instructions.push_back({insn.address, hash_bytes(HASH_SEED, text.data(), text.size())});
+            }
+            if(count)
+                cs_free(insns, count);
+            return instructions;
+        }
+
+        const BinaryInfo_t&     info_;
+        csh                     handle_;
+        bool                    ok_;
+        std::vector<uint8_t>    scratch_;
+        std::vector<offset_t>   targets_;
+    };
+
+    std::vector<Block> get_blocks(Disassembler& disassembler, const HVersion& function)
+    {
+        std::vector<Block> blocks;
+        std::set<YaToolObjectId> seen;
+        function.walk_xrefs_from([&](offset_t, operand_t, const HVersion& block)
+        {
+            if(block.type() == OBJECT_TYPE_BASIC_BLOCK && seen.insert(block.id()).second)
+                blocks.push_back({block, {}, {}, 0});
+            return WALK_CONTINUE;
+        });
+        std::sort(blocks.begin(), blocks.end(), [](const Block& a, const Block& b)
+        {
+            return a.version.address() < b.version.address();
+        });
+
+        std::unordered_map<YaToolObjectId, size_t> indexes;
+        for(size_t i = 0; i < blocks.size(); ++i)
+            indexes.emplace(blocks[i].version.id(), i);
+        for(auto& block : blocks)
+        {
+            block.instructions = disassembler.disassemble(block.version);
+            block.key = HASH_SEED;
+            for(const auto& insn : block.instructions)
+                block.key = hash_bytes(block.key, &insn.key, sizeof insn.key);
+            block.version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& next)
+            {
+                const auto it = indexes.find(next.id());
+                if(it != indexes.end())
+                    block.successors.push_back(it->second);
+                return WALK_CONTINUE;
+            });
+            // successors are ordered by address, which follows code layout
+            std::sort(block.successors.begin(), block.successors.end());
+            block.successors.erase(std::unique(block.successors.begin(), block.successors.end()), block.successors.end());
+        }
+        return blocks;
+    }
+
+    typedef std::unordered_map<YaToolObjectId, YaToolObjectId> BlockRelations;
+
+    // pairs blocks with existing relations, then entry blocks, then walks
+    // the CFG from paired blocks, pairing successors when both sides agree
+    // on their count, & finally pairs leftover blocks with unique contents
+    std::vector<int> align_blocks(const std::vector<Block>& blocks1, const std::vector<Block>& blocks2, const HVersion& function1, const HVersion& function2, const BlockRelations& relations)
+    {
+        std::vector<int> match1(blocks1.size(), -1);
+        std::vector<int> match2(blocks2.size(), -1);
+        std::deque<std::pair<size_t, size_t>> todo;
+        const auto pair = [&](size_t i, size_t j)
+        {
+            if(match1[i] >= 0 || match2[j] >= 0)
+                return;
+            match1[i] = static_cast<int>(j);
+            match2[j] = static_cast<int>(i);
+            todo.emplace_back(i, j);
+        };
+
+        std::unordered_map<YaToolObjectId, size_t> indexes2;
+        for(size_t j = 0; j < blocks2.size(); ++j)
+            indexes2.emplace(blocks2[j].version.id(), j);
+        for(size_t i = 0; i < blocks1.size(); ++i)
+        {
+            const auto rel = relations.find(blocks1[i].version.id());
+            if(rel == relations.end())
+                continue;
+            const auto it = indexes2.find(rel->second);
+            if(it != indexes2.end())
+                pair(i, it->second);
+        }
+
+        const auto get_entry = [](const std::vector<Block>& blocks, const HVersion& function)
+        {
+            for(size_t i = 0; i < blocks.size(); ++i)
+                if(blocks[i].version.address() == function.address())
+                    return static_cast<int>(i);
+            return -1;
+        };
+        const auto entry1 = get_entry(blocks1, function1);
+        const auto entry2 = get_entry(blocks2, function2);
+        if(entry1 >= 0 && entry2 >= 0)
+            pair(entry1, entry2);
+
+        while(!todo.empty())
+        {
+            const auto it = todo.front();
+            todo.pop_front();
+            const auto& next1 = blocks1[it.first].successors;
+            const auto& next2 = blocks2[it.second].successors;
+            if(next1.size() != next2.size())
+                continue;
+            for(size_t k = 0; k < next1.size(); ++k)
+                pair(next1[k], next2[k]);
+        }
+
+        std::unordered_map<uint64_t, std::pair<int, int>> keys;
+        for(size_t i = 0; i < blocks1.size(); ++i)
+            if(match1[i] < 0)
+            {
+                auto& key = keys.emplace(blocks1[i].key, std::make_pair(0, 0)).first->second;
+                key.first = key.first ? -1 : static_cast<int>(i) + 1;
+            }
+        for(size_t j = 0; j < blocks2.size(); ++j)
+            if(match2[j] < 0)
+            {
+                const auto it = keys.find(blocks2[j].key);
+                if(it != keys.end())
+                    it->second.second = it->second.second ? -1 : static_cast<int>(j) + 1;
+            }
+        for(size_t i = 0; i < blocks1.size(); ++i)
+        {
+            if(match1[i] >= 0)
+                continue;
+            const auto& key = keys[blocks1[i].key];
+            if(key.first > 0 && key.second > 0)
+                pair(key.first - 1, key.second - 1);
+        }
+        return match1;
+    }
+
+    enum Op_e
+    {
+        OP_SAME,
+        OP_REMOVED,
+        OP_ADDED,
+    };
+
+    std::vector<Op_e> get_script(const std::vector<Instruction>& a, const std::vector<Instruction>& b)
+    {
+        std::vector<Op_e> ops;
+        const auto n = a.size();
+        const auto m = b.size();
+        if((n + 1) * (m + 1) > MAX_LCS_CELLS)
+        {
+            for(size_t i = 0; i < std::max(n, m); ++i)
+            {
+                if(i < n && i < m && a[i].key == b[i].key)
+                {
+                    ops.push_back(OP_SAME);
+                    continue;
+                }
+                if(i < n)
+                    ops.push_back(OP_REMOVED);
+                if(i < m)
+                    ops.push_back(OP_ADDED);
+            }
+            return ops;
+        }
+
+        // lcs[i][j] is the longest common subsequence of a[i:] & b[j:]
+        std::vector<uint32_t> lcs((n + 1) * (m + 1));
+        const auto at = [&](size_t i, size_t j) -> uint32_t&
+        {
+            return lcs[i * (m + 1) + j];
+        };
+        for(size_t i = n; i-- > 0;)
+            for(size_t j = m; j-- > 0;)
+                at(i, j) = a[i].key == b[j].key ? at(i + 1, j + 1) + 1 : std::max(at(i + 1, j), at(i, j + 1));
+
+        size_t i = 0;
+        size_t j = 0;
+        while(i < n || j < m)
+        {
+            if(i < n && j < m && a[i].key == b[j].key)
+            {
+                ops.push_back(OP_SAME);
+                ++i, ++j;
+            }
+            else if(j == m || (i < n && at(i + 1, j) >= at(i, j + 1)))
+            {
+                ops.push_back(OP_REMOVED);
+                ++i;
+            }
+            else
+            {
+                ops.push_back(OP_ADDED);
+                ++j;
+            }
+        }
+        return ops;
+    }
+
+    // removed & added instructions between two common ones
+    // are paired as modified, in order
+    void diff_instructions(FunctionDiff& diff, BlockDiff& block, const std::vector<Instruction>& a, const std::vector<Instruction>& b)
+    {
+        const auto ops = get_script(a, b);
+        size_t i = 0;
+        size_t j = 0;
+        size_t k = 0;
+        while(k < ops.size())
+        {
+            if(ops[k] == OP_SAME)
+            {
+                ++block.same;
+                ++i, ++j, ++k;
+                continue;
+            }
+            std::vector<size_t> removed;
+            std::vector<size_t> added;
+            for(; k < ops.size() && ops[k] != OP_SAME; ++k)
+                if(ops[k] == OP_REMOVED)
+                    removed.push_back(i++);
+                else
+                    added.push_back(j++);
+            const auto common = std::min(removed.size(), added.size());
+            for(size_t x = 0; x < common; ++x)
+                diff.instructions.push_back({a[removed[x]].address, b[added[x]].address, CHANGE_MODIFIED});
+            for(size_t x = common; x < removed.size(); ++x)
+                diff.instructions.push_back({a[removed[x]].address, 0, CHANGE_REMOVED});
+            for(size_t x = common; x < added.size(); ++x)
+                diff.instructions.push_back({0, b[added[x]].address, CHANGE_ADDED});
+            block.modified += static_cast<uint32_t>(common);
+            block.removed += static_cast<uint32_t>(removed.size() - common);
+            block.added += static_cast<uint32_t>(added.size() - common);
+        }
+    }
+
+    void add_block(FunctionDiff& diff, const BlockDiff& block)
+    {
+        diff.same += block.same;
+        diff.modified += block.modified;
+        diff.added += block.added;
+        diff.removed += block.removed;
+        diff.blocks.push_back(block);
+    }
+
+    FunctionDiff diff_function(Disassembler& dis1, Disassembler& dis2, const HVersion& function1, const HVersion& function2, const BlockRelations& relations)
+    {
+        FunctionDiff diff;
+        diff.function1 = function1.id();
+        diff.function2 = function2.id();
+        diff.same = diff.modified = diff.added = diff.removed = 0;
+
+        const auto blocks1 = get_blocks(dis1, function1);
+        const auto blocks2 = get_blocks(dis2, function2);
+        const auto match = align_blocks(blocks1, blocks2, function1, function2, relations);
+        std::vector<bool> matched2(blocks2.size());
+        for(size_t i = 0; i < blocks1.size(); ++i)
+        {
+            BlockDiff block;
+            memset(&block, 0, sizeof block);
+            block.block1 = blocks1[i].version.id();
+            const auto& insns1 = blocks1[i].instructions;
+            if(match[i] < 0)
+            {
+                block.change = CHANGE_REMOVED;
+                block.removed = static_cast<uint32_t>(insns1.size());
+                for(const auto& insn : insns1)
+                    diff.instructions.push_back({insn.address, 0, CHANGE_REMOVED});
+                add_block(diff, block);
+                continue;
+            }
+            const auto& other = blocks2[match[i]];
+            matched2[match[i]] = true;
+            block.block2 = other.version.id();
+            diff_instructions(diff, block, insns1, other.instructions);
+            block.change = block.modified || block.added || block.removed ? CHANGE_MODIFIED : CHANGE_NONE;
+            add_block(diff, block);
+        }
+        for(size_t j = 0; j < blocks2.size(); ++j)
+        {
+            if(matched2[j])
+                continue;
+            BlockDiff block;
+            memset(&block, 0, sizeof block);
+            block.block2 = blocks2[j].version.id();
+            block.change = CHANGE_ADDED;
+            block.added = static_cast<uint32_t>(blocks2[j].instructions.size());
+            for(const auto& insn : blocks2[j].instructions)
+                diff.instructions.push_back({0, insn.address, CHANGE_ADDED});
+            add_block(diff, block);
+        }
+        return diff;
+    }
+
+    bool is_trusted(const Relation& relation)
+    {
+        return relation.type_ != RELATION_TYPE_NONE
+            && relation.type_ != RELATION_TYPE_UNTRUSTABLE;
+    }
+}
+
+std::vector<FunctionDiff> DiffFunctions(const IModel& db1, const IModel& db2, const std::vector<Relation>& relations)
+{
+    BlockRelations blocks;
+    std::vector<std::pair<HVersion, HVersion>> functions;
+    std::set<std::pair<YaToolObjectId, YaToolObjectId>> seen;
+    for(const auto& relation : relations)
+    {
+        if(!is_trusted(relation))
+            continue;
+        const auto type = relation.version1_.type();
+        if(type != relation.version2_.type())
+            continue;
+        if(type == OBJECT_TYPE_BASIC_BLOCK)
+            blocks.emplace(relation.version1_.id(), relation.version2_.id());
+        if(type == OBJECT_TYPE_FUNCTION && seen.emplace(relation.version1_.id(), relation.version2_.id()).second)
+            functions.emplace_back(relation.version1_, relation.version2_);
+    }
+    std::sort(functions.begin(), functions.end(), [](const auto& a, const auto& b)
+    {
+        return std::make_pair(a.first.id(), a.second.id()) < std::make_pair(b.first.id(), b.second.id());
+    });
+
+    AlgoCfg config;
+    memset(&config, 0, sizeof config);
+    const BinaryInfo_t info1(db1, config);
+    const BinaryInfo_t info2(db2, config);
+
+    // big functions are unevenly spread, workers pick pairs one by one
+    std::vector<FunctionDiff> diffs(functions.size());
+    std::atomic<size_t> next(0);
+    parallel::for_ranges(functions.size(), 1, [&](size_t, size_t, size_t)
+    {
+        Disassembler dis1(info1);
+        Disassembler dis2(info2);
+        for(auto i = next++; i < functions.size(); i = next++)
+            diffs[i] = diff_function(dis1, dis2, functions[i].first, functions[i].second, blocks);
+    });
+
+    size_t identical = 0;
+    for(const auto& diff : diffs)
+        identical += diff.is_identical();
+    LOG(INFO, "%zd function pairs diffed, %zd identical\n", diffs.size(), identical);
+    return diffs;
+}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <YaTypes.hpp>
+
+#include <vector>
+
+struct IModel;
+struct Relation;
+
+namespace yadiff
+{
+    enum Change_e
+    {
+        CHANGE_NONE,
+        CHANGE_MODIFIED,
+        CHANGE_ADDED,       // only in the second database
+        CHANGE_REMOVED,     // only in the first database
+    };
+
+    struct InstructionDiff
+    {
+        offset_t    address1;   // zero when added
+        offset_t    address2;   // zero when removed
+        Change_e    change;
+    };
+
+    struct BlockDiff
+    {
+        YaToolObjectId  block1;     // zero when added
+        YaToolObjectId  block2;     // zero when removed
+        Change_e        change;
+        uint32_t        same;       // instructions equal once normalized
+        uint32_t        modified;
+        uint32_t        added;
+        uint32_t        removed;
+    };
+
+    /*
+     * Change record of one matched function pair.
+     * Only changed instructions are listed, in block order.
+     */
+    struct FunctionDiff
+    {
+        YaToolObjectId                  function1;
+        YaToolObjectId                  function2;
+        uint32_t                        same;
+        uint32_t                        modified;
+        uint32_t                        added;
+        uint32_t                        removed;
+        std::vector<BlockDiff>          blocks;
+        std::vector<InstructionDiff>    instructions;
+
+        bool is_identical() const { return !modified && !added && !removed; }
+    };
+
+    /*
+     * Disassembles blobs of every matched function pair & aligns
+     * their basic blocks through the CFG, then their instructions.
+     * Operands holding addresses, branch targets or xref targets
+     * are normalized, so relocated but unchanged code compares equal.
+     * Pairs are diffed in parallel, results are sorted by function1.
+     */
+    std::vector<FunctionDiff> DiffFunctions(const IModel& db1, const IModel& db2, const std::vector<Relation>& relations);
+
+} // end namespace
@@ -3,11 +3,22 @@
 
 #include <Algo/Algo.hpp>
 #include "Configuration.hpp"
+#include "MemoryBudget.hpp"
 #include "VersionRelation.hpp"
+#include "Parallel.hpp"
+#include "HVersion.hpp"
+#include "IModel.hpp"
 #include "Yatools.hpp"
 #include "Helpers.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <string.h>
 #include <vector>
 #include <unordered_map>
@@ -31,12 +42,23 @@ class YaDiffRelationContainer
 {
 public:
 //    std::unordered_map<uint64_t, uint32_t> relation_map_;
-    std::vector<Relation> relations_;
+    SpillVector<Relation> relations_;
     std::unordered_map<uint32_t, uint32_t> all_relations_db1;
     std::unordered_map<uint32_t, uint32_t> all_relations_db2;
     int new_relation_counter_;
 
-    YaDiffRelationContainer(){new_relation_counter_ = 0;}
+    // when set, conflicting relations are kept as candidates
+    // until ResolveConflicts picks a global assignment
+    bool defer_conflicts_;
+    std::vector<Relation> candidates_;
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> all_candidates_;
+
+    YaDiffRelationContainer(MemoryBudget* budget)
+        : relations_(budget)
+        , defer_conflicts_(false)
+    {
+        new_relation_counter_ = 0;
+    }
 
     void MergeRelation(Relation& dest, const Relation& src)
     {
@@ -49,8 +71,45 @@ public:
 #endif
     }
 
+    void AddRelation(const Relation& relation)
+    {
+        const auto index = static_cast<uint32_t>(relations_.size());
+        relations_.push_back(relation);
+        all_relations_db1[relation.version1_.idx_] = index;
+        all_relations_db2[relation.version2_.idx_] = index;
+    }
+
+    bool DeferRelation(const Relation& relation)
+    {
+        const auto it1 = all_relations_db1.find(relation.version1_.idx_);
+        const auto it2 = all_relations_db2.find(relation.version2_.idx_);
+        if(it1 != all_relations_db1.end() && relations_[it1->second].version2_ == relation.version2_)
+        {
+            MergeRelation(relations_[it1->second], relation);
+            return true;
+        }
+        if(it1 == all_relations_db1.end() && it2 == all_relations_db2.end())
+        {
+            AddRelation(relation);
+            ++new_relation_counter_;
+            return true;
+        }
+
+        // conflicting candidates are not new until a resolution picks them
+        const auto key = std::make_pair(static_cast<uint32_t>(relation.version1_.idx_), static_cast<uint32_t>(relation.version2_.idx_));
+        const auto it = all_candidates_.emplace(key, static_cast<uint32_t>(candidates_.size()));
+        if(it.second)
+            candidates_.push_back(relation);
+        else
+            MergeRelation(candidates_[it.first->second], relation);
+        return true;
+    }
+
     bool InsertRelation(const Relation& relation)
     {
+        if(defer_conflicts_)
+            return DeferRelation(relation);
+
         bool b_relation_untrustable = false;
         auto range = all_relations_db1.equal_range(relation.version1_.idx_);
         for(auto it = range.first; it != range.second; ++it)
@@ -105,10 +164,12 @@ public:
 
     int WalkRelations(const yadiff::OnRelationFn& on_relation)
     {
+        // relations may be added while walking, so walk copies
         auto relation_size = relations_.size();
         for(unsigned int i = 0; i < relation_size; ++i)
         {
-            on_relation(relations_[i]);
+            const Relation relation = relations_[i];
+            on_relation(relation);
         }
         return PurgeNewRelations();
     }
@@ -126,6 +187,7 @@ private:
     std::vector<std::shared_ptr<IDiffAlgo>> Algos_;
     std::vector<AlgoCfg> AlgoCfgs_;
     const Configuration& config_;
+    MemoryBudget budget_;
     const IModel* pDb1_;
     const IModel* pDb2_;
 };
@@ -136,8 +198,614 @@ std::shared_ptr<IMatching> MakeMatching(const Configuration& config)
     return std::make_shared<Matching>(config);
 }
 
+namespace
+{
+    size_t GetMemoryBudget(const Configuration& config)
+    {
+        const auto value = config.GetOption(SECTION_NAME, "MemoryBudgetMB");
+        if(value.empty())
+            return 0;
+        try
+        {
+            return static_cast<size_t>(std::stoull(value)) << 20;
+        }
+        catch(const std::exception&)
+        {
+            LOG(ERROR, "invalid value for memory budget %s, using no limit\n", value.data());
+            return 0;
+        }
+    }
+
+    struct UnionFind
+    {
+        UnionFind(size_t size)
+            : parents(size)
+        {
+            std::iota(parents.begin(), parents.end(), 0);
+        }
+
+        size_t find(size_t x)
+        {
+            while(parents[x] != x)
+            {
+                parents[x] = parents[parents[x]];
+                x = parents[x];
+            }
+            return x;
+        }
+
+        void join(size_t a, size_t b)
+        {
+            a = find(a);
+            b = find(b);
+            if(a != b)
+                parents[std::max(a, b)] = std::min(a, b);
+        }
+
+        std::vector<size_t> parents;
+    };
+
+    using Shard = std::vector<uint32_t>;
+
+    // objects are connected through xrefs with at least one unmatched end,
+    // so matched anchors bound components, & each relation joins its two objects
+    // xrefs are walked once, later relations only join more components:
+    // shards may get coarser than needed, but never split interacting relations
+    // removing relations can split components, which must then be rebuilt
+    struct XrefComponents
+    {
+        XrefComponents(const IModel& db1, const IModel& db2, const YaDiffRelationContainer& relations)
+            : components(db1.size() + db2.size())
+            , size1(db1.size())
+        {
+            const auto join_xrefs = [&](const IModel& db, size_t offset, const std::unordered_map<uint32_t, uint32_t>& matched)
+            {
+                db.walk([&](const HVersion& hver)
+                {
+                    const auto is_matched = !!matched.count(static_cast<uint32_t>(hver.idx_));
+                    hver.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+                    {
+                        if(!is_matched || !matched.count(static_cast<uint32_t>(xref.idx_)))
+                            components.join(offset + hver.idx_, offset + xref.idx_);
+                        return WALK_CONTINUE;
+                    });
+                    return WALK_CONTINUE;
+                });
+            };
+            join_xrefs(db1, 0, relations.all_relations_db1);
+            join_xrefs(db2, size1, relations.all_relations_db2);
+        }
+
+        UnionFind   components;
+        size_t      size1;
+    };
+
+    // splits relations into shards which cannot interact during one algo pass
+    // shards list relation indexes in container order
+    std::vector<Shard> GetShards(XrefComponents& xrefs, const YaDiffRelationContainer& relations)
+    {
+        auto& components = xrefs.components;
+        const auto num_relations = relations.relations_.size();
+        for(size_t i = 0; i < num_relations; ++i)
+        {
+            const auto& relation = relations.relations_[i];
+            components.join(relation.version1_.idx_, xrefs.size1 + relation.version2_.idx_);
+        }
+
+        std::vector<Shard> shards;
+        std::unordered_map<size_t, size_t> roots;
+        for(size_t i = 0; i < num_relations; ++i)
+        {
+            const auto root = components.find(relations.relations_[i].version1_.idx_);
+            const auto it = roots.emplace(root, shards.size()).first;
+            if(it->second == shards.size())
+                shards.emplace_back();
+            shards[it->second].push_back(static_cast<uint32_t>(i));
+        }
+        return shards;
+    }
+
+    using ShardOutput = std::vector<std::pair<uint32_t, Relation>>;
+
+    // runs algo on every shard concurrently, each shard walking a snapshot of its relations,
+    // then inserts new relations in the order a single walk over all relations would have
+    int AnalyseShards(IDiffAlgo& algo, YaDiffRelationContainer& relations, const std::vector<Shard>& shards)
+    {
+        // the relation container is not thread-safe, copy inputs first
+        std::vector<std::vector<Relation>> inputs(shards.size());
+        for(size_t i = 0; i < shards.size(); ++i)
+            for(const auto idx : shards[i])
+                inputs[i].push_back(relations.relations_[idx]);
+
+        // schedule biggest shards first
+        std::vector<size_t> order(shards.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+        {
+            return shards[a].size() > shards[b].size();
+        });
+
+        std::vector<ShardOutput> outputs(shards.size());
+        std::atomic<size_t> next(0);
+        parallel::for_ranges(shards.size(), 1, [&](size_t, size_t, size_t)
+        {
+            for(auto i = next++; i < shards.size(); i = next++)
+            {
+                const auto idx = order[i];
+                auto& output = outputs[idx];
+                uint32_t current = 0;
+                algo.Analyse(
+                    [&](const Relation& relation)
+                    {
+                        output.emplace_back(current, relation);
+                        return true;
+                    },
+                    [&](const OnRelationFn& on_relation)
+                    {
+                        for(size_t j = 0; j < inputs[idx].size(); ++j)
+                        {
+                            current = shards[idx][j];
+                            on_relation(inputs[idx][j]);
+                        }
+                    });
+            }
+        });
+        inputs.clear();
+
+        ShardOutput merged;
+        for(auto& output : outputs)
+        {
+            merged.insert(merged.end(), output.begin(), output.end());
+            ShardOutput().swap(output);
+        }
+        std::stable_sort(merged.begin(), merged.end(), [](const auto& a, const auto& b)
+        {
+            return a.first < b.first;
+        });
+        for(const auto& it : merged)
+            relations.InsertRelation(it.second);
+        return relations.PurgeNewRelations();
+    }
+
+    enum ResolveAt_e
+    {
+        RESOLVE_NEVER,      // first relation wins, conflicts are untrustable
+        RESOLVE_AT_PASS,    // after every algorithm pass
+        RESOLVE_AT_ROUND,   // after every loop over all algorithms
+        RESOLVE_AT_END,     // once all algorithms are done
+    };
+
+    ResolveAt_e GetResolveAt(const Configuration& config)
+    {
+        const auto value = config.GetOption(SECTION_NAME, "ConflictResolution");
+        if(value.empty() || value == "none")
+            return RESOLVE_NEVER;
+        if(value == "pass")
+            return RESOLVE_AT_PASS;
+        if(value == "round")
+            return RESOLVE_AT_ROUND;
+        if(value == "end")
+            return RESOLVE_AT_END;
+        LOG(ERROR, "invalid value for conflict resolution %s, ignoring\n", value.data());
+        return RESOLVE_NEVER;
+    }
+
+    size_t GetExactLimit(const Configuration& config)
+    {
+        // hungarian assignment is cubic, bigger components are resolved greedily
+        const auto value = config.GetOption(SECTION_NAME, "ConflictResolutionExactLimit");
+        if(value.empty())
+            return 256;
+        try
+        {
+            return static_cast<size_t>(std::stoull(value));
+        }
+        catch(const std::exception&)
+        {
+            LOG(ERROR, "invalid value for conflict resolution exact limit %s, using 256\n", value.data());
+            return 256;
+        }
+    }
+
+    struct Edge
+    {
+        Relation    relation;
+        uint64_t    weight;
+        size_t      left;   // component-local indexes
+        size_t      right;
+        bool        candidate;
+    };
+
+    uint64_t GetWeight(const Relation& relation)
+    {
+        // confidence first, then exact matches over diffs over untrustable relations
+        const auto rank = relation.type_ == RELATION_TYPE_EXACT_MATCH ? 2 : relation.type_ == RELATION_TYPE_UNTRUSTABLE ? 0 : 1;
+        return (static_cast<uint64_t>(std::max(relation.confidence_, 0)) + 1) * 4 + rank;
+    }
+
+    bool IsBefore(const Edge& a, const Edge& b)
+    {
+        const auto a1 = a.relation.version1_.id();
+        const auto b1 = b.relation.version1_.id();
+        if(a1 != b1)
+            return a1 < b1;
+        return a.relation.version2_.id() < b.relation.version2_.id();
+    }
+
+    // max-weight bipartite matching with the hungarian algorithm,
+    // missing edges weigh zero & are dropped from the assignment
+    std::vector<bool> AssignExact(const std::vector<Edge>& edges, size_t num_left, size_t num_right)
+    {
+        const auto n = std::max(num_left, num_right);
+        uint64_t max_weight = 0;
+        for(const auto& edge : edges)
+            max_weight = std::max(max_weight, edge.weight);
+        std::vector<int64_t> costs(n * n, static_cast<int64_t>(max_weight));
+        for(const auto& edge : edges)
+            costs[edge.left * n + edge.right] = static_cast<int64_t>(max_weight - edge.weight);
+
+        // 1-based potentials & matching, see e-maxx assignment problem
+        const auto inf = std::numeric_limits<int64_t>::max() / 2;
+        std::vector<int64_t> u(n + 1), v(n + 1);
+        std::vector<size_t> match(n + 1), way(n + 1);
+        for(size_t i = 1; i <= n; ++i)
+        {
+            match[0] = i;
+            size_t j0 = 0;
+            std::vector<int64_t> minv(n + 1, inf);
+            std::vector<bool> used(n + 1, false);
+            do
+            {
+                used[j0] = true;
+                const auto i0 = match[j0];
+                auto delta = inf;
+                size_t j1 = 0;
+                for(size_t j = 1; j <= n; ++j)
+                {
+                    if(used[j])
+                        continue;
+                    const auto cur = costs[(i0 - 1) * n + j - 1] - u[i0] - v[j];
+                    if(cur < minv[j])
+                    {
+                        minv[j] = cur;
+                        way[j] = j0;
+                    }
+                    if(minv[j] < delta)
+                    {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+                for(size_t j = 0; j <= n; ++j)
+                    if(used[j])
+                    {
+                        u[match[j]] += delta;
+                        v[j] -= delta;
+                    }
+                    else
+                    {
+                        minv[j] -= delta;
+                    }
+                j0 = j1;
+            }
+            while(match[j0]);
+            do
+            {
+                const auto j1 = way[j0];
+                match[j0] = match[j1];
+                j0 = j1;
+            }
+            while(j0);
+        }
+
+        std::vector<size_t> assigned(n, n);
+        for(size_t j = 1; j <= n; ++j)
+            if(match[j])
+                assigned[match[j] - 1] = j - 1;
+        std::vector<bool> chosen(edges.size());
+        for(size_t i = 0; i < edges.size(); ++i)
+            chosen[i] = assigned[edges[i].left] == edges[i].right;
+        return chosen;
+    }
+
+    // heaviest edges first, ties broken by object ids
+    std::vector<bool> AssignGreedy(const std::vector<Edge>& edges, size_t num_left, size_t num_right)
+    {
+        std::vector<size_t> order(edges.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+        {
+            if(edges[a].weight != edges[b].weight)
+                return edges[a].weight > edges[b].weight;
+            return IsBefore(edges[a], edges[b]);
+        });
+        std::vector<bool> used_left(num_left);
+        std::vector<bool> used_right(num_right);
+        std::vector<bool> chosen(edges.size());
+        for(const auto i : order)
+        {
+            const auto& edge = edges[i];
+            if(used_left[edge.left] || used_right[edge.right])
+                continue;
+            used_left[edge.left] = used_right[edge.right] = true;
+            chosen[i] = true;
+        }
+        return chosen;
+    }
+
+    // replaces conflicting relations & candidates with a one-to-one assignment
+    // computed on every connected component holding candidates,
+    // so results do not depend on algorithm or insertion order
+    // returns how many candidates became relations
+    int ResolveConflicts(YaDiffRelationContainer& relations, size_t exact_limit)
+    {
+        if(relations.candidates_.empty())
+            return 0;
+
+        // gather every edge, relations first
+        std::vector<Edge> edges;
+        for(const auto& relation : relations.relations_)
+            edges.push_back({relation, GetWeight(relation), 0, 0, false});
+        for(const auto& relation : relations.candidates_)
+            edges.push_back({relation, GetWeight(relation), 0, 0, true});
+
+        // left objects use even nodes, right objects odd ones
+        std::unordered_map<uint64_t, size_t> nodes;
+        const auto get_node = [&](uint64_t key)
+        {
+            return nodes.emplace(key, nodes.size()).first->second;
+        };
+        std::vector<std::pair<size_t, size_t>> ends;
+        for(const auto& edge : edges)
+            ends.emplace_back(get_node(uint64_t(edge.relation.version1_.idx_) << 1),
+                              get_node((uint64_t(edge.relation.version2_.idx_) << 1) | 1));
+        UnionFind components(nodes.size());
+        for(const auto& it : ends)
+            components.join(it.first, it.second);
+
+        std::unordered_map<size_t, std::vector<size_t>> conflicts;
+        for(size_t i = 0; i < edges.size(); ++i)
+            if(edges[i].candidate)
+                conflicts[components.find(ends[i].first)];
+        std::vector<bool> contested(edges.size());
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            const auto it = conflicts.find(components.find(ends[i].first));
+            if(it == conflicts.end())
+                continue;
+            it->second.push_back(i);
+            contested[i] = true;
+        }
+
+        std::vector<bool> chosen(edges.size());
+        size_t num_exact = 0;
+        for(const auto& it : conflicts)
+        {
+            // sorted by object ids, so the assignment only depends on edges
+            std::vector<Edge> component;
+            for(const auto i : it.second)
+                component.push_back(edges[i]);
+            std::vector<size_t> order(component.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+            {
+                return IsBefore(component[a], component[b]);
+            });
+            std::map<YaToolObjectId, size_t> left;
+            std::map<YaToolObjectId, size_t> right;
+            for(const auto& edge : component)
+            {
+                left.emplace(edge.relation.version1_.id(), 0);
+                right.emplace(edge.relation.version2_.id(), 0);
+            }
+            size_t idx = 0;
+            for(auto& node : left)
+                node.second = idx++;
+            idx = 0;
+            for(auto& node : right)
+                node.second = idx++;
+            std::vector<Edge> sorted;
+            for(const auto i : order)
+            {
+                sorted.push_back(component[i]);
+                sorted.back().left = left[component[i].relation.version1_.id()];
+                sorted.back().right = right[component[i].relation.version2_.id()];
+            }
+
+            const auto is_exact = left.size() + right.size() <= exact_limit;
+            num_exact += is_exact;
+            const auto assigned = is_exact ?
+                AssignExact(sorted, left.size(), right.size()) :
+                AssignGreedy(sorted, left.size(), right.size());
+            for(size_t i = 0; i < order.size(); ++i)
+                chosen[it.second[order[i]]] = assigned[i];
+        }
+
+        // keep relations in place, append chosen candidates in id order
+        // & keep every rejected edge as a candidate for later resolutions
+        std::vector<Edge> adopted;
+        std::vector<Edge> rejected;
+        size_t size = 0;
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            auto& edge = edges[i];
+            if(contested[i] && !chosen[i])
+                rejected.push_back(edge);
+            else if(edge.candidate)
+                adopted.push_back(edge);
+            else
+                relations.relations_[size++] = edge.relation;
+        }
+        std::sort(adopted.begin(), adopted.end(), &IsBefore);
+        std::sort(rejected.begin(), rejected.end(), &IsBefore);
+
+        relations.relations_.truncate(size);
+        relations.all_relations_db1.clear();
+        relations.all_relations_db2.clear();
+        for(size_t i = 0; i < size; ++i)
+        {
+            const auto& relation = relations.relations_[i];
+            relations.all_relations_db1[relation.version1_.idx_] = static_cast<uint32_t>(i);
+            relations.all_relations_db2[relation.version2_.idx_] = static_cast<uint32_t>(i);
+        }
+        for(const auto& edge : adopted)
+            relations.AddRelation(edge.relation);
+
+        relations.candidates_.clear();
+        relations.all_candidates_.clear();
+        for(const auto& edge : rejected)
+        {
+            const auto key = std::make_pair(static_cast<uint32_t>(edge.relation.version1_.idx_), static_cast<uint32_t>(edge.relation.version2_.idx_));
+            relations.all_candidates_.emplace(key, static_cast<uint32_t>(relations.candidates_.size()));
+            relations.candidates_.push_back(edge.relation);
+        }
+        LOG(INFO, "conflicts: %zd components, %zd exact, %zd candidates adopted, %zd rejected\n", conflicts.size(), num_exact, adopted.size(), rejected.size());
+        return static_cast<int>(adopted.size());
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    double GetSeconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double GetPositiveOption(const Configuration& config, const char* name)
+    {
+        const auto value = config.GetOption(SECTION_NAME, name);
+        if(value.empty())
+            return 0;
+        try
+        {
+            return std::max(0., std::stod(value));
+        }
+        catch(const std::exception&)
+        {
+            LOG(ERROR, "invalid value for %s %s, ignoring\n", name, value.data());
+            return 0;
+        }
+    }
+
+    struct SchedulerCfg
+    {
+        double min_yield_rate;  // new relations per second, slower algorithms are deferred
+        double time_budget;     // seconds since analyse start, zero for no limit
+    };
+
+    struct AlgoStats
+    {
+        IDiffAlgo*  algo;
+        size_t      passes;
+        int         yield;          // new relations of last pass
+        double      seconds;        // duration of last pass
+        size_t      generation;     // relations generation seen by last pass
+        size_t      total_yield;
+        double      total_seconds;
+    };
+
+    double GetYieldRate(const AlgoStats& stats)
+    {
+        // unmeasured algorithms run first
+        if(!stats.passes)
+            return std::numeric_limits<double>::infinity();
+        return stats.yield / std::max(stats.seconds, 1e-6);
+    }
+
+    using RunPassFn = std::function<int(IDiffAlgo& algo)>;
+    using OnRoundFn = std::function<int()>;
+
+    // runs algorithms by decreasing yield rate until no algorithm finds anything,
+    // the round yield rate collapses or the time budget is spent
+    void ScheduleAlgos(std::vector<AlgoStats>& algos, const SchedulerCfg& cfg, Clock::time_point start, const RunPassFn& run_pass, const OnRoundFn& on_round)
+    {
+        size_t generation = 0;
+        const auto out_of_time = [&]
+        {
+            return cfg.time_budget > 0 && GetSeconds(start) >= cfg.time_budget;
+        };
+        const auto run = [&](AlgoStats& stats)
+        {
+            // own new relations are new input for the next pass
+            stats.generation = generation;
+            const auto begin = Clock::now();
+            stats.yield = run_pass(*stats.algo);
+            stats.seconds = GetSeconds(begin);
+            stats.passes++;
+            stats.total_yield += stats.yield;
+            stats.total_seconds += stats.seconds;
+            generation += stats.yield;
+            return stats.yield;
+        };
+        const auto run_all = [&](std::vector<AlgoStats*>& todo, size_t& yield, double& seconds)
+        {
+            std::stable_sort(todo.begin(), todo.end(), [](const auto* a, const auto* b)
+            {
+                return GetYieldRate(*a) > GetYieldRate(*b);
+            });
+            for(auto* stats : todo)
+            {
+                if(out_of_time())
+                {
+                    LOG(INFO, "scheduler: time budget exhausted\n");
+                    return false;
+                }
+                yield += run(*stats);
+                seconds += stats->seconds;
+            }
+            return true;
+        };
+
+        std::vector<AlgoStats*> productive;
+        std::vector<AlgoStats*> deferred;
+        while(true)
+        {
+            productive.clear();
+            deferred.clear();
+            for(auto& stats : algos)
+            {
+                // algorithms are deterministic, skip those without new input
+                if(stats.passes && stats.generation == generation)
+                    continue;
+                auto& dst = GetYieldRate(stats) >= cfg.min_yield_rate ? productive : deferred;
+                dst.push_back(&stats);
+            }
+            if(productive.empty() && deferred.empty())
+                break;
+
+            size_t yield = 0;
+            double seconds = 0;
+            if(!run_all(productive, yield, seconds))
+                break;
+            // deferred algorithms only run once productive ones are exhausted
+            if(!yield && !run_all(deferred, yield, seconds))
+                break;
+            // relations changed at round end are new input too
+            const auto changed = on_round();
+            yield += changed;
+            generation += changed;
+            if(!yield)
+                break;
+
+            const auto rate = yield / std::max(seconds, 1e-6);
+            LOG(INFO, "scheduler: round found %zd new relations, %.1f relations/s\n", yield, rate);
+            if(rate < cfg.min_yield_rate)
+            {
+                LOG(INFO, "scheduler: yield rate collapsed\n");
+                break;
+            }
+        }
+
+        for(const auto& stats : algos)
+        {
+            UNUSED(stats);
+            LOG(INFO, "scheduler: algo %s %zd passes, %zd relations in %.3f s\n", stats.algo->GetName(), stats.passes, stats.total_yield, stats.total_seconds);
+        }
+    }
+}
+
 Matching::Matching(const Configuration& config)
     : config_(config)
+    , budget_(GetMemoryBudget(config))
     , pDb1_(nullptr)
     , pDb2_(nullptr)
 {
@@ -148,6 +816,7 @@ bool Matching::Prepare(const IModel& db1, const IModel& db2)
 {
     AlgoCfg AlgoConfig;
     memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+    AlgoConfig.Budget = &budget_;
     pDb1_ = &db1;
     pDb2_ = &db2;
 
@@ -156,6 +825,7 @@ bool Matching::Prepare(const IModel& db1, const IModel& db2)
     if(config_.IsOptionTrue(SECTION_NAME, "XRefOffsetMatch"))
     {
         memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+        AlgoConfig.Budget = &budget_;
         AlgoConfig.Algo = ALGO_XREF_OFFSET_MATCH;
         AlgoCfgs_.push_back(AlgoConfig);
         auto algo = MakeDiffAlgo(AlgoConfig);
@@ -165,6 +835,7 @@ bool Matching::Prepare(const IModel& db1, const IModel& db2)
     if(config_.IsOptionTrue(SECTION_NAME, "CallerXRefMatch"))
     {
         memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+        AlgoConfig.Budget = &budget_;
         AlgoConfig.Algo = ALGO_CALLER_XREF_MATCH;
         if(config_.IsOptionTrue(SECTION_NAME, "CallerXRefMatch_TrustDiffingRelations"))
         {
@@ -191,16 +862,25 @@ bool Matching::Analyse(std::vector<Relation>& output)
 //        LOG(WARNING, "could not do analyze, call prepare before\n");
         return false;
     }
-    auto relations = YaDiffRelationContainer();
+    const auto start = Clock::now();
+    YaDiffRelationContainer relations(&budget_);
+    const auto resolve_at = GetResolveAt(config_);
+    const auto exact_limit = GetExactLimit(config_);
+    relations.defer_conflicts_ = resolve_at != RESOLVE_NEVER;
     AlgoCfg AlgoConfig;
     bool DoAnalyzeUntilAlgoReturn0 = config_.IsOptionTrue(SECTION_NAME, "DoAnalyzeUntilAlgoReturn0");
     bool DoAnalyzeUntilAnalyzeReturn0 = config_.IsOptionTrue(SECTION_NAME, "DoAnalyzeUntilAnalyzeReturn0");
+    // sharded passes run algos concurrently on independent components, each walking
+    // a snapshot taken before the pass: relations made untrustable during a pass
+    // still feed its other shards, which may change results, so it is opt-in
+    const auto sharded = config_.IsOptionTrue(SECTION_NAME, "ShardedPasses");
 
     // apply external mapping match algo
     if(config_.IsOptionTrue(SECTION_NAME, "ExternalMappingMatch"))
     {
         LOG(INFO, "start external mapping association\n");
         memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+        AlgoConfig.Budget = &budget_;
         AlgoConfig.Algo = ALGO_EXTERNAL_MAPPING_MATCH;
         AlgoConfig.ExternalMappingMatch.MappingFilePath = config_.GetOption(SECTION_NAME, "ExternalMappingMatchPath").c_str();
         auto relation_confidence = config_.GetOption(SECTION_NAME, "ExternalMappingMatchRelationConfidence");
@@ -260,12 +940,58 @@ bool Matching::Analyse(std::vector<Relation>& output)
           }
         else
           LOG(ERROR, "could not apply external mapping\n");
+    }
+
+    // apply name match algo before signatures, names are the cheapest anchors
+    if(config_.IsOptionTrue(SECTION_NAME, "NameMatch"))
+    {
+        LOG(INFO, "start name association\n");
+        memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+        AlgoConfig.Budget = &budget_;
+        AlgoConfig.Algo = ALGO_NAME_MATCH;
+        AlgoCfgs_.push_back(AlgoConfig);
+        auto algo = MakeDiffAlgo(AlgoConfig);
+        algo->Prepare(*pDb1_, *pDb2_);
+        algo->Analyse(
+            [&](const Relation& relation)
+            {
+                return relations.InsertRelation(relation);
+            },
+            [&](const yadiff::OnRelationFn& on_relation)
+            {
+                return relations.WalkRelations(on_relation);
+            });
+        LOG(INFO, "name association done %zd\n", relations.relations_.size());
+    }
+
+    // apply type match algo, types are matched by layout independently of code
+    if(config_.IsOptionTrue(SECTION_NAME, "TypeMatch"))
+    {
+        LOG(INFO, "start type association\n");
+        memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+        AlgoConfig.Budget = &budget_;
+        AlgoConfig.Algo = ALGO_TYPE_MATCH;
+        AlgoCfgs_.push_back(AlgoConfig);
+        auto algo = MakeDiffAlgo(AlgoConfig);
+        algo->Prepare(*pDb1_, *pDb2_);
+        algo->Analyse(
+            [&](const Relation& relation)
+            {
+                return relations.InsertRelation(relation);
+            },
+            [&](const yadiff::OnRelationFn& on_relation)
+            {
+                return relations.WalkRelations(on_relation);
+            });
+        LOG(INFO, "type association done %zd\n", relations.relations_.size());
     }  int new_relation_counter_g = 0;
 
     memset(&AlgoConfig, 0, sizeof(AlgoConfig));
+    AlgoConfig.Budget = &budget_;
 
     // always start with exact match algo
     AlgoConfig.Algo = ALGO_EXACT_MATCH;
+    AlgoConfig.ExactMatch.CompositeKeys = config_.IsOptionTrue(SECTION_NAME, "ExactMatch_CompositeKeys");
     AlgoCfgs_.push_back(AlgoConfig);
     auto exact_algo = MakeDiffAlgo(AlgoConfig);
     exact_algo->Prepare(*pDb1_, *pDb2_);
@@ -281,40 +1007,92 @@ bool Matching::Analyse(std::vector<Relation>& output)
         });
     LOG(INFO, "first association done %zd\n", relations.relations_.size());
 
-    LOG(INFO, "start algo loop\n");
-    do
+    std::unique_ptr<XrefComponents> xrefs;
+    const auto resolve = [&](ResolveAt_e checkpoint)
+    {
+        if(resolve_at != checkpoint)
+            return 0;
+        // resolutions may drop relations
+        xrefs.reset();
+        return ResolveConflicts(relations, exact_limit);
+    };
+    // first associations count as one pass & one round
+    if(resolve_at == RESOLVE_AT_PASS || resolve_at == RESOLVE_AT_ROUND)
+        ResolveConflicts(relations, exact_limit);
+
+    const auto run_pass = [&](IDiffAlgo& algo)
     {
-        LOG(INFO, "main loop relation counter: %d\n", new_relation_counter_g);
-        new_relation_counter_g = 0;
-        for(const auto algo: Algos_)
+        int new_relation_counter = 0;
+        size_t num_shards = 1;
+        if(sharded)
         {
-            int new_relation_counter = 0;
-            do
-            {
-                algo->Analyse(
+            if(!xrefs)
+                xrefs = std::make_unique<XrefComponents>(*pDb1_, *pDb2_, relations);
+            const auto shards = GetShards(*xrefs, relations);
+            num_shards = shards.size();
+            new_relation_counter = AnalyseShards(algo, relations, shards);
+        }
+        else
+        {
+            algo.Analyse(
                 [&](const Relation& relation)
                 {
                     return relations.InsertRelation(relation);
                 },
                 [&](const yadiff::OnRelationFn& on_relation)
                 {
-                    auto new_relations = relations.relations_;
-                    for(const auto relation : new_relations)
-                    {
-                        on_relation(relation);
-                    }
-                    new_relation_counter = relations.PurgeNewRelations();
+                    new_relation_counter = relations.WalkRelations(on_relation);
                     return new_relation_counter;
                 });
-                new_relation_counter_g += new_relation_counter;
-                LOG(INFO, "algo %s found: %d new relation %zd\n", algo->GetName(), new_relation_counter, relations.relations_.size());
+        }
+        new_relation_counter += resolve(RESOLVE_AT_PASS);
+        LOG(INFO, "algo %s found: %d new relation %zd in %zd shards\n", algo.GetName(), new_relation_counter, relations.relations_.size(), num_shards);
+        budget_.Log(algo.GetName());
+        return new_relation_counter;
+    };
+
+    if(config_.IsOptionTrue(SECTION_NAME, "AdaptiveScheduler"))
+    {
+        LOG(INFO, "start adaptive algo loop\n");
+        std::vector<AlgoStats> stats;
+        for(const auto& algo : Algos_)
+            stats.push_back({algo.get(), 0, 0, 0, 0, 0, 0});
+        const auto cfg = SchedulerCfg{
+            GetPositiveOption(config_, "SchedulerMinYieldPerSecond"),
+            GetPositiveOption(config_, "SchedulerTimeBudgetSeconds"),
+        };
+        ScheduleAlgos(stats, cfg, start, run_pass, [&]
+        {
+            return resolve(RESOLVE_AT_ROUND);
+        });
+    }
+    else
+    {
+        LOG(INFO, "start algo loop\n");
+        do
+        {
+            LOG(INFO, "main loop relation counter: %d\n", new_relation_counter_g);
+            new_relation_counter_g = 0;
+            for(const auto& algo: Algos_)
+            {
+                int new_relation_counter = 0;
+                do
+                {
+                    new_relation_counter = run_pass(*algo);
+                    new_relation_counter_g += new_relation_counter;
+                }
+                while(DoAnalyzeUntilAlgoReturn0 && (new_relation_counter > 0));
             }
-            while(DoAnalyzeUntilAlgoReturn0 && (new_relation_counter > 0));
+            new_relation_counter_g += resolve(RESOLVE_AT_ROUND);
         }
+        while(DoAnalyzeUntilAnalyzeReturn0 && (new_relation_counter_g > 0));
     }
-    while(DoAnalyzeUntilAnalyzeReturn0 && (new_relation_counter_g > 0));
 
+    // remaining candidates are always resolved before output
+    if(resolve_at != RESOLVE_NEVER)
+        ResolveConflicts(relations, exact_limit);
     LOG(INFO, "algo loop done %zd\n", relations.relations_.size());
+    budget_.Log("matching");
 
     output.insert(output.end(), relations.relations_.begin(), relations.relations_.end());
     return true;
@@ -0,0 +1,203 @@
+#include "MemoryBudget.hpp"
+
+#include "Yatools.hpp"
+#include "Helpers.h"
+
+#include <algorithm>
+#include <stdio.h>
+
+#ifdef _MSC_VER
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+#if 1
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("yadiff", (FMT), ## __VA_ARGS__)
+#else
+#define LOG(...) do {} while(0)
+#endif
+
+namespace yadiff
+{
+MemoryBudget::MemoryBudget(size_t limit)
+    : limit_  (limit)
+    , used_   (0)
+    , peak_   (0)
+    , spilled_(0)
+{
+}
+
+bool MemoryBudget::TryReserve(size_t size)
+{
+    auto used = used_.load();
+    do
+    {
+        if(limit_ && used + size > limit_)
+            return false;
+    }
+    while(!used_.compare_exchange_weak(used, used + size));
+
+    auto peak = peak_.load();
+    while(used + size > peak && !peak_.compare_exchange_weak(peak, used + size))
+        continue;
+    return true;
+}
+
+void MemoryBudget::Release(size_t size)
+{
+    used_ -= size;
+}
+
+void MemoryBudget::Spill(size_t size)
+{
+    spilled_ += size;
+}
+
+void MemoryBudget::Unspill(size_t size)
+{
+    spilled_ -= size;
+}
+
+void MemoryBudget::Log(const char* where) const
+{
+    const size_t mb = 1 << 20;
+    if(limit_)
+        LOG(INFO, "%s: memory %zd/%zd MB, peak %zd MB, spilled %zd MB\n", where, Used() / mb, limit_ / mb, Peak() / mb, Spilled() / mb);
+    else
+        LOG(INFO, "%s: memory %zd MB, peak %zd MB\n", where, Used() / mb, Peak() / mb);
+}
+
+#ifdef _MSC_VER
+struct SpillBuffer::Mapping
+{
+    Mapping(size_t size)
+        : file(INVALID_HANDLE_VALUE)
+        , map(nullptr)
+        , view(nullptr)
+    {
+        char dir[MAX_PATH];
+        char path[MAX_PATH];
+        if(!GetTempPathA(sizeof dir, dir) || !GetTempFileNameA(dir, "yad", 0, path))
+            return;
+        file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+        if(file == INVALID_HANDLE_VALUE)
+            return;
+        const auto size64 = static_cast<uint64_t>(size);
+        map = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), nullptr);
+        if(!map)
+            return;
+        view = MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    }
+
+    ~Mapping()
+    {
+        if(view)
+            UnmapViewOfFile(view);
+        if(map)
+            CloseHandle(map);
+        if(file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+    }
+
+    HANDLE  file;
+    HANDLE  map;
+    void*   view;
+};
+#else
+struct SpillBuffer::Mapping
+{
+    Mapping(size_t size)
+        : file(nullptr)
+        , view(nullptr)
+        , size(size)
+    {
+        // tmpfile is unlinked on creation & deleted on close
+        file = tmpfile();
+        if(!file)
+            return;
+        const auto fd = fileno(file);
+        if(ftruncate(fd, static_cast<off_t>(size)))
+            return;
+        const auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(ptr != MAP_FAILED)
+            view = ptr;
+    }
+
+    ~Mapping()
+    {
+        if(view)
+            munmap(view, size);
+        if(file)
+            fclose(file);
+    }
+
+    FILE*   file;
+    void*   view;
+    size_t  size;
+};
+#endif
+
+SpillBuffer::SpillBuffer()
+    : data_  (nullptr)
+    , size_  (0)
+    , budget_(nullptr)
+{
+}
+
+SpillBuffer::~SpillBuffer()
+{
+    Clear();
+}
+
+void SpillBuffer::Clear()
+{
+    if(budget_ && ram_)
+        budget_->Release(size_);
+    if(budget_ && mapping_)
+        budget_->Unspill(size_);
+    ram_.reset();
+    mapping_.reset();
+    data_ = nullptr;
+    size_ = 0;
+    budget_ = nullptr;
+}
+
+void SpillBuffer::Reset(size_t size, MemoryBudget* budget)
+{
+    Clear();
+    if(!size)
+        return;
+
+    size_ = size;
+    budget_ = budget;
+    if(budget && !budget->TryReserve(size))
+    {
+        std::unique_ptr<Mapping> mapping(new Mapping(size));
+        if(mapping->view)
+        {
+            // file mappings are already zero-filled
+            mapping_ = std::move(mapping);
+            data_ = mapping_->view;
+            budget->Spill(size);
+            return;
+        }
+        LOG(WARNING, "unable to spill %zd bytes to disk, using ram\n", size);
+        budget_ = nullptr;
+    }
+
+    ram_.reset(new uint8_t[size]());
+    data_ = ram_.get();
+}
+
+void SpillBuffer::Swap(SpillBuffer& other)
+{
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(budget_, other.budget_);
+    std::swap(ram_, other.ram_);
+    std::swap(mapping_, other.mapping_);
+}
+}
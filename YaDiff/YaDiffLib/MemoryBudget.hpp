@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+namespace yadiff
+{
+    /*
+     * Accounts bytes held by the biggest yadiff intermediates.
+     * Once the limit is reached, new buffers spill to temporary files.
+     * A null limit means unlimited.
+     */
+    class MemoryBudget
+    {
+    public:
+        MemoryBudget(size_t limit);
+
+        // account size bytes in ram & return true if they fit the budget
+        bool    TryReserve(size_t size);
+        void    Release(size_t size);
+
+        // account size bytes spilled to disk
+        void    Spill(size_t size);
+        void    Unspill(size_t size);
+
+        size_t  Limit() const { return limit_; }
+        size_t  Used() const { return used_; }
+        size_t  Peak() const { return peak_; }
+        size_t  Spilled() const { return spilled_; }
+
+        void    Log(const char* where) const;
+
+    private:
+        const size_t        limit_;
+        std::atomic<size_t> used_;
+        std::atomic<size_t> peak_;
+        std::atomic<size_t> spilled_;
+    };
+
+    /*
+     * Zero-initialized raw buffer, allocated in ram while the budget allows it,
+     * else mapped from an anonymous temporary file.
+     */
+    class SpillBuffer
+    {
+    public:
+        SpillBuffer();
+        ~SpillBuffer();
+
+        SpillBuffer(const SpillBuffer&) = delete;
+        SpillBuffer& operator=(const SpillBuffer&) = delete;
+
+        // drop current content & allocate size bytes, budget can be null
+        void        Reset(size_t size, MemoryBudget* budget);
+        void        Swap(SpillBuffer& other);
+
+        void*       Data() { return data_; }
+        const void* Data() const { return data_; }
+        size_t      Size() const { return size_; }
+        bool        IsSpilled() const { return !!mapping_; }
+
+    private:
+        struct Mapping;
+        void                        Clear();
+
+        void*                       data_;
+        size_t                      size_;
+        MemoryBudget*               budget_;
+        std::unique_ptr<uint8_t[]>  ram_;
+        std::unique_ptr<Mapping>    mapping_;
+    };
+
+    /*
+     * Vector of trivially copyable values stored in a SpillBuffer.
+     * Values are appended, & only removed by truncating the tail.
+     */
+    template<typename T>
+    class SpillVector
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "spilled values must be trivially copyable");
+
+    public:
+        SpillVector(MemoryBudget* budget)
+            : budget_(budget)
+            , size_(0)
+        {
+        }
+
+        void push_back(const T& value)
+        {
+            if(size_ == capacity())
+                grow();
+            memcpy(&data()[size_], &value, sizeof value);
+            ++size_;
+        }
+
+        void truncate(size_t size)
+        {
+            size_ = std::min(size_, size);
+        }
+
+        size_t      size() const { return size_; }
+        bool        empty() const { return !size_; }
+        T&          operator[](size_t idx) { return data()[idx]; }
+        const T&    operator[](size_t idx) const { return data()[idx]; }
+        const T*    begin() const { return data(); }
+        const T*    end() const { return data() + size_; }
+
+    private:
+        T*          data() { return static_cast<T*>(buffer_.Data()); }
+        const T*    data() const { return static_cast<const T*>(buffer_.Data()); }
+        size_t      capacity() const { return buffer_.Size() / sizeof(T); }
+
+        void grow()
+        {
+            SpillBuffer next;
+            next.Reset(sizeof(T) * (capacity() ? capacity() * 2 : 1024), budget_);
+            if(size_)
+                memcpy(next.Data(), buffer_.Data(), size_ * sizeof(T));
+            buffer_.Swap(next);
+        }
+
+        MemoryBudget*   budget_;
+        SpillBuffer     buffer_;
+        size_t          size_;
+    };
+}
@@ -65,17 +65,17 @@ void MergeToCache(YaDiff& differ, const Configuration& config, const std::string
     std::vector<Relation> relations;
     differ.MergeDatabases(*ref_model, *new_model, relations);
     
+    // every cache receives the same objects, propagate them once
     Propagate propagater(config, nullptr);
+    auto exporter = MakeFlatBufferVisitor();
+    propagater.PropagateToDB(*exporter, *ref_model, *new_model, [&](const yadiff::OnRelationFn& on_relation)
+    {
+        for(const auto& relation : relations)
+            on_relation(relation);
+    });
+
     for(const auto& cache : caches)
     {
-        LOG(INFO, "Propagating cache %s\n", cache.data());
-        auto exporter = MakeFlatBufferVisitor();
-        propagater.PropagateToDB(*exporter, *ref_model, *new_model, [&](const yadiff::OnRelationFn& on_relation)
-        {
-            for(const auto& relation : relations)
-                on_relation(relation);
-        });
-        
         LOG(INFO, "Writing cache %s\n", cache.data());
         WriteFBFile(cache, *exporter);
     }
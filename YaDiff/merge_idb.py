@@ -27,6 +27,7 @@ DEFAULT_CONFIG = b"""
         <option CallerXRefMatch_TrustDiffingRelations="true"/>
         <option DoAnalyzeUntilAlgoReturn0="true"/>
         <option DoAnalyzeUntilAnalyzeReturn0="true"/>
+        <option MemoryBudgetMB="0"/>
     </Matching>
 </yadiff>
 """
@@ -6,9 +6,13 @@
 #include "Signature.hpp"
 #include "FileUtils.hpp"
 #include <Configuration.hpp>
+#include <FunctionDiff.hpp>
 #include <YaDiff.hpp>
 #include <Propagate.hpp>
 #include <Algo/Algo.hpp>
+#include <Algo/VectorSign/VectorHelpers.hpp>
+#include <Algo/VectorSign/VectorTypes.hpp>
+#include <MemoryBudget.hpp>
 #include "VersionRelation.hpp"
 #include "BinHex.hpp"
 
@@ -276,6 +280,117 @@ TEST(TestYaDiffLib, TestFirstAssociation_fb)
     TestFirstAssociation_Impl(dbs);
 }
 
+/**
+ * Test colliding signatures association
+ */
+static void TestSigCollisionAssociation_Impl(std::pair<std::shared_ptr<IModel>, std::shared_ptr<IModel>> dbs)
+{
+    auto db1 = dbs.first;
+    auto db2 = dbs.second;
+    std::vector<Relation> relations;
+
+    // colliding signatures are left to propagation by default
+    const auto defaults = Configuration("../../YaDiff/tests/YaDiffLib_test/data/config.xml");
+    yadiff::YaDiff(defaults).MergeDatabases(*db1, *db2, relations);
+    expect_req(relations, {});
+
+    // create YaDiff
+    relations.clear();
+    const auto config = Configuration("../../YaDiff/tests/YaDiffLib_test/data/config_composite.xml");
+    auto differ = yadiff::YaDiff(config);
+    differ.MergeDatabases(*db1, *db2, relations);
+    expect_req(relations, {
+        "max_exact_match_both_function_0000000000000001_function_0000000000000002_all",
+        "max_exact_match_both_function_0000000000000003_function_0000000000000004_all",
+    });
+}
+
+TEST(TestYaDiffLib, TestSigCollisionAssociation_mem)
+{
+    auto dbs = create_memorySignatureDB("TestSigCollision1.xml", "TestSigCollision2.xml");
+    TestSigCollisionAssociation_Impl(dbs);
+}
+
+TEST(TestYaDiffLib, TestSigCollisionAssociation_fb)
+{
+    auto dbs = create_flatBufferSignatureDB("TestSigCollision1.xml", "TestSigCollision2.xml");
+    TestSigCollisionAssociation_Impl(dbs);
+}
+
+/**
+ * Test name association
+ */
+static void TestNameAssociation_Impl(std::pair<std::shared_ptr<IModel>, std::shared_ptr<IModel>> dbs)
+{
+    auto db1 = dbs.first;
+    auto db2 = dbs.second;
+    std::vector<Relation> relations;
+
+    // create YaDiff
+    const auto config = Configuration("../../YaDiff/tests/YaDiffLib_test/data/config_names.xml");
+    auto differ = yadiff::YaDiff(config);
+    differ.MergeDatabases(*db1, *db2, relations);
+    expect_req(relations, {
+        "good_diff_both_function_0000000000000001_function_0000000000000002",
+        "max_exact_match_both_function_0000000000000003_function_0000000000000004_all",
+    });
+}
+
+TEST(TestYaDiffLib, TestNameAssociation_mem)
+{
+    auto dbs = create_memorySignatureDB("TestNameMatch1.xml", "TestNameMatch2.xml");
+    TestNameAssociation_Impl(dbs);
+}
+
+TEST(TestYaDiffLib, TestNameAssociation_fb)
+{
+    auto dbs = create_flatBufferSignatureDB("TestNameMatch1.xml", "TestNameMatch2.xml");
+    TestNameAssociation_Impl(dbs);
+}
+
+/**
+ * Test type association by layout
+ */
+static void TestTypeAssociation_Impl(std::pair<std::shared_ptr<IModel>, std::shared_ptr<IModel>> dbs)
+{
+    auto db1 = dbs.first;
+    auto db2 = dbs.second;
+    std::vector<Relation> relations;
+
+    // create YaDiff
+    const auto config = Configuration("../../YaDiff/tests/YaDiffLib_test/data/config_types.xml");
+    auto differ = yadiff::YaDiff(config);
+    differ.MergeDatabases(*db1, *db2, relations);
+    // point_t & pair_t layouts collide and are split by member names
+    // blob_t layouts differ and are not matched
+    expect_req(relations, {
+        "good_diff_both_enum_0000000000000030_enum_0000000000000080",
+        "good_diff_both_enum_member_0000000000000032_enum_member_0000000000000082",
+        "good_exact_match_both_enum_member_0000000000000031_enum_member_0000000000000081_xref_offset",
+        "max_diff_both_struc_0000000000000010_struc_0000000000000050_caller_xref",
+        "max_diff_both_struc_0000000000000020_struc_0000000000000070_caller_xref",
+        "max_exact_match_both_struc_0000000000000040_struc_0000000000000060_all",
+        "max_exact_match_both_strucmember_0000000000000011_strucmember_0000000000000051_all",
+        "max_exact_match_both_strucmember_0000000000000012_strucmember_0000000000000052_all",
+        "max_exact_match_both_strucmember_0000000000000021_strucmember_0000000000000071_all",
+        "max_exact_match_both_strucmember_0000000000000022_strucmember_0000000000000072_all",
+        "max_exact_match_both_strucmember_0000000000000041_strucmember_0000000000000061_all",
+        "max_exact_match_both_strucmember_0000000000000042_strucmember_0000000000000062_all",
+    });
+}
+
+TEST(TestYaDiffLib, TestTypeAssociation_mem)
+{
+    auto dbs = create_memorySignatureDB("TestTypeMatch1.xml", "TestTypeMatch2.xml");
+    TestTypeAssociation_Impl(dbs);
+}
+
+TEST(TestYaDiffLib, TestTypeAssociation_fb)
+{
+    auto dbs = create_flatBufferSignatureDB("TestTypeMatch1.xml", "TestTypeMatch2.xml");
+    TestTypeAssociation_Impl(dbs);
+}
+
 /**
  * Test basic block association
  */
@@ -404,6 +519,91 @@ TEST(TestYaDiffLib, TestParentXrefOfDataMatch_Impl)
 }
 #endif //0
 
+/**
+ * Test adaptive algorithm scheduler
+ */
+static std::vector<Relation> MergeWith(const std::string& config_name, std::pair<std::shared_ptr<IModel>, std::shared_ptr<IModel>> dbs)
+{
+    std::vector<Relation> relations;
+    const auto config = Configuration("../../YaDiff/tests/YaDiffLib_test/data/" + config_name);
+    auto differ = yadiff::YaDiff(config);
+    differ.MergeDatabases(*dbs.first, *dbs.second, relations);
+    return relations;
+}
+
+TEST(TestYaDiffLib, TestAdaptiveScheduler_fb)
+{
+    for(const auto& files : {std::make_pair("TestXrefOfDataMatch1.xml", "TestXrefOfDataMatch2.xml"),
+                             std::make_pair("TestParentXrefOfDataMatch1.xml", "TestParentXrefOfDataMatch2.xml")})
+    {
+        // same relations as the fixed algorithm loop
+        const auto dbs = create_flatBufferSignatureDB(files.first, files.second);
+        std::multiset<std::string> expected;
+        for(const auto& relation : MergeWith("config.xml", dbs))
+            expected.insert(str(relation));
+        expect_req(MergeWith("config_adaptive.xml", dbs), expected);
+    }
+}
+
+TEST(TestYaDiffLib, TestShardedMatching_fb)
+{
+    for(const auto& files : {std::make_pair("TestXrefOfDataMatch1.xml", "TestXrefOfDataMatch2.xml"),
+                             std::make_pair("TestParentXrefOfDataMatch1.xml", "TestParentXrefOfDataMatch2.xml"),
+                             std::make_pair("TestMatchBasicBlock1.xml", "TestMatchBasicBlock2.xml"),
+                             std::make_pair("TestConflict1.xml", "TestConflict2.xml"),
+                             std::make_pair("TestSigCollision1.xml", "TestSigCollision2.xml")})
+    {
+        // sharded passes find the same relations as the sequential loop, in the same order
+        const auto dbs = create_flatBufferSignatureDB(files.first, files.second);
+        std::vector<std::string> expected;
+        for(const auto& relation : MergeWith("config.xml", dbs))
+            expected.push_back(str(relation));
+        std::vector<std::string> got;
+        for(const auto& relation : MergeWith("config_sharded.xml", dbs))
+            got.push_back(str(relation));
+        EXPECT_EQ(expected, got);
+    }
+}
+
+TEST(TestYaDiffLib, TestSchedulerTimeBudget_fb)
+{
+    // only exact match runs before the budget is spent
+    const auto dbs = create_flatBufferSignatureDB("TestXrefOfDataMatch1.xml", "TestXrefOfDataMatch2.xml");
+    expect_req(MergeWith("config_budget.xml", dbs), {
+        "max_exact_match_both_data_0000000000000020_data_0000000000000021",
+    });
+}
+
+/**
+ * Test global conflict resolution
+ */
+TEST(TestYaDiffLib, TestConflictFirstComeFirstServed_fb)
+{
+    // name & signature disagree on foo, both relations are poisoned
+    const auto dbs = create_flatBufferSignatureDB("TestConflict1.xml", "TestConflict2.xml");
+    expect_req(MergeWith("config_names.xml", dbs), {
+        "max_exact_match_both_function_0000000000000003_function_0000000000000006_all",
+        "max_untrustable_both_function_0000000000000001_function_0000000000000002",
+        "max_untrustable_both_function_0000000000000001_function_0000000000000004",
+    });
+}
+
+TEST(TestYaDiffLib, TestConflictResolution_fb)
+{
+    // the exact match outweighs the name diff
+    const auto dbs = create_flatBufferSignatureDB("TestConflict1.xml", "TestConflict2.xml");
+    expect_req(MergeWith("config_conflicts.xml", dbs), {
+        "max_exact_match_both_function_0000000000000001_function_0000000000000002_all",
+        "max_exact_match_both_function_0000000000000003_function_0000000000000006_all",
+    });
+
+    // resolved after all algorithms, so the relation is never walked
+    expect_req(MergeWith("config_conflicts_greedy.xml", dbs), {
+        "max_exact_match_both_function_0000000000000001_function_0000000000000002",
+        "max_exact_match_both_function_0000000000000003_function_0000000000000006_all",
+    });
+}
+
 namespace
 {
 void checkFilesContentEqual(std::string file1, fs::path file2)
@@ -970,3 +1170,442 @@ TEST(TestYaDiffLib, TestAnalyseExternalMappingMatch2)
     auto dbs = create_flatBufferSignatureDB("TestExternalMappingMatch1.xml", "TestExternalMappingMatch2.xml");
     TestExternalMappingMatch2_Impl(dbs);
 }
+
+namespace
+{
+std::vector<Relation> analyse_external_mapping(const std::pair<std::shared_ptr<IModel>, std::shared_ptr<IModel>>& dbs, const std::string& mapping_file)
+{
+    yadiff::AlgoCfg config;
+    memset(&config, 0, sizeof config);
+    config.Algo = yadiff::ALGO_EXTERNAL_MAPPING_MATCH;
+    config.ExternalMappingMatch.MappingFilePath = mapping_file.data();
+    auto algo = yadiff::MakeDiffAlgo(config);
+    std::vector<Relation> relations;
+    EXPECT_TRUE(algo->Prepare(*dbs.first, *dbs.second));
+    const yadiff::RelationWalkerfn input;
+    EXPECT_TRUE(algo->Analyse([&](const Relation& relation)
+    {
+        relations.emplace_back(relation);
+        return true;
+    }, input));
+    return relations;
+}
+
+void append_le(std::string& dst, uint64_t value, size_t size)
+{
+    for(size_t i = 0; i < size; ++i)
+        dst += static_cast<char>(value >> (i * 8));
+}
+}
+
+TEST(TestYaDiffLib, TestAnalyseExternalMappingMatchFormats)
+{
+    auto dbs = create_flatBufferSignatureDB("TestExternalMappingMatch1.xml", "TestExternalMappingMatch2.xml");
+    const std::multiset<std::string> expected = {
+        "good_diff_both_basic_block_0000000022345678_basic_block_0000000022345688",
+        "good_diff_both_basic_block_0000000032345678_basic_block_0000000032345688",
+        "good_exact_match_both_basic_block_0000000012345678_basic_block_0000000012345688",
+    };
+    const auto tmp = fs::temp_directory_path();
+
+    // hex & decimal addresses, comments, type filters & duplicates
+    const auto csv_file = (tmp / "yadiff_external_mapping.csv").generic_string();
+    {
+        std::ofstream csv(csv_file);
+        csv << "# src,dst,type\n"
+            << "0xbc614e, 0xbc6158\n"
+            << "22345678,22345688,basic_block\n"
+            << "22345678,42345688,basic_block\n"
+            << "\n"
+            << "0x1ed8e4e,0x1ed8e58 # trailing comment\n"
+            << "0x28624ce,0x28624d8,function\n"
+            << "not_an_address,0x28624d8\n";
+    }
+    expect_req(analyse_external_mapping(dbs, csv_file), expected);
+    fs::remove(csv_file);
+
+    const auto bin_file = (tmp / "yadiff_external_mapping.bin").generic_string();
+    {
+        std::string data = "yamap001";
+        const auto append = [&](uint64_t src, uint64_t dst, YaToolObjectType_e type)
+        {
+            append_le(data, src, sizeof src);
+            append_le(data, dst, sizeof dst);
+            append_le(data, type, sizeof(uint32_t));
+        };
+        append(12345678, 12345688, OBJECT_TYPE_UNKNOWN);
+        append(22345678, 22345688, OBJECT_TYPE_BASIC_BLOCK);
+        append(32345678, 32345688, OBJECT_TYPE_UNKNOWN);
+        append(42345678, 42345688, OBJECT_TYPE_FUNCTION);
+        std::ofstream bin(bin_file, std::ios::binary);
+        bin.write(data.data(), data.size());
+    }
+    expect_req(analyse_external_mapping(dbs, bin_file), expected);
+    fs::remove(bin_file);
+}
+
+namespace
+{
+void create_segment(IModelVisitor& v, YaToolObjectId id, offset_t ea, const char* name, const char* perm, const std::vector<uint8_t>& bytes)
+{
+    const auto chunk_id = id + 1;
+    v.visit_start_version(OBJECT_TYPE_SEGMENT, id);
+    v.visit_address(ea);
+    v.visit_size(0x100);
+    v.visit_name(make_string_ref(name), 0);
+    v.visit_start_xrefs();
+    v.visit_start_xref(0, chunk_id, 0);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_attribute(make_string_ref("perm"), make_string_ref(perm));
+    v.visit_end_version();
+
+    // two blobs with a hole in between
+    v.visit_start_version(OBJECT_TYPE_SEGMENT_CHUNK, chunk_id);
+    v.visit_parent_id(id);
+    v.visit_address(ea);
+    v.visit_size(0x100);
+    v.visit_blob(0, &bytes[0], bytes.size());
+    v.visit_blob(0x10, &bytes[0], bytes.size());
+    v.visit_end_version();
+}
+}
+
+TEST(TestYaDiffLib, TestCodeImage)
+{
+    const std::vector<uint8_t> bytes = {1, 2, 3, 4, 5, 6, 7, 8};
+    const auto db = MakeMemoryModel();
+    db->visit_start();
+    create_segment(*db, 0x100, 0x1000, "CODE", "5", bytes);
+    create_segment(*db, 0x200, 0x2000, ".text", "6", bytes);
+    db->visit_end();
+
+    yadiff::CodeImage_t image;
+    yadiff::SetCodeImage(image, *db);
+
+    // only the executable segment is mapped, whatever its name
+    EXPECT_EQ(bytes.size() * 2, image.Size());
+    std::vector<uint8_t> scratch;
+    EXPECT_EQ(nullptr, image.Read(0x2000, 4, scratch));
+    EXPECT_EQ(nullptr, image.Read(0x1008, 8, scratch));
+
+    // ranges inside one blob are not copied
+    const auto inside = image.Read(0x1012, 4, scratch);
+    ASSERT_NE(nullptr, inside);
+    EXPECT_TRUE(scratch.empty());
+    EXPECT_EQ(std::vector<uint8_t>({3, 4, 5, 6}), std::vector<uint8_t>(inside, inside + 4));
+
+    // ranges across blobs are zero-filled in holes
+    const auto across = image.Read(0x1006, 12, scratch);
+    ASSERT_NE(nullptr, across);
+    EXPECT_EQ(std::vector<uint8_t>({7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2}), std::vector<uint8_t>(across, across + 12));
+}
+
+namespace
+{
+// amd64 function at ea: a prologue calling target, then a block returning value
+void create_function(IModelVisitor& v, offset_t ea, offset_t target, uint8_t value, bool extra)
+{
+    const auto call = static_cast<uint32_t>(target - (ea + 9));
+    std::vector<uint8_t> bytes = {
+        0x55,                               // push rbp
+        0x48, 0x89, 0xE5,                   // mov rbp, rsp
+        0xE8, static_cast<uint8_t>(call), static_cast<uint8_t>(call >> 8),
+              static_cast<uint8_t>(call >> 16), static_cast<uint8_t>(call >> 24),
+        0xB8, value, 0x00, 0x00, 0x00,      // mov eax, value
+        0x5D,                               // pop rbp
+        0xC3,                               // ret
+        0x90,                               // nop
+        0xC3,                               // ret
+    };
+
+    v.visit_start_version(OBJECT_TYPE_BINARY, 0x10);
+    v.visit_address(ea);
+    v.visit_attribute(make_string_ref("format"), make_string_ref("AMD64"));
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_SEGMENT, 0x20);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_start_xrefs();
+    v.visit_start_xref(0, 0x21, 0);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_attribute(make_string_ref("perm"), make_string_ref("5"));
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_SEGMENT_CHUNK, 0x21);
+    v.visit_parent_id(0x20);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_blob(0, &bytes[0], bytes.size());
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_FUNCTION, 0x30);
+    v.visit_address(ea);
+    v.visit_size(extra ? 18 : 16);
+    v.visit_start_xrefs();
+    v.visit_start_xref(0, 0x31, 0);
+    v.visit_end_xref();
+    v.visit_start_xref(9, 0x32, 0);
+    v.visit_end_xref();
+    if(extra)
+    {
+        v.visit_start_xref(16, 0x33, 0);
+        v.visit_end_xref();
+    }
+    v.visit_end_xrefs();
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_BASIC_BLOCK, 0x31);
+    v.visit_parent_id(0x30);
+    v.visit_address(ea);
+    v.visit_size(9);
+    v.visit_start_xrefs();
+    v.visit_start_xref(9, 0x32, 0);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_BASIC_BLOCK, 0x32);
+    v.visit_parent_id(0x30);
+    v.visit_address(ea + 9);
+    v.visit_size(7);
+    v.visit_end_version();
+
+    if(!extra)
+        return;
+    v.visit_start_version(OBJECT_TYPE_BASIC_BLOCK, 0x33);
+    v.visit_parent_id(0x30);
+    v.visit_address(ea + 16);
+    v.visit_size(2);
+    v.visit_end_version();
+}
+}
+
+TEST(TestYaDiffLib, TestFunctionDiff)
+{
+    const auto db1 = MakeMemoryModel();
+    db1->visit_start();
+    create_function(*db1, 0x1000, 0x1800, 0x2A, false);
+    db1->visit_end();
+
+    // relocated, with another call target, another constant & one more block
+    const auto db2 = MakeMemoryModel();
+    db2->visit_start();
+    create_function(*db2, 0x2000, 0x2900, 0x2B, true);
+    db2->visit_end();
+
+    const auto function = [](const IModel& db)
+    {
+        return db.get(0x30);
+    };
+    const Relation relation = {function(*db1), function(*db2), RELATION_TYPE_EXACT_MATCH, RELATION_CONFIDENCE_MAX, RELATION_DIRECTION_BOTH, 0};
+
+    const auto same = yadiff::DiffFunctions(*db1, *db1, {{function(*db1), function(*db1), RELATION_TYPE_EXACT_MATCH, RELATION_CONFIDENCE_MAX, RELATION_DIRECTION_BOTH, 0}});
+    ASSERT_EQ(1u, same.size());
+    EXPECT_TRUE(same[0].is_identical());
+    EXPECT_EQ(6u, same[0].same);
+    EXPECT_TRUE(same[0].instructions.empty());
+
+    const auto diffs = yadiff::DiffFunctions(*db1, *db2, {relation});
+    ASSERT_EQ(1u, diffs.size());
+    const auto& diff = diffs[0];
+    EXPECT_FALSE(diff.is_identical());
+    EXPECT_EQ(5u, diff.same);
+    EXPECT_EQ(1u, diff.modified);
+    EXPECT_EQ(2u, diff.added);
+    EXPECT_EQ(0u, diff.removed);
+
+    // call targets are normalized, the constant is not
+    ASSERT_EQ(3u, diff.blocks.size());
+    EXPECT_EQ(yadiff::CHANGE_NONE, diff.blocks[0].change);
+    EXPECT_EQ(yadiff::CHANGE_MODIFIED, diff.blocks[1].change);
+    EXPECT_EQ(2u, diff.blocks[1].same);
+    EXPECT_EQ(yadiff::CHANGE_ADDED, diff.blocks[2].change);
+    EXPECT_EQ(0x33u, diff.blocks[2].block2);
+
+    ASSERT_EQ(3u, diff.instructions.size());
+    EXPECT_EQ(0x1009u, diff.instructions[0].address1);
+    EXPECT_EQ(0x2009u, diff.instructions[0].address2);
+    EXPECT_EQ(yadiff::CHANGE_MODIFIED, diff.instructions[0].change);
+    EXPECT_EQ(0x2010u, diff.instructions[1].address2);
+    EXPECT_EQ(yadiff::CHANGE_ADDED, diff.instructions[2].change);
+
+    // untrusted relations are ignored
+    auto untrusted = relation;
+    untrusted.type_ = RELATION_TYPE_UNTRUSTABLE;
+    EXPECT_TRUE(yadiff::DiffFunctions(*db1, *db2, {untrusted}).empty());
+}
+
+namespace
+{
+// amd64 function at ea with a single block made of bytes
+// & one xref from offset to a data object at target
+void create_block_function(IModelVisitor& v, offset_t ea, const std::vector<uint8_t>& bytes, offset_t offset, offset_t target)
+{
+    v.visit_start_version(OBJECT_TYPE_BINARY, 0x10);
+    v.visit_address(ea);
+    v.visit_attribute(make_string_ref("format"), make_string_ref("AMD64"));
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_SEGMENT, 0x20);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_start_xrefs();
+    v.visit_start_xref(0, 0x21, 0);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_attribute(make_string_ref("perm"), make_string_ref("5"));
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_SEGMENT_CHUNK, 0x21);
+    v.visit_parent_id(0x20);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_blob(0, &bytes[0], bytes.size());
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_FUNCTION, 0x30);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_start_xrefs();
+    v.visit_start_xref(0, 0x31, 0);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_BASIC_BLOCK, 0x31);
+    v.visit_parent_id(0x30);
+    v.visit_address(ea);
+    v.visit_size(bytes.size());
+    v.visit_start_xrefs();
+    v.visit_start_xref(offset, 0x40, 1);
+    v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_end_version();
+
+    v.visit_start_version(OBJECT_TYPE_DATA, 0x40);
+    v.visit_address(target);
+    v.visit_size(4);
+    v.visit_end_version();
+}
+
+std::vector<uint8_t> block_bytes(uint8_t disp, uint8_t rip, uint32_t target, uint8_t value)
+{
+    return {
+        0xFF, 0x50, disp,                   // call qword ptr [rax + disp]
+        0xC7, 0x05, rip, 0x00, 0x00, 0x00,  // mov dword ptr [rip + rip], value
+              value, 0x00, 0x00, 0x00,
+        0xB9, static_cast<uint8_t>(target), static_cast<uint8_t>(target >> 8),
+              static_cast<uint8_t>(target >> 16), static_cast<uint8_t>(target >> 24),
+                                            // mov ecx, target
+        0xC3,                               // ret
+    };
+}
+}
+
+TEST(TestYaDiffLib, TestFunctionDiffImmediates)
+{
+    // relocated with other pc-relative displacement & data address
+    const auto db1 = MakeMemoryModel();
+    db1->visit_start();
+    create_block_function(*db1, 0x1000, block_bytes(0x10, 0x40, 0x8000, 0x2A), 13, 0x8000);
+    db1->visit_end();
+
+    const auto same = MakeMemoryModel();
+    same->visit_start();
+    create_block_function(*same, 0x2000, block_bytes(0x10, 0x80, 0x9000, 0x2A), 13, 0x9000);
+    same->visit_end();
+
+    // another call displacement & another immediate next to a pc-relative operand
+    const auto changed = MakeMemoryModel();
+    changed->visit_start();
+    create_block_function(*changed, 0x2000, block_bytes(0x18, 0x80, 0x9000, 0x2B), 13, 0x9000);
+    changed->visit_end();
+
+    const auto relation = [&](const IModel& db)
+    {
+        return Relation{db1->get(0x30), db.get(0x30), RELATION_TYPE_EXACT_MATCH, RELATION_CONFIDENCE_MAX, RELATION_DIRECTION_BOTH, 0};
+    };
+
+    const auto relocated = yadiff::DiffFunctions(*db1, *same, {relation(*same)});
+    ASSERT_EQ(1u, relocated.size());
+    EXPECT_TRUE(relocated[0].is_identical());
+    EXPECT_EQ(4u, relocated[0].same);
+
+    const auto diffs = yadiff::DiffFunctions(*db1, *changed, {relation(*changed)});
+    ASSERT_EQ(1u, diffs.size());
+    EXPECT_FALSE(diffs[0].is_identical());
+    EXPECT_EQ(2u, diffs[0].same);
+    EXPECT_EQ(2u, diffs[0].modified);
+    ASSERT_EQ(2u, diffs[0].instructions.size());
+    EXPECT_EQ(0x1000u, diffs[0].instructions[0].address1);
+    EXPECT_EQ(0x1003u, diffs[0].instructions[1].address1);
+}
+
+TEST(TestYaDiffLib, TestMoments)
+{
+    const std::vector<double> values  = {1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16, 1e9 + 7};
+    const std::vector<double> weights = {1, 2, 0, 3, 0.5};
+
+    // two-pass reference, values are shifted to stay exact
+    double weight = 0;
+    double mean = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        weight += weights[i];
+        mean += weights[i] * (values[i] - 1e9);
+    }
+    mean /= weight;
+    double central[5] = {};
+    for (size_t i = 0; i < values.size(); ++i)
+        for (size_t k = 2; k < 5; ++k)
+            central[k] += weights[i] * pow(values[i] - 1e9 - mean, static_cast<double>(k)) / weight;
+
+    yadiff::Moments_t<double> moments;
+    for (size_t i = 0; i < values.size(); ++i)
+        moments.Add(values[i], weights[i]);
+    EXPECT_DOUBLE_EQ(weight, moments.Weight());
+    EXPECT_NEAR(mean + 1e9, moments.Mean(), 1e-6);
+    for (size_t k = 2; k < 5; ++k)
+        EXPECT_NEAR(central[k], moments.Central(k), 1e-6 * fabs(central[k]));
+    EXPECT_NEAR(central[2] + 4, moments.Variance(moments.Mean() + 2), 1e-6);
+
+    // integer inputs
+    yadiff::Moments_t<int> ints;
+    for (int i : {2, 4, 4, 4, 5, 5, 7, 9})
+        ints.Add(i);
+    EXPECT_DOUBLE_EQ(5, ints.Mean());
+    EXPECT_DOUBLE_EQ(2, sqrt(ints.Central(2)));
+    EXPECT_DOUBLE_EQ(2, yadiff::GetVariance(std::vector<int>{2, 4, 4, 4, 5, 5, 7, 9}, 5));
+}
+
+TEST(TestYaDiffLib, TestMemoryBudgetSpill)
+{
+    yadiff::MemoryBudget budget(64 * 1024);
+    {
+        // first buffers fit in ram, bigger ones spill
+        yadiff::SpillVector<uint64_t> values(&budget);
+        for (uint64_t i = 0; i < 100000; ++i)
+            values.push_back(i * 3);
+        EXPECT_GT(budget.Spilled(), 0u);
+        EXPECT_LE(budget.Used(), budget.Limit());
+        ASSERT_EQ(100000u, values.size());
+        for (uint64_t i = 0; i < values.size(); ++i)
+            ASSERT_EQ(i * 3, values[i]);
+
+        yadiff::FeatureMatrix_t features;
+        features.Reset(4096, FunctionData_FIELD_COUNT, &budget);
+        for (size_t row = 0; row < features.Rows(); ++row)
+            for (size_t col = 0; col < features.Cols(); ++col)
+                EXPECT_EQ(0., features.Row(row)[col]);
+        features.Row(4095)[1] = 42;
+        EXPECT_EQ(42., features.Row(4095)[1]);
+    }
+
+    // everything is released with its owner
+    EXPECT_EQ(0u, budget.Used());
+    EXPECT_EQ(0u, budget.Spilled());
+    EXPECT_GT(budget.Peak(), 0u);
+}
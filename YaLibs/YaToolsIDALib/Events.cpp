@@ -26,12 +26,13 @@
 #include "XmlAccept.hpp"
 #include "MemoryModel.hpp"
 #include "Yatools.hpp"
-#include "XmlVisitor.hpp"
 #include "IdaVisitor.hpp"
 #include "IModelSink.hpp"
 #include "IdaModel.hpp"
 #include "Strucs.hpp"
 #include "Git.hpp"
+#include "CacheDelta.hpp"
+#include "SavePipeline.hpp"
 
 #include <unordered_set>
 #include <regex>
@@ -114,9 +115,14 @@ namespace
         void save               () override;
         void update             () override;
         void touch              () override;
+        bool flush              () override;
+        bool is_saving          () override;
+        bool load               (const IModel& cache) override;
+        void checkpoint         () override;
 
-        IRepository&    repo_;
-        Pool<qstring>   qpool_;
+        IRepository&                    repo_;
+        Pool<qstring>                   qpool_;
+        std::shared_ptr<ISavePipeline>  saves_;
 
         Eas             eas_;
         Structs         strucs_;
@@ -216,10 +222,24 @@ namespace
     }
 }
 
+namespace
+{
+    // maximum number of exported snapshots waiting for serialization
+    const size_t MAX_PENDING_SAVES = 2;
+}
+
 Events::Events(IRepository& repo)
     : repo_(repo)
     , qpool_(3)
 {
+    // only the ida export needs the main thread,
+    // xml serialization, file writes & commits run in background
+    // one writer for every save, its workers outlive a single export
+    const auto save = MakeXmlCacheSave(repo.get_cache(), repo.get_cache_writer(), [&repo]
+    {
+        return repo.commit_cache();
+    });
+    saves_ = MakeSavePipeline(save, MAX_PENDING_SAVES);
     snapshot_local_types(ltypes_);
 }
 
@@ -690,7 +710,7 @@ namespace
             save_eas(ev, *model, *db);
         }
         db->visit_end();
-        db->accept(*MakeXmlVisitor(ev.repo_.get_cache()));
+        ev.saves_->post(db);
 
         const auto time_end = std::chrono::system_clock::now();
         const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(time_end - time_start).count();
@@ -702,11 +722,6 @@ namespace
 void Events::save()
 {
     ::save(*this);
-    if(!repo_.commit_cache())
-    {
-        LOG(WARNING, "An error occurred during YaCo commit\n");
-        warning("An error occured during YaCo commit: please relaunch IDA");
-    }
     eas_.clear();
     strucs_.clear();
     struc_members_.clear();
@@ -800,19 +815,15 @@ namespace
         });
     }
 
-    std::shared_ptr<IModel> get_all_updates(IRepository& repo, const IModel& updated, const IModel& deleted)
+    std::shared_ptr<IModel> get_all_updates(const IModel& full, const IModel& updated, const IModel& deleted)
     {
         // two things we need to watch for:
         // * applying a struc in a basic block, make sure the struc is reloaded
         // * deleting a struc member, make sure parent struc is reloaded
 
-        // load all xml files into a model we can query
-        const auto full = MakeMemoryModel();
-        AcceptXmlCache(*full, repo.get_cache());
-
         // prepare final updated model
         const auto all_updates = MakeMemoryModel();
-        DepCtx deps(*full, *all_updates);
+        DepCtx deps(full, *all_updates);
         all_updates->visit_start();
 
         // add deleted parents
@@ -918,6 +929,12 @@ namespace
         });
     }
 
+    void apply_delta(IModelSink& sink, const IModel& full, const CacheDelta& delta)
+    {
+        sink.remove(*delta.deleted);
+        sink.update(*get_all_updates(full, *delta.updated, *delta.deleted));
+    }
+
     bool update_from_cache(IModelSink& sink, IRepository& repo)
     {
         ObsoletePaths obsoletes;
@@ -925,34 +942,67 @@ namespace
         if(commit.empty())
             return false;
 
-        // load updated & deleted entities
-        const auto updated = MakeMemoryModel();
-        const auto deleted = MakeMemoryModel();
-        updated->visit_start();
-        deleted->visit_start();
+        // collect updated & deleted blobs
+        std::vector<CacheBlob> blobs;
         repo.diff_index(commit, [&](const char* path, bool added, const void* ptr, size_t size)
         {
             LOG(DEBUG, "rebase: path %s %s size %zd\n", path, added ? "updated" : "deleted", size);
             if(obsoletes.count(path))
                 return 0;
-            AcceptXmlMemoryChunk(added ? *updated : *deleted, ptr, size);
+            blobs.push_back({std::string(static_cast<const char*>(ptr), size), added});
             return 0;
         });
-        deleted->visit_end();
-        updated->visit_end();
-        if(!updated->size() && !deleted->size())
+
+        const auto delta = cache::parse_blobs(blobs);
+        blobs.clear();
+        if(!delta.updated->size() && !delta.deleted->size())
             return false;
 
+        // load all xml files into a model we can query
+        const auto full = MakeMemoryModel();
+        AcceptXmlCache(*full, repo.get_cache());
+
         // apply changes on ida
-        LOG(INFO, "rebase: %zd updated %zd deleted\n", updated->size(), deleted->size());
-        sink.remove(*deleted);
-        sink.update(*get_all_updates(repo, *updated, *deleted));
+        LOG(INFO, "rebase: %zd updated %zd deleted\n", delta.updated->size(), delta.deleted->size());
+        apply_delta(sink, *full, delta);
         return true;
     }
+
+    // user netnodes need a $ prefix
+    const char checkpoint_netnode[] = "$ yaco_checkpoint";
+
+    std::string get_idb_checkpoint()
+    {
+        const netnode node(checkpoint_netnode);
+        if(node == BADNODE)
+            return std::string();
+
+        qstring buf;
+        const auto n = node.valstr(&buf);
+        return n > 0 ? std::string(buf.c_str()) : std::string();
+    }
+}
+
+bool Events::flush()
+{
+    if(saves_->flush())
+        return true;
+
+    LOG(WARNING, "An error occurred during YaCo commit\n");
+    warning("An error occured during YaCo commit: please relaunch IDA");
+    return false;
+}
+
+bool Events::is_saving()
+{
+    return !saves_->idle();
 }
 
 void Events::update()
 {
+    // rebase on top of every saved snapshot
+    flush();
+
     // update cache and export modifications to IDA
     const auto updated = update_from_cache(*MakeIdaSink(), repo_);
     if(updated)
@@ -972,6 +1022,41 @@ void Events::update()
         LOG(INFO, "ida: analyzed in %d seconds\n", static_cast<int>(elapsed));
 }
 
+bool Events::load(const IModel& cache)
+{
+    const auto checkpoint = get_idb_checkpoint();
+    if(checkpoint.empty())
+    {
+        LOG(INFO, "cache: no checkpoint in idb, replaying whole cache\n");
+        return false;
+    }
+
+    CacheDelta delta;
+    if(!repo_.diff_checkpoint(delta, checkpoint))
+    {
+        LOG(INFO, "cache: untrusted checkpoint, replaying whole cache\n");
+        return false;
+    }
+
+    LOG(INFO, "cache: %zd updated %zd deleted since checkpoint\n", delta.updated->size(), delta.deleted->size());
+    if(delta.updated->size() || delta.deleted->size())
+        apply_delta(*MakeIdaSink(), cache, delta);
+    return true;
+}
+
+void Events::checkpoint()
+{
+    flush();
+
+    // remember which cache state this idb reflects
+    const auto checkpoint = repo_.get_checkpoint();
+    if(checkpoint.empty())
+        return;
+
+    netnode node(checkpoint_netnode, 0, true);
+    node.set(checkpoint.data(), checkpoint.size());
+}
+
 void Events::touch()
 {
     repo_.touch();
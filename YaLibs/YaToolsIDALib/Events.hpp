@@ -18,6 +18,7 @@
 #include <memory>
 
 struct IRepository;
+struct IModel;
 
 struct IEvents
 {
@@ -31,9 +32,21 @@ struct IEvents
     virtual void touch_ea   (ea_t ea) = 0;
     virtual void touch_types() = 0;
 
+    // export touched objects & queue them for background serialization
     virtual void save               () = 0;
     virtual void update             () = 0;
     virtual void touch              () = 0;
+
+    // wait for queued saves, must be called before any other repository operation
+    virtual bool flush              () = 0;
+
+    // true while queued saves are serialized & committed, never blocks
+    virtual bool is_saving          () = 0;
+
+    // apply cache changes since the checkpoint saved in idb,
+    // false when no checkpoint can be trusted & whole cache must be replayed
+    virtual bool load               (const IModel& cache) = 0;
+    virtual void checkpoint         () = 0;
 };
 
 std::shared_ptr<IEvents> MakeEvents(IRepository& repo);
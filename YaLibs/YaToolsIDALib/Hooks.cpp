@@ -21,6 +21,7 @@
 #include "Yatools.hpp"
 #include "YaHelpers.hpp"
 #include "Strucs.hpp"
+#include "Hash.hpp"
 
 #include <math.h>
 
@@ -264,9 +265,12 @@ namespace
         void unhook() override;
 
         void save_and_update();
+        void update();
+        void cancel_update();
 
         IEvents& events_;
         bool     enabled_;
+        qtimer_t update_timer_; // pending update, once saves are committed
     };
 }
 
@@ -280,14 +284,49 @@ void Hooks::unhook()
     enabled_ = false;
 }
 
+namespace
+{
+    // delay between checks for committed saves
+    const int UPDATE_POLL_MS = 100;
+
+    int idaapi on_update_timer(void* user_data)
+    {
+        auto& hooks = *static_cast<Hooks*>(user_data);
+        if(hooks.enabled_ && hooks.events_.is_saving())
+            return UPDATE_POLL_MS;
+
+        // updates are dropped while yaco is unhooked
+        hooks.update_timer_ = nullptr;
+        if(hooks.enabled_)
+            hooks.update();
+        return -1;
+    }
+}
+
 void Hooks::save_and_update()
 {
+    // serialization & commits run in background,
+    // update on a later tick so ida never waits for them
     events_.save();
+    if(!update_timer_)
+        update_timer_ = register_timer(UPDATE_POLL_MS, &on_update_timer, this);
+}
+
+void Hooks::update()
+{
     unhook();
     events_.update();
+    events_.checkpoint();
     hook();
 }
 
+void Hooks::cancel_update()
+{
+    if(update_timer_)
+        unregister_timer(update_timer_);
+    update_timer_ = nullptr;
+}
+
 namespace
 {
     qstring to_hex(uint64_t ea)
@@ -337,6 +376,11 @@ namespace
     void closebase(Hooks& hooks, va_list /*args*/)
     {
         LOG_IDB_EVENT("closebase");
+        // push saves still waiting for their update
+        const auto pending = hooks.update_timer_ && hooks.enabled_;
+        hooks.cancel_update();
+        if(pending)
+            hooks.update();
         hooks.enabled_ = false;
     }
 
@@ -848,11 +892,20 @@ namespace
         hooks.events_.touch_ea(s->start_ea);
     }
 
-    void allsegs_moved(Hooks& /*hooks*/, va_list args)
+    void allsegs_moved(Hooks& hooks, va_list args)
     {
         const auto info = va_arg(args, segm_move_infos_t*);
         LOG_IDB_EVENT("allsegs_moved");
         UNUSED(info);
+        if(!hash::has_relative_ids())
+            return;
+
+        // relative ids & addresses are unchanged, touch first segment
+        // so that its parent binary object records the new image base
+        hash::set_relative_ids(true, get_imagebase());
+        const auto seg = get_first_seg();
+        if(seg)
+            hooks.events_.touch_ea(seg->start_ea);
     }
 
     void func_added(Hooks& hooks, va_list args)
@@ -1230,6 +1283,7 @@ namespace
 Hooks::Hooks(IEvents& events)
     : events_(events)
     , enabled_(false)
+    , update_timer_(nullptr)
 {
     if(false)
         hook_to_notification_point(HT_IDP, &idp_event_handler, this);
@@ -1240,6 +1294,7 @@ Hooks::Hooks(IEvents& events)
 
 Hooks::~Hooks()
 {
+    cancel_update();
     unhook_from_notification_point(HT_IDP, &idp_event_handler, this);
     unhook_from_notification_point(HT_DBG, &dbg_event_handler, this);
     unhook_from_notification_point(HT_IDB, &idb_event_handler, this);
@@ -97,7 +97,7 @@ namespace
 
     void delete_function(const HVersion& hver)
     {
-        const auto ea = static_cast<ea_t>(hver.address());
+        const auto ea = ya::to_absolute_ea(hver.type(), hver.address());
         const auto ok = del_func(ea);
         if(!ok)
             LOG(ERROR, "unable to delete func 0x%0" EA_SIZE PRIXEA "\n", ea);
@@ -121,7 +121,7 @@ namespace
 
     void delete_chunk(const HVersion& hver, const char* where, int nmax)
     {
-        const auto ea   = static_cast<ea_t>(hver.address());
+        const auto ea   = ya::to_absolute_ea(hver.type(), hver.address());
         const auto end  = static_cast<ea_t>(ea + hver.size());
         for(auto it = ea; it < end; it = get_item_end(it))
             reset_ea(it, nmax);
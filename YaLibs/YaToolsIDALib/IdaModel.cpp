@@ -19,6 +19,7 @@
 #include "IdaModel.hpp"
 #include "IModelVisitor.hpp"
 #include "Hash.hpp"
+#include "RelativeIds.hpp"
 #include "YaHelpers.hpp"
 #include "Pool.hpp"
 #include "Plugins.hpp"
@@ -245,7 +246,7 @@ namespace
         v.visit_start_version(type, id);
         if(parent)
             v.visit_parent_id(parent);
-        v.visit_address(offset_from_ea(ea));
+        v.visit_address(offset_from_ea(ya::to_relative_ea(type, ea)));
     }
 
     void finish_object(IModelVisitor& v)
@@ -1685,6 +1686,8 @@ namespace
         char file_type[256];
         const auto size = get_file_type_name(file_type, sizeof file_type);
         v.visit_attribute(g_format, {file_type, size});
+        if(hash::has_relative_ids())
+            v.visit_attribute(relative_ids::key, relative_ids::value);
     }
 
     template<typename Ctx>
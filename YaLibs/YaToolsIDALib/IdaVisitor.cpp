@@ -2137,7 +2137,7 @@ namespace
 
     void update_version(Visitor& visitor, const HVersion& version)
     {
-        const auto ea = static_cast<ea_t>(version.address());
+        const auto ea = ya::to_absolute_ea(version.type(), version.address());
         switch(version.type())
         {
             case OBJECT_TYPE_UNKNOWN:
@@ -18,7 +18,9 @@
 #include "Repository.hpp"
 
 #include "Merger.hpp"
+#include "CacheDelta.hpp"
 #include "Git.hpp"
+#include "FileWriter.hpp"
 #include "Yatools.hpp"
 #include "Utils.hpp"
 #include "Helpers.h"
@@ -26,8 +28,11 @@
 #include "YaHelpers.hpp"
 
 #include <libxml/xmlreader.h>
+#include <algorithm>
 #include <regex>
 #include <fstream>
+#include <mutex>
+#include <sstream>
 
 #ifdef _MSC_VER
 #   include <filesystem>
@@ -227,6 +232,7 @@ namespace
 
         // IRepository
         std::string get_cache() override;
+        std::shared_ptr<IFileWriter> get_cache_writer() override;
         void        add_comment(const std::string& msg) override;
         bool        check_valid_cache_startup() override; // can stop IDA
         std::string update_cache(IPatcher& patcher, const on_fixup_fn& on_fixup) override;
@@ -235,6 +241,8 @@ namespace
         void        sync_and_push_original_idb() override;
         void        discard_and_pull_idb() override;
         void        diff_index(const std::string& from, const on_blob_fn& on_blob) const override;
+        std::string get_checkpoint() override;
+        bool        diff_checkpoint(CacheDelta& delta, const std::string& checkpoint) override;
         bool        idb_is_tracked();
         void        push() override;
         void        touch() override;
@@ -249,13 +257,57 @@ namespace
         // wrappers
         bool has_remote(const std::string& remote);
 
-        std::shared_ptr<IGit>   git_;
-        std::set<std::string>   comments_;
-        bool                    repo_auto_sync_;
-        bool                    include_idb_;
-        bool                    is_tracked_;
+        std::shared_ptr<IGit>           git_;
+        std::shared_ptr<IFileWriter>    files_;
+        std::mutex                      comments_mutex_;    // commits run on the save pipeline thread
+        std::set<std::string>           comments_;
+        bool                            repo_auto_sync_;
+        bool                            include_idb_;
+        bool                            is_tracked_;
     };
 
+    // yaco.scope lists object types checked out from cache, like "struct enum local_type"
+    // other cache objects are fetched & committed but never written nor parsed locally
+    std::vector<std::string> get_cache_scope(IGit& git, const std::string& cache)
+    {
+        auto value = git.config_get_string("yaco.scope");
+        std::replace(value.begin(), value.end(), ',', ' ');
+        std::istringstream stream(value);
+        std::vector<std::string> scope;
+        std::string token;
+        while(stream >> token)
+        {
+            const auto type = get_object_type(token.data());
+            if(type == OBJECT_TYPE_UNKNOWN)
+            {
+                LOG(WARNING, "ignoring unknown scope type %s\n", token.data());
+                continue;
+            }
+            scope.push_back(cache + "/" + get_object_type_string(type) + "/");
+        }
+        if(scope.empty())
+            return scope;
+
+        // first match wins: keep files outside cache
+        scope.push_back("!" + cache + "/");
+        scope.push_back("*");
+        return scope;
+    }
+
+    // yaco.durability is one of "none", "batch" or "file", see FileDurability_e
+    FileDurability_e get_cache_durability(IGit& git)
+    {
+        const auto value = git.config_get_string("yaco.durability");
+        if(value.empty() || value == "none")
+            return DURABILITY_NONE;
+        if(value == "batch")
+            return DURABILITY_BATCH;
+        if(value == "file")
+            return DURABILITY_FILE;
+        LOG(WARNING, "ignoring unknown durability %s\n", value.data());
+        return DURABILITY_NONE;
+    }
+
     fs::path get_version_path()
     {
         return fs::path(get_current_idb_path()).replace_filename("yaco.version");
@@ -342,6 +394,15 @@ Repository::Repository(const std::string& path)
 
         include_idb_ = git_->is_tracked(get_original_idb_name());
         LOG(INFO, "%s %s\n", include_idb_ ? "tracking" : "ignoring", get_original_idb_name().data());
+
+        const auto scope = get_cache_scope(*git_, get_cache());
+        if(!scope.empty())
+        {
+            if(!git_->set_scope(scope))
+                LOG(ERROR, "Unable to restrict cache checkout to yaco.scope\n");
+            else
+                LOG(INFO, "cache restricted to %zu object types\n", scope.size() - 2);
+        }
         LOG(DEBUG, "Repo opened\n");
         return;
     }
@@ -381,6 +442,7 @@ Repository::Repository(const std::string& path)
 
 void Repository::add_comment(const std::string& msg)
 {
+    std::lock_guard<std::mutex> lock(comments_mutex_);
     comments_.insert(msg);
 }
 
@@ -526,12 +588,15 @@ bool Repository::commit_cache()
                     + std::to_string(untracked.size()) + " added "
                     + std::to_string(modified.size())  + " updated "
                     + std::to_string(deleted.size())   + " deleted\n\n";
-    for(const auto& it : comments_)
     {
-        commit_msg.append(it);
-        commit_msg.append("\n");
+        std::lock_guard<std::mutex> lock(comments_mutex_);
+        for(const auto& it : comments_)
+        {
+            commit_msg.append(it);
+            commit_msg.append("\n");
+        }
+        comments_.clear();
     }
-    comments_.clear();
 
     if(commit_msg.size() > TRUNCATE_COMMIT_MSG_LENGTH)
     {
@@ -762,6 +827,46 @@ void Repository::diff_index(const std::string& from, const on_blob_fn& on_blob)
     git_->diff_index(from, on_blob);
 }
 
+// checkpoints are "<commit> <scope>", objects outside
+// a previous scope were never applied on idb
+std::string Repository::get_checkpoint()
+{
+    const auto commit = git_->get_commit("HEAD");
+    if(commit.empty())
+        return commit;
+
+    return std::string(commit.data()) + " " + git_->config_get_string("yaco.scope");
+}
+
+bool Repository::diff_checkpoint(CacheDelta& delta, const std::string& checkpoint)
+{
+    const auto sep = checkpoint.find(' ');
+    if(sep == std::string::npos)
+        return false;
+
+    const auto commit = checkpoint.substr(0, sep);
+    const auto scope = checkpoint.substr(sep + 1);
+    if(scope != git_->config_get_string("yaco.scope"))
+    {
+        LOG(INFO, "cache scope changed since checkpoint %s\n", commit.data());
+        return false;
+    }
+
+    // uncommitted cache files are not part of any commit
+    bool dirty = false;
+    git_->status(get_cache() + "/", [&](const char* /*name*/, const IGit::Status& status)
+    {
+        dirty |= status.untracked || status.modified || status.deleted;
+    });
+    if(dirty)
+    {
+        LOG(INFO, "cache has uncommitted changes\n");
+        return false;
+    }
+
+    return cache::diff_commits(delta, *git_, commit, "HEAD");
+}
+
 bool Repository::idb_is_tracked()
 {
     return include_idb_;
@@ -772,6 +877,13 @@ std::string Repository::get_cache()
     return "cache";
 }
 
+std::shared_ptr<IFileWriter> Repository::get_cache_writer()
+{
+    if(!files_)
+        files_ = MakeFileWriter(git_ ? get_cache_durability(*git_) : DURABILITY_NONE, 0);
+    return files_;
+}
+
 void Repository::push()
 {
     if(!has_remote(default_remote_name))
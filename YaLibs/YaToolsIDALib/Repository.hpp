@@ -23,6 +23,8 @@
 #include <functional>
 
 struct IPatcher;
+struct CacheDelta;
+struct IFileWriter;
 
 struct IRepository
 {
@@ -32,6 +34,7 @@ struct IRepository
     using on_fixup_fn   = std::function<bool(std::string&, const void*, size_t)>;
 
     virtual std::string get_cache() = 0;
+    virtual std::shared_ptr<IFileWriter> get_cache_writer() = 0;
     virtual void        add_comment(const std::string& msg) = 0;
     virtual bool        check_valid_cache_startup() = 0;
     virtual std::string update_cache(IPatcher& patcher, const on_fixup_fn& on_fixup) = 0;
@@ -40,6 +43,8 @@ struct IRepository
     virtual void        sync_and_push_original_idb() = 0;
     virtual void        discard_and_pull_idb() = 0;
     virtual void        diff_index(const std::string& from, const on_blob_fn& on_blob) const = 0;
+    virtual std::string get_checkpoint() = 0;
+    virtual bool        diff_checkpoint(CacheDelta& delta, const std::string& checkpoint) = 0;
     virtual bool        idb_is_tracked() = 0;
     virtual void        push() = 0;
     virtual void        touch() = 0;
@@ -29,6 +29,9 @@
 #include "MemoryModel.hpp"
 #include "IModelSink.hpp"
 #include "Yatools.hpp"
+#include "Hash.hpp"
+#include "HVersion.hpp"
+#include "RelativeIds.hpp"
 
 #include "git_version.h"
 
@@ -46,6 +49,16 @@ namespace fs = std::experimental::filesystem;
 
 namespace
 {
+    // new caches use image-relative ids, older caches keep
+    // absolute ids until converted with yacacherelocate
+    void setup_relative_ids(const IModel& model)
+    {
+        const auto binary = model.get(hash::hash_binary());
+        const auto relative = !binary.is_valid() || relative_ids::is_enabled(binary);
+        hash::set_relative_ids(relative, get_imagebase());
+        LOG(DEBUG, "cache: using %s ids\n", relative ? "image-relative" : "absolute");
+    }
+
     fs::path get_current_idb_path()
     {
         return fs::path(get_path(PATH_TYPE_IDB));
@@ -165,6 +178,7 @@ void YaCo::export_database()
         return;
     }
 
+    // streamed, use yadbcanon to get a canonical database
     const auto exporter = MakeFlatBufferVisitor();
     AcceptIdaModel(*exporter);
     ExportedBuffer buffer = exporter->GetBuffer();
@@ -207,7 +221,9 @@ void YaCo::initial_load()
 
     const auto mem = MakeMemoryModel();
     AcceptXmlCache(*mem, repo_->get_cache());
-    MakeIdaSink()->update(*mem);
+    setup_relative_ids(*mem);
+    if(!events_->load(*mem))
+        MakeIdaSink()->update(*mem);
     events_->touch_types();
 
     const auto time_end = std::chrono::system_clock::now();
@@ -236,6 +252,7 @@ void YaCo::sync_and_push_idb(IdaMode mode)
         return;
 
     hooks_->unhook();
+    events_->flush();
     repo_->sync_and_push_original_idb();
 
     warning("Force push complete, you can restart IDA and other YaCo users can \"Force pull\"");
@@ -253,6 +270,7 @@ void YaCo::discard_and_pull_idb(IdaMode mode)
         return;
 
     hooks_->unhook();
+    events_->flush();
     repo_->discard_and_pull_idb();
 
     set_database_flag(DBFL_KILL);
@@ -499,6 +499,20 @@ namespace ya
         return range_t{start, end};
     }
 
+    ea_t to_relative_ea(YaToolObjectType_e type, ea_t ea)
+    {
+        if(!hash::is_located(type))
+            return ea;
+        return static_cast<ea_t>(ea - hash::get_image_base());
+    }
+
+    ea_t to_absolute_ea(YaToolObjectType_e type, offset_t address)
+    {
+        if(!hash::is_located(type))
+            return static_cast<ea_t>(address);
+        return static_cast<ea_t>(address + hash::get_image_base());
+    }
+
     std::vector<ea_t> get_all_items(ea_t start, ea_t end)
     {
         std::vector<ea_t> items;
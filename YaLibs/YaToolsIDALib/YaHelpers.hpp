@@ -194,6 +194,10 @@ namespace ya
         d.erase(std::unique(d.begin(), d.end()), d.end());
     }
 
+    // located objects addresses are image-relative when enabled
+    ea_t    to_relative_ea(YaToolObjectType_e type, ea_t ea);
+    ea_t    to_absolute_ea(YaToolObjectType_e type, offset_t address);
+
     range_t get_range_item(ea_t ea);
     range_t get_range_code(ea_t ea, ea_t min, ea_t max);
     std::vector<ea_t> get_all_items(ea_t start, ea_t end);
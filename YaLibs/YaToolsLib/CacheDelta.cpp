@@ -0,0 +1,112 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "CacheDelta.hpp"
+
+#include "Git.hpp"
+#include "HVersion.hpp"
+#include "MemoryModel.hpp"
+#include "Parallel.hpp"
+#include "XmlAccept.hpp"
+#include "Helpers.h"
+#include "Yatools.hpp"
+
+#include <libxml/parser.h>
+
+#include <string.h>
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("cache", (FMT), ## __VA_ARGS__)
+
+namespace
+{
+    struct CacheModels
+    {
+        std::shared_ptr<IModelAndVisitor> updated;
+        std::shared_ptr<IModelAndVisitor> deleted;
+    };
+
+    // minimum number of blobs parsed per worker
+    const size_t BLOB_MIN_RANGE = 32;
+
+    bool is_xml_path(const char* path)
+    {
+        static const char ext[] = ".xml";
+        const auto size = strlen(path);
+        return size >= sizeof ext - 1 && !strcmp(&path[size - (sizeof ext - 1)], ext);
+    }
+
+    IModel::OnVersionFn accept_into(IModelVisitor& visitor)
+    {
+        return [&](const HVersion& hver)
+        {
+            hver.accept(visitor);
+            return WALK_CONTINUE;
+        };
+    }
+}
+
+CacheDelta cache::parse_blobs(const std::vector<CacheBlob>& blobs)
+{
+    // parse blobs on worker threads & merge ranges back in diff order
+    // libxml2 global state must be initialized before concurrent readers
+    xmlInitParser();
+    const auto num_ranges = parallel::get_num_ranges(blobs.size(), BLOB_MIN_RANGE);
+    std::vector<CacheModels> models(num_ranges);
+    parallel::for_ranges(blobs.size(), BLOB_MIN_RANGE, [&](size_t idx, size_t begin, size_t end)
+    {
+        auto& range = models[idx];
+        range.updated = MakeMemoryModel();
+        range.deleted = MakeMemoryModel();
+        range.updated->visit_start();
+        range.deleted->visit_start();
+        for(auto i = begin; i < end; ++i)
+            AcceptXmlMemoryChunk(blobs[i].added ? *range.updated : *range.deleted, blobs[i].data.data(), blobs[i].data.size());
+        range.deleted->visit_end();
+        range.updated->visit_end();
+    });
+
+    const auto updated = MakeMemoryModel();
+    const auto deleted = MakeMemoryModel();
+    updated->visit_start();
+    deleted->visit_start();
+    for(const auto& range : models)
+    {
+        range.updated->walk(accept_into(*updated));
+        range.deleted->walk(accept_into(*deleted));
+    }
+    deleted->visit_end();
+    updated->visit_end();
+    return {updated, deleted};
+}
+
+bool cache::diff_commits(CacheDelta& delta, IGit& git, const std::string& from, const std::string& to)
+{
+    std::vector<CacheBlob> blobs;
+    const auto ok = git.diff_trees(from, to, [&](const char* path, bool added, const void* ptr, size_t size)
+    {
+        // skip idb & any other non-object file
+        if(!is_xml_path(path))
+            return 0;
+
+        LOG(DEBUG, "delta: path %s %s size %zd\n", path, added ? "updated" : "deleted", size);
+        blobs.push_back({std::string(static_cast<const char*>(ptr), size), added});
+        return 0;
+    });
+    if(!ok)
+        return false;
+
+    delta = parse_blobs(blobs);
+    return true;
+}
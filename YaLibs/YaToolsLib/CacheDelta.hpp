@@ -0,0 +1,44 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct IModel;
+struct IGit;
+
+struct CacheBlob
+{
+    std::string data;
+    bool        added;
+};
+
+struct CacheDelta
+{
+    std::shared_ptr<IModel> updated;
+    std::shared_ptr<IModel> deleted;
+};
+
+namespace cache
+{
+    // parse xml blobs on worker threads, objects are merged back in blob order
+    CacheDelta parse_blobs(const std::vector<CacheBlob>& blobs);
+
+    // objects updated & deleted in cache between two commits
+    bool diff_commits(CacheDelta& delta, IGit& git, const std::string& from, const std::string& to);
+}
@@ -0,0 +1,285 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Canonical.hpp"
+
+#include "HVersion.hpp"
+#include "IModel.hpp"
+#include "IModelVisitor.hpp"
+#include "Signature.hpp"
+#include "Helpers.h"
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    struct Sig
+    {
+        SignatureMethod_e   method;
+        SignatureAlgo_e     algo;
+        std::string         value;
+    };
+
+    struct Attribute
+    {
+        std::string key;
+        std::string value;
+    };
+
+    struct Comment
+    {
+        offset_t        offset;
+        CommentType_e   type;
+        std::string     value;
+    };
+
+    struct ValueView
+    {
+        offset_t    offset;
+        operand_t   operand;
+        std::string value;
+    };
+
+    struct RegisterView
+    {
+        offset_t    offset;
+        offset_t    end_offset;
+        std::string name;
+        std::string new_name;
+    };
+
+    struct HiddenArea
+    {
+        offset_t    offset;
+        offset_t    size;
+        std::string value;
+    };
+
+    struct Xref
+    {
+        offset_t                offset;
+        operand_t               operand;
+        YaToolObjectId          id;
+        std::vector<Attribute>  attributes;
+    };
+
+    struct Blob
+    {
+        offset_t                offset;
+        std::vector<uint8_t>    data;
+    };
+
+    bool operator<(const Sig& a, const Sig& b)
+    {
+        return std::tie(a.method, a.algo, a.value) < std::tie(b.method, b.algo, b.value);
+    }
+
+    bool operator<(const Attribute& a, const Attribute& b)
+    {
+        return std::tie(a.key, a.value) < std::tie(b.key, b.value);
+    }
+
+    bool operator<(const Comment& a, const Comment& b)
+    {
+        return std::tie(a.offset, a.type, a.value) < std::tie(b.offset, b.type, b.value);
+    }
+
+    bool operator<(const ValueView& a, const ValueView& b)
+    {
+        return std::tie(a.offset, a.operand, a.value) < std::tie(b.offset, b.operand, b.value);
+    }
+
+    bool operator<(const RegisterView& a, const RegisterView& b)
+    {
+        return std::tie(a.offset, a.end_offset, a.name, a.new_name) < std::tie(b.offset, b.end_offset, b.name, b.new_name);
+    }
+
+    bool operator<(const HiddenArea& a, const HiddenArea& b)
+    {
+        return std::tie(a.offset, a.size, a.value) < std::tie(b.offset, b.size, b.value);
+    }
+
+    bool operator<(const Xref& a, const Xref& b)
+    {
+        return std::tie(a.offset, a.operand, a.id, a.attributes) < std::tie(b.offset, b.operand, b.id, b.attributes);
+    }
+
+    bool operator<(const Blob& a, const Blob& b)
+    {
+        return std::tie(a.offset, a.data) < std::tie(b.offset, b.data);
+    }
+
+    template<typename T>
+    void sort(std::vector<T>& values)
+    {
+        std::sort(values.begin(), values.end());
+    }
+}
+
+void canonical::accept_version(const HVersion& version, IModelVisitor& visitor)
+{
+    visitor.visit_start_version(version.type(), version.id());
+    visitor.visit_size(version.size());
+    visitor.visit_parent_id(version.parent_id());
+    visitor.visit_address(version.address());
+
+    if(version.has_username())
+        visitor.visit_name(version.username(), version.username_flags());
+
+    if(version.has_prototype())
+        visitor.visit_prototype(version.prototype());
+
+    visitor.visit_flags(version.flags());
+
+    const auto string_type = version.string_type();
+    if(string_type != UINT8_MAX)
+        visitor.visit_string_type(string_type);
+
+    // signatures
+    std::vector<Sig> sigs;
+    version.walk_signatures([&](const HSignature& hsig)
+    {
+        const auto sig = hsig.get();
+        sigs.push_back({sig.method, sig.algo, make_string(make_string_ref(sig))});
+        return WALK_CONTINUE;
+    });
+    sort(sigs);
+    visitor.visit_start_signatures();
+    for(const auto& sig : sigs)
+        visitor.visit_signature(sig.method, sig.algo, make_string_ref(sig.value));
+    visitor.visit_end_signatures();
+
+    if(version.has_header_comment(true))
+        visitor.visit_header_comment(true, version.header_comment(true));
+
+    if(version.has_header_comment(false))
+        visitor.visit_header_comment(false, version.header_comment(false));
+
+    // offsets
+    std::vector<Comment> comments;
+    version.walk_comments([&](offset_t offset, CommentType_e type, const const_string_ref& value)
+    {
+        comments.push_back({offset, type, make_string(value)});
+        return WALK_CONTINUE;
+    });
+    std::vector<ValueView> valueviews;
+    version.walk_value_views([&](offset_t offset, operand_t operand, const const_string_ref& value)
+    {
+        valueviews.push_back({offset, operand, make_string(value)});
+        return WALK_CONTINUE;
+    });
+    std::vector<RegisterView> registerviews;
+    version.walk_register_views([&](offset_t offset, offset_t end, const const_string_ref& name, const const_string_ref& new_name)
+    {
+        registerviews.push_back({offset, end, make_string(name), make_string(new_name)});
+        return WALK_CONTINUE;
+    });
+    std::vector<HiddenArea> hiddenareas;
+    version.walk_hidden_areas([&](offset_t offset, offset_t size, const const_string_ref& value)
+    {
+        hiddenareas.push_back({offset, size, make_string(value)});
+        return WALK_CONTINUE;
+    });
+    if(!comments.empty() || !valueviews.empty() || !registerviews.empty() || !hiddenareas.empty())
+    {
+        sort(comments);
+        sort(valueviews);
+        sort(registerviews);
+        sort(hiddenareas);
+        visitor.visit_start_offsets();
+        for(const auto& it : comments)
+            visitor.visit_offset_comments(it.offset, it.type, make_string_ref(it.value));
+        for(const auto& it : valueviews)
+            visitor.visit_offset_valueview(it.offset, it.operand, make_string_ref(it.value));
+        for(const auto& it : registerviews)
+            visitor.visit_offset_registerview(it.offset, it.end_offset, make_string_ref(it.name), make_string_ref(it.new_name));
+        for(const auto& it : hiddenareas)
+            visitor.visit_offset_hiddenarea(it.offset, it.size, make_string_ref(it.value));
+        visitor.visit_end_offsets();
+    }
+
+    // xrefs
+    std::vector<Xref> xrefs;
+    version.walk_xrefs([&](offset_t offset, operand_t operand, YaToolObjectId id, const XrefAttributes* hattr)
+    {
+        xrefs.push_back({offset, operand, id, {}});
+        auto& attributes = xrefs.back().attributes;
+        version.walk_xref_attributes(hattr, [&](const const_string_ref& key, const const_string_ref& value)
+        {
+            attributes.push_back({make_string(key), make_string(value)});
+            return WALK_CONTINUE;
+        });
+        sort(attributes);
+        return WALK_CONTINUE;
+    });
+    sort(xrefs);
+    visitor.visit_start_xrefs();
+    for(const auto& xref : xrefs)
+    {
+        visitor.visit_start_xref(xref.offset, xref.id, xref.operand);
+        for(const auto& attr : xref.attributes)
+            visitor.visit_xref_attribute(make_string_ref(attr.key), make_string_ref(attr.value));
+        visitor.visit_end_xref();
+    }
+    visitor.visit_end_xrefs();
+
+    // attributes
+    std::vector<Attribute> attributes;
+    version.walk_attributes([&](const const_string_ref& key, const const_string_ref& value)
+    {
+        attributes.push_back({make_string(key), make_string(value)});
+        return WALK_CONTINUE;
+    });
+    sort(attributes);
+    for(const auto& attr : attributes)
+        visitor.visit_attribute(make_string_ref(attr.key), make_string_ref(attr.value));
+
+    // blobs
+    std::vector<Blob> blobs;
+    version.walk_blobs([&](offset_t offset, const void* data, size_t size)
+    {
+        const auto ptr = static_cast<const uint8_t*>(data);
+        blobs.push_back({offset, {ptr, ptr + size}});
+        return WALK_CONTINUE;
+    });
+    sort(blobs);
+    for(const auto& blob : blobs)
+        visitor.visit_blob(blob.offset, blob.data.empty() ? nullptr : &blob.data[0], blob.data.size());
+
+    visitor.visit_end_version();
+}
+
+void canonical::accept(const IModel& model, IModelVisitor& visitor)
+{
+    std::vector<HVersion> versions;
+    versions.reserve(model.size());
+    model.walk([&](const HVersion& hver)
+    {
+        versions.push_back(hver);
+        return WALK_CONTINUE;
+    });
+    std::sort(versions.begin(), versions.end(), [](const HVersion& a, const HVersion& b)
+    {
+        return std::make_pair(a.type(), a.id()) < std::make_pair(b.type(), b.id());
+    });
+
+    visitor.visit_start();
+    for(const auto& hver : versions)
+        accept_version(hver, visitor);
+    visitor.visit_end();
+}
@@ -0,0 +1,31 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+struct IModel;
+struct IModelVisitor;
+struct HVersion;
+
+namespace canonical
+{
+    // visit one version with every sub-element in a stable order:
+    // two equivalent versions always produce the same visitor calls
+    void accept_version(const HVersion& version, IModelVisitor& visitor);
+
+    // visit a whole model sorted by (type, id), so exporting it
+    // is independent from insertion order & from the model backend
+    void accept(const IModel& model, IModelVisitor& visitor);
+}
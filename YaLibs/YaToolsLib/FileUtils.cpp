@@ -49,6 +49,7 @@ struct Mmap : public Mmap_ABC
 
     const void* Get() const;
     size_t      GetSize() const;
+    void        Advise(MmapAccess_e access) const;
 
 private:
     std::shared_ptr<void> File;
@@ -107,8 +108,31 @@ size_t Mmap::GetSize() const
     return static_cast<size_t>(Size.QuadPart);
 }
 
+void Mmap::Advise(MmapAccess_e access) const
+{
+    // only prefetch has an equivalent
+#if _WIN32_WINNT >= 0x0602
+    if(!View || access != MMAP_ACCESS_WILLNEED)
+        return;
+    WIN32_MEMORY_RANGE_ENTRY range = {View.get(), GetSize()};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    UNUSED(access);
+#endif
+}
+
+IoStats GetIoStats()
+{
+    IoStats stats = {};
+    IO_COUNTERS io;
+    if(GetProcessIoCounters(GetCurrentProcess(), &io))
+        stats.read_bytes = io.ReadTransferCount;
+    return stats;
+}
+
 #else
 #   include <sys/mman.h>
+#   include <sys/resource.h>
 #   include <sys/stat.h>
 #   include <fcntl.h>
 #   include <unistd.h>
@@ -135,14 +159,17 @@ struct Mmap : public Mmap_ABC
 
     const void* Get() const;
     size_t      GetSize() const;
+    void        Advise(MmapAccess_e access) const;
 
 private:
     std::shared_ptr<Fd>   File;
     std::shared_ptr<void> View;
+    size_t                Size;
 };
 }
 
 Mmap::Mmap(const char* pPath)
+    : Size(0)
 {
     struct stat sb;
 
@@ -173,6 +200,7 @@ Mmap::Mmap(const char* pPath)
             munmap(mem, input_size);
         }
             });
+    Size = input_size;
 }
 
 const void* Mmap::Get() const
@@ -189,6 +217,39 @@ size_t Mmap::GetSize() const
     }
     return sb.st_size;
 }
+
+void Mmap::Advise(MmapAccess_e access) const
+{
+    if(!View)
+        return;
+
+    const auto advice = [&]
+    {
+        switch(access)
+        {
+            case MMAP_ACCESS_NORMAL:        return MADV_NORMAL;
+            case MMAP_ACCESS_SEQUENTIAL:    return MADV_SEQUENTIAL;
+            case MMAP_ACCESS_RANDOM:        return MADV_RANDOM;
+            case MMAP_ACCESS_WILLNEED:      return MADV_WILLNEED;
+        }
+        return MADV_NORMAL;
+    }();
+    // hints only, failures are harmless
+    madvise(View.get(), Size, advice);
+}
+
+IoStats GetIoStats()
+{
+    IoStats stats = {};
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage))
+        return stats;
+    stats.minor_faults = usage.ru_minflt;
+    stats.major_faults = usage.ru_majflt;
+    // counted in 512-byte blocks
+    stats.read_bytes = static_cast<uint64_t>(usage.ru_inblock) * 512;
+    return stats;
+}
 #endif
 
 std::shared_ptr<Mmap_ABC> MmapFile(const char* pPath)
@@ -17,18 +17,39 @@
 #define FILEUTILS_H__
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <string>
 
+enum MmapAccess_e
+{
+    MMAP_ACCESS_NORMAL,
+    MMAP_ACCESS_SEQUENTIAL,     // aggressive readahead
+    MMAP_ACCESS_RANDOM,         // no readahead
+    MMAP_ACCESS_WILLNEED,       // asynchronous prefetch of the whole mapping
+};
+
 struct Mmap_ABC
 {
     virtual ~Mmap_ABC() {}
     virtual const void* Get() const = 0;
     virtual size_t      GetSize() const = 0;
+
+    // hints how the mapping will be read next, ignored by default
+    virtual void        Advise(MmapAccess_e /*access*/) const {}
 };
 std::shared_ptr<Mmap_ABC> MmapFile(const char* pPath);
 
+// process-wide counters, zero when unsupported
+struct IoStats
+{
+    uint64_t minor_faults;
+    uint64_t major_faults;
+    uint64_t read_bytes;
+};
+IoStats GetIoStats();
+
 std::string CreateTemporaryDirectory(const std::string& base);
 
 #endif
@@ -0,0 +1,321 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "FileWriter.hpp"
+
+#include "Helpers.h"
+#include "Parallel.hpp"
+#include "Yatools.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <errno.h>
+#include <functional>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _MSC_VER
+#   include <filesystem>
+#   include <io.h>
+#else
+#   include <experimental/filesystem>
+#   include <unistd.h>
+#endif
+
+namespace fs = std::experimental::filesystem;
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("files", (FMT), ## __VA_ARGS__)
+
+namespace
+{
+    // maximum number of queued bytes before write blocks
+    const size_t MAX_PENDING_BYTES = 64 * 1024 * 1024;
+
+    // minimum number of files synced per worker on batch flush
+    const size_t SYNC_MIN_RANGE = 64;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Operation
+    {
+        std::string path;
+        std::string data;
+        bool        remove;
+    };
+
+    struct Worker
+    {
+        std::thread             thread;
+        std::vector<Operation>  queue;
+    };
+
+    bool sync_file(FILE* fh)
+    {
+        if(fflush(fh))
+            return false;
+#ifdef _MSC_VER
+        return !_commit(_fileno(fh));
+#else
+        return !fsync(fileno(fh));
+#endif
+    }
+
+    bool write_file(const std::string& path, const std::string& data, bool sync)
+    {
+        FILE* fh = fopen(path.data(), "wb");
+        if(!fh)
+            return false;
+
+        auto ok = data.empty() || fwrite(data.data(), data.size(), 1, fh) == 1;
+        if(ok && sync)
+            ok = sync_file(fh);
+        ok &= !fclose(fh);
+        return ok;
+    }
+
+    bool sync_path(const std::string& path)
+    {
+        // files removed since their write have nothing to sync
+        FILE* fh = fopen(path.data(), "r+b");
+        if(!fh)
+            return errno == ENOENT;
+
+        auto ok = sync_file(fh);
+        ok &= !fclose(fh);
+        return ok;
+    }
+
+    bool remove_file(const std::string& path)
+    {
+        return !::remove(path.data()) || errno == ENOENT;
+    }
+
+    struct FileWriter
+        : public IFileWriter
+    {
+         FileWriter(FileDurability_e durability, size_t num_threads);
+        ~FileWriter();
+
+        // IFileWriter
+        void            write   (const std::string& path, std::string&& data) override;
+        void            remove  (const std::string& path) override;
+        bool            flush   () override;
+        FileWriterStats stats   () const override;
+
+        void post(Operation&& op);
+        void run(Worker& worker);
+
+        const FileDurability_e          durability_;
+        mutable std::mutex              mutex_;
+        std::condition_variable         work_;
+        std::condition_variable         done_;
+        std::vector<Worker>             workers_;
+        std::vector<std::string>        unsynced_;
+        std::unordered_set<std::string> dirs_;
+        size_t                          pending_ops_;
+        size_t                          pending_bytes_;
+        bool                            stop_;
+        bool                            ok_;
+        bool                            started_;
+        Clock::time_point               start_;
+        FileWriterStats                 stats_;
+    };
+}
+
+FileWriter::FileWriter(FileDurability_e durability, size_t num_threads)
+    : durability_   (durability)
+    , workers_      (num_threads ? num_threads : std::max<size_t>(1, std::thread::hardware_concurrency()))
+    , pending_ops_  (0)
+    , pending_bytes_(0)
+    , stop_         (false)
+    , ok_           (true)
+    , started_      (false)
+    , stats_        ({0, 0, 0, 0})
+{
+}
+
+FileWriter::~FileWriter()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_.notify_all();
+    for(auto& w : workers_)
+        if(w.thread.joinable())
+            w.thread.join();
+}
+
+std::shared_ptr<IFileWriter> MakeFileWriter(FileDurability_e durability, size_t num_threads)
+{
+    return std::make_shared<FileWriter>(durability, num_threads);
+}
+
+void FileWriter::run(Worker& worker)
+{
+    const auto sync = durability_ == DURABILITY_FILE;
+    std::vector<Operation> ops;
+    std::vector<std::string> written;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        work_.wait(lock, [&]
+        {
+            return stop_ || !worker.queue.empty();
+        });
+        if(worker.queue.empty())
+            return;
+
+        ops.swap(worker.queue);
+        lock.unlock();
+
+        auto ok = true;
+        size_t bytes = 0;
+        size_t removed = 0;
+        written.clear();
+        for(const auto& op : ops)
+        {
+            if(op.remove)
+            {
+                if(!remove_file(op.path))
+                {
+                    LOG(ERROR, "unable to remove %s\n", op.path.data());
+                    ok = false;
+                }
+                ++removed;
+                continue;
+            }
+            if(!write_file(op.path, op.data, sync))
+            {
+                LOG(ERROR, "unable to write %s\n", op.path.data());
+                ok = false;
+                continue;
+            }
+            bytes += op.data.size();
+            written.push_back(op.path);
+        }
+
+        lock.lock();
+        ok_ &= ok;
+        stats_.written += written.size();
+        stats_.removed += removed;
+        stats_.bytes += bytes;
+        for(const auto& op : ops)
+            pending_bytes_ -= op.data.size();
+        pending_ops_ -= ops.size();
+        if(durability_ == DURABILITY_BATCH)
+            unsynced_.insert(unsynced_.end(), written.begin(), written.end());
+        ops.clear();
+        done_.notify_all();
+    }
+}
+
+void FileWriter::post(Operation&& op)
+{
+    // shard by path so that operations on one file stay ordered
+    auto& worker = workers_[std::hash<std::string>()(op.path) % workers_.size()];
+    // workers start on their first operation, idle writers cost no thread
+    if(!worker.thread.joinable())
+        worker.thread = std::thread(&FileWriter::run, this, std::ref(worker));
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&]
+        {
+            return !pending_bytes_ || pending_bytes_ + op.data.size() <= MAX_PENDING_BYTES;
+        });
+        if(!started_)
+        {
+            started_ = true;
+            start_ = Clock::now();
+        }
+        ++pending_ops_;
+        pending_bytes_ += op.data.size();
+        worker.queue.push_back(std::move(op));
+    }
+    work_.notify_all();
+}
+
+void FileWriter::write(const std::string& path, std::string&& data)
+{
+    const auto parent = fs::path(path).parent_path();
+    if(!parent.empty() && dirs_.insert(parent.string()).second)
+    {
+        std::error_code ec;
+        fs::create_directories(parent, ec);
+        if(ec)
+            LOG(ERROR, "unable to create directory %s: %s\n", parent.string().data(), ec.message().data());
+    }
+    post({path, std::move(data), false});
+}
+
+void FileWriter::remove(const std::string& path)
+{
+    post({path, std::string(), true});
+}
+
+bool FileWriter::flush()
+{
+    std::vector<std::string> unsynced;
+    bool ok = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&]
+        {
+            return !pending_ops_;
+        });
+        unsynced.swap(unsynced_);
+        ok = ok_;
+        ok_ = true;
+    }
+
+    if(!unsynced.empty())
+    {
+        const auto num_ranges = parallel::get_num_ranges(unsynced.size(), SYNC_MIN_RANGE);
+        std::vector<uint8_t> oks(num_ranges, true);
+        parallel::for_ranges(unsynced.size(), SYNC_MIN_RANGE, [&](size_t idx, size_t begin, size_t end)
+        {
+            for(auto i = begin; i < end; ++i)
+                if(!sync_path(unsynced[i]))
+                {
+                    LOG(ERROR, "unable to sync %s\n", unsynced[i].data());
+                    oks[idx] = false;
+                }
+        });
+        ok &= std::all_of(oks.begin(), oks.end(), [](uint8_t x) { return !!x; });
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if(!started_)
+        return ok;
+
+    started_ = false;
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start_).count();
+    stats_.seconds += elapsed;
+    LOG(DEBUG, "%zd written %zd removed %zd bytes in %.3fs: %.1f MB/s\n",
+        stats_.written, stats_.removed, stats_.bytes, stats_.seconds,
+        stats_.seconds > 0 ? stats_.bytes / stats_.seconds / (1024 * 1024) : 0.);
+    return ok;
+}
+
+FileWriterStats FileWriter::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,56 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+enum FileDurability_e
+{
+    DURABILITY_NONE,    // let the system flush files whenever it wants
+    DURABILITY_BATCH,   // sync every file written since last flush on flush
+    DURABILITY_FILE,    // sync every file before closing it
+};
+
+struct FileWriterStats
+{
+    size_t  written;    // number of written files
+    size_t  removed;    // number of removed files
+    size_t  bytes;      // number of written bytes
+    double  seconds;    // time spent writing, from first queued operation to last flush
+};
+
+// batches whole-file writes & removals on a pool of workers
+// write & remove must be called from a single thread
+struct IFileWriter
+{
+    virtual ~IFileWriter() = default;
+
+    // queue a file write, missing parent directories are created once
+    virtual void            write   (const std::string& path, std::string&& data) = 0;
+
+    // queue a file removal, operations on one path are applied in order
+    virtual void            remove  (const std::string& path) = 0;
+
+    // wait for every queued operation, false if any failed since last flush
+    virtual bool            flush   () = 0;
+
+    virtual FileWriterStats stats   () const = 0;
+};
+
+// num_threads = 0 uses up to one worker per hardware thread
+// workers are started on demand
+std::shared_ptr<IFileWriter> MakeFileWriter(FileDurability_e durability, size_t num_threads);
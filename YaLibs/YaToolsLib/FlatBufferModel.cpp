@@ -20,6 +20,7 @@
 #include "FileUtils.hpp"
 #include "Yatools.hpp"
 #include "ModelIndex.hpp"
+#include "VersionRecord.hpp"
 
 #ifdef DEBUG
 #define FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
@@ -124,6 +125,7 @@ struct ViewVersions : public IVersions
     int                 string_type     (VersionIndex idx) const override;
     const_string_ref    header_comment  (VersionIndex idx, bool repeatable) const override;
     bool                has_signature   (VersionIndex idx) const override;
+    FunctionSummary     summary         (VersionIndex idx) const override;
 
     void                walk_signatures         (VersionIndex idx, const OnSignatureFn& fnWalk) const override;
     void                walk_xrefs_from         (VersionIndex idx, const OnXrefFromFn& fnWalk) const override;
@@ -170,6 +172,8 @@ struct FlatBufferModel : public IModel
     bool                has             (YaToolObjectId id) const override;
     void                walk_uniques    (const OnSignatureFn& fnWalk) const override;
     void                walk_matching   (const HVersion& object, size_t min_size, const OnVersionFn& fnWalk) const override;
+    void                walk_range      (const VersionRange& range, const OnVersionFn& fnWalk) const override;
+    VersionRange        type_range      (YaToolObjectType_e type) const override;
 
     std::shared_ptr<Mmap_ABC>   buffer_;
     const yadb::Root*           root_;
@@ -178,6 +182,7 @@ struct FlatBufferModel : public IModel
     ModelIndex                  index_;
     ViewVersions                view_versions_;
     ViewSignatures              view_signatures_;
+    VersionRange                type_ranges_[OBJECT_TYPE_COUNT];
 };
 
 const char               gEmpty[] = "";
@@ -226,7 +231,18 @@ FlatBufferModel::FlatBufferModel(const std::shared_ptr<Mmap_ABC>& mmap)
     assert(yadb::RootBufferHasIdentifier(buffer_->Get()));
     root_ = yadb::GetRoot(buffer_->Get());
     assert(ValidateFlatBuffer(buffer_->Get(), buffer_->GetSize()));
+
+    // setup reads every version once, later lookups are random
+    const auto io = GetIoStats();
+    buffer_->Advise(MMAP_ACCESS_WILLNEED);
+    buffer_->Advise(MMAP_ACCESS_SEQUENTIAL);
     setup();
+    buffer_->Advise(MMAP_ACCESS_RANDOM);
+    const auto end = GetIoStats();
+    UNUSED(io);
+    UNUSED(end);
+    LOG(INFO, "setup: %" PRIu64 " minor faults, %" PRIu64 " major faults, %" PRIu64 " KB read\n",
+        end.minor_faults - io.minor_faults, end.major_faults - io.major_faults, (end.read_bytes - io.read_bytes) / 1024);
 }
 
 namespace
@@ -370,8 +386,10 @@ void FlatBufferModel::setup()
     size_t num_versions = 0;
     walk_all_version_arrays(*this, [&](const auto* values, YaToolObjectType_e type)
     {
-        UNUSED(type);
+        // versions are parsed in the same order
+        type_ranges_[type].begin = num_versions;
         num_versions += values ? values->size() : 0;
+        type_ranges_[type].end = num_versions;
     });
 
     versions_.reserve(num_versions);
@@ -428,110 +446,86 @@ void walk_xrefs(const FlatBufferModel&, const VersionCtx& ctx, const T& operand)
     });
 }
 
-void accept_version(const FlatBufferModel& db, const VersionCtx& ctx, IModelVisitor& visitor)
+const VersionRecord& make_record(VersionRecordBuffer& buf, const FlatBufferModel& db, const VersionCtx& ctx)
 {
+    buf.clear();
     const auto* version = ctx.version;
-    visitor.visit_start_version(ctx.type, ctx.id);
-    visitor.visit_size(version->size());
-    visitor.visit_parent_id(version->parent_id());
-    visitor.visit_address(version->address());
+    auto& r = buf.record;
+    r.type          = ctx.type;
+    r.id            = ctx.id;
+    r.parent_id     = version->parent_id();
+    r.address       = version->address();
+    r.size          = version->size();
+    r.flags         = version->flags();
+    r.string_type   = version->string_type();
 
     const auto* username = version->username();
     if(username)
-        visitor.visit_name(string_from(db, username->value()), username->flags());
+    {
+        r.username = string_from(db, username->value());
+        r.username_flags = username->flags();
+    }
 
     const auto prototype = version->prototype();
     if(prototype)
-        visitor.visit_prototype(string_from(db, prototype));
-
-    visitor.visit_flags(version->flags());
+        r.prototype = string_from(db, prototype);
 
-    const auto string_type = version->string_type();
-    if(string_type != UINT8_MAX)
-        visitor.visit_string_type(string_type);
+    auto comment = version->header_comment_repeatable();
+    if(comment)
+        r.header_comment_repeatable = string_from(db, comment);
 
-    const auto get_values = [](const auto* value)
-    {
-        return value && value->size() ? value : nullptr;
-    };
+    comment = version->header_comment_nonrepeatable();
+    if(comment)
+        r.header_comment_nonrepeatable = string_from(db, comment);
 
-    // signatures
-    visitor.visit_start_signatures();
     walk_signatures(db, ctx, [&](HSignature_id_t id, const SignatureCtx& sig)
     {
         UNUSED(id);
-        const auto s      = sig.signature;
-        const auto method = get_signature_method(s->method());
-        const auto algo   = get_signature_algo(s->type());
-        visitor.visit_signature(method, algo, string_from(db, s->value()));
+        const auto s = sig.signature;
+        buf.signatures.push_back({string_from(db, s->value()), get_signature_method(s->method()), get_signature_algo(s->type())});
         return WALK_CONTINUE;
     });
-    visitor.visit_end_signatures();
-
-    auto comment = version->header_comment_repeatable();
-    if(comment)
-        visitor.visit_header_comment(true, string_from(db, comment));
-
-    comment = version->header_comment_nonrepeatable();
-    if(comment)
-        visitor.visit_header_comment(false, string_from(db, comment));
-
-    // offsets
-    const auto* comments = get_values(version->comments());
-    const auto* valueviews = get_values(version->valueviews());
-    const auto* registerviews = get_values(version->registerviews());
-    const auto* hiddenareas = get_values(version->hiddenareas());
-    if(comments || valueviews || registerviews || hiddenareas)
+    walk(version->comments(), [&](const auto* comment)
     {
-        visitor.visit_start_offsets();
-        walk(comments, [&](const auto* comment)
-        {
-            visitor.visit_offset_comments(comment->offset(), get_comment_type(comment->type()), string_from(db, comment->value()));
-        });
-        walk(valueviews, [&](const auto* view)
-        {
-            visitor.visit_offset_valueview(view->offset(), view->operand(), string_from(db, view->value()));
-        });
-        walk(registerviews, [&](const auto* view)
-        {
-            visitor.visit_offset_registerview(view->offset(), view->end_offset(), string_from(db, view->register_name()), string_from(db, view->register_new_name()));
-        });
-        walk(hiddenareas, [&](const auto* area)
-        {
-            visitor.visit_offset_hiddenarea(area->offset(), area->area_size(), string_from(db, area->value()));
-        });
-        visitor.visit_end_offsets();
-    }
-
-    // xrefs
-    visitor.visit_start_xrefs();
+        buf.comments.push_back({comment->offset(), get_comment_type(comment->type()), string_from(db, comment->value())});
+    });
+    walk(version->valueviews(), [&](const auto* view)
+    {
+        buf.valueviews.push_back({view->offset(), view->operand(), string_from(db, view->value())});
+    });
+    walk(version->registerviews(), [&](const auto* view)
+    {
+        buf.registerviews.push_back({view->offset(), view->end_offset(), string_from(db, view->register_name()), string_from(db, view->register_new_name())});
+    });
+    walk(version->hiddenareas(), [&](const auto* area)
+    {
+        buf.hiddenareas.push_back({area->offset(), area->area_size(), string_from(db, area->value())});
+    });
     walk_xrefs(db, ctx, [&](const yadb::Xref* xref)
     {
-        const auto xref_id = xref->id();
-        visitor.visit_start_xref(xref->offset(), xref_id, xref->operand());
+        buf.xrefs.push_back({xref->offset(), xref->id(), xref->operand(), {nullptr, get_size(xref->attributes())}});
+        buf.xref_attributes_idx.push_back(buf.xref_attributes.size());
         walk(xref->attributes(), [&](const auto* attribute)
         {
-            visitor.visit_xref_attribute(string_from(db, attribute->key()), string_from(db, attribute->value()));
+            buf.xref_attributes.push_back({string_from(db, attribute->key()), string_from(db, attribute->value())});
         });
-        visitor.visit_end_xref();
         return WALK_CONTINUE;
     });
-    visitor.visit_end_xrefs();
-
-    // attributes
     walk(version->attributes(), [&](const auto* attribute)
     {
-        visitor.visit_attribute(string_from(db, attribute->key()), string_from(db, attribute->value()));
+        buf.attributes.push_back({string_from(db, attribute->key()), string_from(db, attribute->value())});
     });
-
-    // blobs
     walk(version->blobs(), [&](const auto* blob)
     {
         const auto data = blob->data();
-        visitor.visit_blob(blob->offset(), data->data(), data->size());
+        buf.blobs.push_back({blob->offset(), data->data(), data->size()});
     });
+    return buf.finish();
+}
 
-    visitor.visit_end_version();
+void accept_version(VersionRecordBuffer& buf, const FlatBufferModel& db, const VersionCtx& ctx, IModelVisitor& visitor)
+{
+    visitor.visit_version(make_record(buf, db, ctx));
 }
 
 template<typename T>
@@ -592,13 +586,16 @@ ProgressLogger<T> MakeProgressLogger(size_t max, const T& now)
 void FlatBufferModel::accept(IModelVisitor& visitor)
 {
     DECLARE_PROGRESS_LOGGER(versions_.size());
+    buffer_->Advise(MMAP_ACCESS_SEQUENTIAL);
     visitor.visit_start();
+    VersionRecordBuffer buf;
     for(const auto& version : versions_)
     {
-        accept_version(*this, version, visitor);
+        accept_version(buf, *this, version, visitor);
         UPDATE_PROGRESS_LOGGER(object.type);
     }
     visitor.visit_end();
+    buffer_->Advise(MMAP_ACCESS_RANDOM);
 }
 
 void FlatBufferModel::walk(const OnVersionFn& fnWalk) const
@@ -609,6 +606,22 @@ void FlatBufferModel::walk(const OnVersionFn& fnWalk) const
             return;
 }
 
+void FlatBufferModel::walk_range(const VersionRange& range, const OnVersionFn& fnWalk) const
+{
+    const auto end = std::min(range.end, versions_.size());
+    for(auto idx = range.begin; idx < end; ++idx)
+        if(fnWalk({&view_versions_, static_cast<VersionIndex>(idx)}) == WALK_STOP)
+            return;
+}
+
+VersionRange FlatBufferModel::type_range(YaToolObjectType_e type) const
+{
+    if(static_cast<size_t>(type) >= OBJECT_TYPE_COUNT)
+        return {0, 0};
+
+    return type_ranges_[type];
+}
+
 size_t FlatBufferModel::size() const
 {
     return versions_.size();
@@ -679,7 +692,8 @@ bool ViewVersions::has_signature(VersionIndex idx) const
 
 void ViewVersions::accept(VersionIndex idx, IModelVisitor& visitor) const
 {
-    accept_version(db_, db_.versions_[idx], visitor);
+    VersionRecordBuffer buf;
+    accept_version(buf, db_, db_.versions_[idx], visitor);
 }
 
 YaToolObjectId ViewVersions::id(VersionIndex idx) const
@@ -741,6 +755,22 @@ const_string_ref ViewVersions::header_comment(VersionIndex idx, bool repeatable)
     return string_from(db_, value);
 }
 
+FunctionSummary ViewVersions::summary(VersionIndex idx) const
+{
+    const auto& version = db_.versions_[idx];
+    if(version.type != OBJECT_TYPE_FUNCTION)
+        return {};
+
+    // summaries are stored in function order, older databases have none
+    const auto* summaries = db_.root_->function_summaries();
+    const auto& range = db_.type_ranges_[OBJECT_TYPE_FUNCTION];
+    if(!summaries || summaries->size() != range.end - range.begin)
+        return summarize_function({this, idx});
+
+    const auto* value = summaries->Get(static_cast<fb::uoffset_t>(idx - range.begin));
+    return FunctionSummary{value->size(), value->frame_size(), value->basic_blocks(), value->edges(), value->callees(), value->callers()};
+}
+
 void ViewVersions::walk_signatures(VersionIndex idx, const OnSignatureFn& fnWalk) const
 {
     const auto& version = db_.versions_[idx];
@@ -15,22 +15,28 @@
 
 #include "FlatBufferVisitor.hpp"
 
+#include "Canonical.hpp"
 #include "IModelVisitor.hpp"
+#include "VersionRecord.hpp"
 #include "Signature.hpp"
 #include "FlatBufferModel.hpp"
 #include "IModel.hpp"
 #include "Yatools.hpp"
 #include "FileUtils.hpp"
 #include "XmlAccept.hpp"
+#include "MemoryModel.hpp"
 #include "Helpers.h"
 
 #include <flatbuffers/flatbuffers.h>
 #include <yadb_generated.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <set>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifdef _MSC_VER
 #   include <optional.hpp>
@@ -102,6 +108,17 @@ struct Xref
     operand_t       operand;
 };
 
+// graph node kept to compute function summaries once all versions are visited
+struct SummaryNode
+{
+    YaToolObjectId      id;
+    YaToolObjectId      parent_id;
+    offset_t            size;
+    YaToolObjectType_e  type;
+    uint32_t            xrefs_idx;  // [xrefs_idx, xrefs_end) in summary_xrefs_
+    uint32_t            xrefs_end;
+};
+
 enum VisitorMode
 {
     STANDARD,
@@ -144,6 +161,7 @@ struct FlatBufferVisitor : public IFlatBufferVisitor
     void visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value) override;
     void visit_blob(offset_t offset, const void* blob, size_t len) override;
     void visit_flags(flags_t flags) override;
+    void visit_version(const VersionRecord& record) override;
 
     ExportedBuffer GetBuffer() const override;
 
@@ -167,6 +185,10 @@ struct FlatBufferVisitor : public IFlatBufferVisitor
     std::vector<fb::Offset<yadb::Version>>      local_types_;
     std::vector<fb::Offset<fb::String>>         strings_;
 
+    // function summaries
+    std::vector<SummaryNode>                    summary_nodes_;
+    std::vector<YaToolObjectId>                 summary_xrefs_;
+
     // version
     YaToolObjectType_e                  object_type_;
     YaToolObjectId                      object_id_;
@@ -198,6 +220,13 @@ std::shared_ptr<IFlatBufferVisitor> MakeFlatBufferVisitor()
     return std::make_shared<FlatBufferVisitor>(STANDARD);
 }
 
+std::shared_ptr<IFlatBufferVisitor> ExportCanonicalFlatBuffer(const IModel& model)
+{
+    const auto exporter = MakeFlatBufferVisitor();
+    canonical::accept(model, *exporter);
+    return exporter;
+}
+
 FlatBufferVisitor::FlatBufferVisitor(VisitorMode mode)
     : skip_start_end_(mode == SKIP_START_END)
     , object_type_(OBJECT_TYPE_UNKNOWN)
@@ -254,6 +283,90 @@ static fb::Offset<fb::Vector<T>> make_tables(fb::FlatBufferBuilder& fbb, std::ve
 
 namespace
 {
+    bool is_summary_type(YaToolObjectType_e type)
+    {
+        return type == OBJECT_TYPE_FUNCTION
+            || type == OBJECT_TYPE_BASIC_BLOCK
+            || type == OBJECT_TYPE_STACKFRAME;
+    }
+
+    // counts like summarize_function, but from the visited graph
+    std::vector<yadb::FunctionSummary> make_summaries(FlatBufferVisitor& v)
+    {
+        std::unordered_map<YaToolObjectId, const SummaryNode*> nodes;
+        for(const auto& node : v.summary_nodes_)
+            nodes.emplace(node.id, &node);
+
+        const auto walk_xrefs = [&](const SummaryNode& node, YaToolObjectType_e type, const auto& operand)
+        {
+            for(auto i = node.xrefs_idx; i < node.xrefs_end; ++i)
+            {
+                const auto it = nodes.find(v.summary_xrefs_[i]);
+                if(it != nodes.end() && it->second->type == type)
+                    operand(*it->second);
+            }
+        };
+
+        // distinct (caller, callee) pairs
+        std::vector<std::pair<YaToolObjectId, YaToolObjectId>> calls;
+        for(const auto& node : v.summary_nodes_)
+            if(node.type == OBJECT_TYPE_BASIC_BLOCK)
+                walk_xrefs(node, OBJECT_TYPE_FUNCTION, [&](const SummaryNode& callee)
+                {
+                    calls.emplace_back(node.parent_id, callee.id);
+                });
+        std::sort(calls.begin(), calls.end());
+        calls.erase(std::unique(calls.begin(), calls.end()), calls.end());
+        std::unordered_map<YaToolObjectId, uint32_t> callers;
+        for(const auto& call : calls)
+            ++callers[call.second];
+
+        std::vector<yadb::FunctionSummary> summaries;
+        std::vector<const SummaryNode*> blocks;
+        std::unordered_set<YaToolObjectId> block_ids;
+        std::unordered_set<YaToolObjectId> callees;
+        for(const auto& node : v.summary_nodes_)
+        {
+            if(node.type != OBJECT_TYPE_FUNCTION)
+                continue;
+
+            offset_t frame_size = 0;
+            walk_xrefs(node, OBJECT_TYPE_STACKFRAME, [&](const SummaryNode& frame)
+            {
+                frame_size = frame.size;
+            });
+            blocks.clear();
+            block_ids.clear();
+            walk_xrefs(node, OBJECT_TYPE_BASIC_BLOCK, [&](const SummaryNode& block)
+            {
+                if(block_ids.insert(block.id).second)
+                    blocks.push_back(&block);
+            });
+            uint32_t edges = 0;
+            callees.clear();
+            for(const auto* block : blocks)
+            {
+                walk_xrefs(*block, OBJECT_TYPE_BASIC_BLOCK, [&](const SummaryNode& next)
+                {
+                    edges += !!block_ids.count(next.id);
+                });
+                walk_xrefs(*block, OBJECT_TYPE_FUNCTION, [&](const SummaryNode& callee)
+                {
+                    callees.insert(callee.id);
+                });
+            }
+            const auto it = callers.find(node.id);
+            summaries.emplace_back(node.size, frame_size,
+                static_cast<uint32_t>(blocks.size()),
+                edges,
+                static_cast<uint32_t>(callees.size()),
+                it != callers.end() ? it->second : 0);
+        }
+        v.summary_nodes_.clear();
+        v.summary_xrefs_.clear();
+        return summaries;
+    }
+
     void visit_start(FlatBufferVisitor& v)
     {
         // add an empty string first so index = 0 == an empty string
@@ -262,6 +375,7 @@ namespace
 
     void visit_end(FlatBufferVisitor& v)
     {
+        auto summaries = make_summaries(v);
         yadb::FinishRootBuffer(v.fbbuilder_, yadb::CreateRoot(v.fbbuilder_,
             make_tables(v.fbbuilder_, v.binaries_),
             make_tables(v.fbbuilder_, v.structs_),
@@ -278,7 +392,8 @@ namespace
             make_tables(v.fbbuilder_, v.datas_),
             make_tables(v.fbbuilder_, v.basic_blocks_),
             make_tables(v.fbbuilder_, v.local_types_),
-            make_tables(v.fbbuilder_, v.strings_)
+            make_tables(v.fbbuilder_, v.strings_),
+            make_strucs(v.fbbuilder_, summaries)
         ));
         v.is_ready_ = true;
     }
@@ -346,6 +461,13 @@ void FlatBufferVisitor::visit_end_version()
         return;
     }
 
+    if(is_summary_type(object_type_))
+    {
+        const auto xrefs_idx = summary_nodes_.empty() ? 0 : summary_nodes_.back().xrefs_end;
+        summary_nodes_.push_back({object_id_, parent_id_ ? *parent_id_ : 0, size_ ? *size_ : 0, object_type_,
+                                  xrefs_idx, static_cast<uint32_t>(summary_xrefs_.size())});
+    }
+
     dstvec->push_back(yadb::CreateVersion(fbbuilder_,
         object_id_,
         make_optional(parent_id_),
@@ -476,6 +598,8 @@ void FlatBufferVisitor::visit_start_xrefs()
 void FlatBufferVisitor::visit_start_xref(offset_t offset, YaToolObjectId id, operand_t operand)
 {
     xref_ = Xref{id, offset, operand};
+    if(is_summary_type(object_type_))
+        summary_xrefs_.push_back(id);
 }
 
 void FlatBufferVisitor::visit_xref_attribute(const const_string_ref& attribute_key,
@@ -538,6 +662,62 @@ void FlatBufferVisitor::visit_blob(offset_t offset, const void* blob, size_t len
     ));
 }
 
+void FlatBufferVisitor::visit_version(const VersionRecord& record)
+{
+    object_type_ = record.type;
+    object_id_ = record.id;
+    parent_id_ = record.parent_id;
+    address_ = record.address;
+    flags_ = record.flags;
+    size_ = static_cast<uint32_t>(record.size);
+    if(record.string_type != UINT8_MAX)
+        string_type_ = static_cast<uint8_t>(record.string_type);
+    if(record.username.value)
+        username_.emplace_back(record.username_flags, index_string(*this, record.username));
+    if(record.prototype.value)
+        prototype_ = make_string(record.prototype);
+    if(record.header_comment_repeatable.value)
+        comment_repeatable_ = make_string(record.header_comment_repeatable);
+    if(record.header_comment_nonrepeatable.value)
+        comment_nonrepeatable_ = make_string(record.header_comment_nonrepeatable);
+
+    for(const auto& sig : record.signatures)
+        signatures_.emplace_back(index_string(*this, sig.value), get_hash_type(sig.algo), get_signature_method(sig.method));
+    for(const auto& comment : record.comments)
+        comments_.emplace_back(comment.offset, index_string(*this, comment.value), get_comment_type(comment.type));
+    for(const auto& view : record.valueviews)
+        value_views_.emplace_back(view.offset, index_string(*this, view.value), static_cast<uint8_t>(view.operand));
+    for(const auto& view : record.registerviews)
+        register_views_.emplace_back(view.offset, view.end_offset, index_string(*this, view.name), index_string(*this, view.new_name));
+    for(const auto& hidden : record.hiddenareas)
+        hidden_areas_.emplace_back(hidden.offset, hidden.area_size, index_string(*this, hidden.value));
+
+    const auto is_summary = is_summary_type(object_type_);
+    for(const auto& xref : record.xrefs)
+    {
+        if(is_summary)
+            summary_xrefs_.push_back(xref.id);
+        for(const auto& attr : xref.attributes)
+            attributes_.emplace_back(index_string(*this, attr.key), index_string(*this, attr.value));
+        xrefs_.push_back(yadb::CreateXref(fbbuilder_,
+            xref.offset,
+            xref.id,
+            static_cast<uint8_t>(xref.operand),
+            make_strucs(fbbuilder_, attributes_)
+        ));
+    }
+
+    for(const auto& attr : record.attributes)
+        attributes_.emplace_back(index_string(*this, attr.key), index_string(*this, attr.value));
+    for(const auto& blob : record.blobs)
+        blobs_.push_back(yadb::CreateBlob(fbbuilder_,
+            blob.offset,
+            create_blob(fbbuilder_, blob.data, blob.size)
+        ));
+
+    visit_end_version();
+}
+
 namespace
 {
     struct ExportedMmap : public Mmap_ABC
@@ -585,10 +765,26 @@ std::shared_ptr<IModel> MakeMultiFlatBufferModel(const std::vector<std::string>&
     return MakeFlatBufferModel(std::make_shared<ExportedMmap>(exporter));
 }
 
-bool merge_xmls_to_yadb(const std::string& output, const std::vector<std::string>& inputs)
+namespace
 {
-    const auto exporter = MakeFlatBufferVisitor();
-    AcceptXmlFiles(*exporter, inputs);
+    std::shared_ptr<IFlatBufferVisitor> export_xmls(const std::vector<std::string>& inputs, bool canonical)
+    {
+        if(!canonical)
+        {
+            const auto exporter = MakeFlatBufferVisitor();
+            AcceptXmlFiles(*exporter, inputs);
+            return exporter;
+        }
+
+        const auto db = MakeMemoryModel();
+        AcceptXmlFiles(*db, inputs);
+        return ExportCanonicalFlatBuffer(*db);
+    }
+}
+
+bool merge_xmls_to_yadb(const std::string& output, const std::vector<std::string>& inputs, bool canonical)
+{
+    const auto exporter = export_xmls(inputs, canonical);
 
     // export buffer to file
     const auto buf = exporter->GetBuffer();
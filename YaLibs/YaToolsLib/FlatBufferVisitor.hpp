@@ -35,6 +35,13 @@ struct IFlatBufferVisitor
     virtual ExportedBuffer GetBuffer() const = 0;
 };
 
+struct IModel;
+
 std::shared_ptr<IFlatBufferVisitor> MakeFlatBufferVisitor();
 
-bool merge_xmls_to_yadb(const std::string& dest, const std::vector<std::string>& sources);
+// export model in canonical order, see canonical::accept
+// equal models always export to byte-identical buffers
+std::shared_ptr<IFlatBufferVisitor> ExportCanonicalFlatBuffer(const IModel& model);
+
+// canonical exports load every source in memory first
+bool merge_xmls_to_yadb(const std::string& dest, const std::vector<std::string>& sources, bool canonical = false);
@@ -0,0 +1,122 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Gc.hpp"
+
+#include "HVersion.hpp"
+#include "IModelVisitor.hpp"
+#include "Helpers.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+bool gc::is_root(YaToolObjectType_e type)
+{
+    switch(type)
+    {
+        case OBJECT_TYPE_BINARY:
+        case OBJECT_TYPE_STRUCT:
+        case OBJECT_TYPE_ENUM:
+        case OBJECT_TYPE_LOCAL_TYPE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+namespace
+{
+    using Ids = std::unordered_set<YaToolObjectId>;
+
+    Ids get_reachables(const IModel& model)
+    {
+        // children are not always referenced by their parent xrefs,
+        // so we need parent to children edges too
+        std::unordered_multimap<YaToolObjectId, YaToolObjectId> children;
+        std::vector<YaToolObjectId> todo;
+        model.walk([&](const HVersion& hver)
+        {
+            if(gc::is_root(hver.type()))
+                todo.push_back(hver.id());
+            const auto parent = hver.parent_id();
+            if(parent)
+                children.emplace(parent, hver.id());
+            return WALK_CONTINUE;
+        });
+
+        Ids reached;
+        const auto add = [&](YaToolObjectId id)
+        {
+            if(reached.insert(id).second)
+                todo.push_back(id);
+        };
+        for(const auto id : todo)
+            reached.insert(id);
+        while(!todo.empty())
+        {
+            const auto id = todo.back();
+            todo.pop_back();
+            const auto range = children.equal_range(id);
+            for(auto it = range.first; it != range.second; ++it)
+                add(it->second);
+            const auto hver = model.get(id);
+            if(!hver.is_valid())
+                continue;
+            hver.walk_xrefs([&](offset_t /*offset*/, operand_t /*operand*/, YaToolObjectId xref_id, const XrefAttributes* /*attrs*/)
+            {
+                if(model.has(xref_id))
+                    add(xref_id);
+                return WALK_CONTINUE;
+            });
+        }
+        return reached;
+    }
+}
+
+void gc::walk_orphans(const IModel& model, const IModel::OnVersionFn& on_orphan)
+{
+    const auto reached = get_reachables(model);
+    std::vector<HVersion> orphans;
+    model.walk([&](const HVersion& hver)
+    {
+        if(!reached.count(hver.id()))
+            orphans.push_back(hver);
+        return WALK_CONTINUE;
+    });
+    std::sort(orphans.begin(), orphans.end(), [](const HVersion& a, const HVersion& b)
+    {
+        return std::make_pair(a.type(), a.id()) < std::make_pair(b.type(), b.id());
+    });
+    for(const auto& hver : orphans)
+        if(on_orphan(hver) != WALK_CONTINUE)
+            return;
+}
+
+size_t gc::delete_orphans(const IModel& model, IModelVisitor& visitor)
+{
+    size_t count = 0;
+    visitor.visit_start();
+    walk_orphans(model, [&](const HVersion& hver)
+    {
+        visitor.visit_deleted(hver.type(), hver.id());
+        ++count;
+        return WALK_CONTINUE;
+    });
+    visitor.visit_end();
+    return count;
+}
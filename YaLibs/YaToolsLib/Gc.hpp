@@ -0,0 +1,35 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "IModel.hpp"
+
+#include <functional>
+
+struct IModelVisitor;
+
+namespace gc
+{
+    // objects which never have a parent nor an incoming xref
+    bool is_root(YaToolObjectType_e type);
+
+    // walk every object unreachable from roots through parent ids & xrefs
+    // orphans are walked in (type, id) order
+    void walk_orphans(const IModel& model, const IModel::OnVersionFn& on_orphan);
+
+    // call visit_deleted on visitor for every orphan & return how many were deleted
+    size_t delete_orphans(const IModel& model, IModelVisitor& visitor);
+}
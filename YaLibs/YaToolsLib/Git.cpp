@@ -16,6 +16,7 @@
 #include "Git.hpp"
 #include "LibGit.h"
 #include "Helpers.h"
+#include "Parallel.hpp"
 #include "Yatools.hpp"
 
 #include <fstream>
@@ -52,6 +53,7 @@ namespace std
     template<> struct default_delete<git_merge_file_result>       { static const bool marker = true; void operator()(git_merge_file_result*       ptr) { git_merge_file_result_free(ptr); } };
     template<> struct default_delete<git_object>                  { static const bool marker = true; void operator()(git_object*                  ptr) { git_object_free(ptr); } };
     template<> struct default_delete<git_patch>                   { static const bool marker = true; void operator()(git_patch*                   ptr) { git_patch_free(ptr); } };
+    template<> struct default_delete<git_pathspec>                { static const bool marker = true; void operator()(git_pathspec*                ptr) { git_pathspec_free(ptr); } };
     template<> struct default_delete<git_rebase>                  { static const bool marker = true; void operator()(git_rebase*                  ptr) { git_rebase_free(ptr); } };
     template<> struct default_delete<git_reference>               { static const bool marker = true; void operator()(git_reference*               ptr) { git_reference_free(ptr); } };
     template<> struct default_delete<git_remote>                  { static const bool marker = true; void operator()(git_remote*                  ptr) { git_remote_free(ptr); } };
@@ -85,6 +87,7 @@ namespace
         std::string config_get_string   (const std::string& name) override;
         bool        config_set_string   (const std::string& name, const std::string& value) override;
         bool        diff_index          (const std::string& from, const on_blob_fn& on_blob) override;
+        bool        diff_trees          (const std::string& from, const std::string& to, const on_blob_fn& on_blob) override;
         bool        rebase              (const std::string& upstream, const std::string& dst, IPatcher& patcher, const on_fixup_fn& on_fixup, const on_conflict_fn& on_conflict) override;
         bool        commit              (const std::string& message) override;
         bool        checkout_head       () override;
@@ -93,12 +96,15 @@ namespace
         bool        push                (const std::string& src, const std::string& remote, const std::string& dst) override;
         bool        remotes             (const on_remote_fn& on_remote) override;
         bool        status              (const std::string& path, const on_status_fn& on_path) override;
+        bool        set_scope           (const std::vector<std::string>& pathspecs) override;
         void        flush               () override;
 
         const std::string               path_;
         std::unique_ptr<git_repository> repo_;
         std::unique_ptr<git_index>      index_;
         std::vector<std::string>        errors_;
+        std::vector<std::string>        scope_;
+        std::vector<char*>              scope_ptrs_;
     };
 
     #define PUSH_GIT_ERROR(DST, FMT, ...) do {\
@@ -138,6 +144,9 @@ namespace
     {
         const char* buffer = nullptr;
         const auto err = git_config_get_string(&buffer, cfg, name.data());
+        if(err == GIT_ENOTFOUND)
+            return std::string();
+
         if(err != GIT_OK)
             FAIL_WITH(std::string(), git, "unable to read config string %s", name.data());
 
@@ -378,6 +387,240 @@ namespace
         return tree;
     }
 
+    // pathspecs are matched in order & the first match wins,
+    // so a scope like { "cache/struct/", "!cache/", "*" } keeps every
+    // file but cache/ entries which are not structures
+    git_strarray get_scope(const Git& git)
+    {
+        git_strarray reply;
+        reply.strings   = git.scope_ptrs_.empty() ? nullptr : const_cast<char**>(&git.scope_ptrs_[0]);
+        reply.count     = git.scope_ptrs_.size();
+        return reply;
+    }
+
+    std::vector<std::string> invert_scope(const std::vector<std::string>& scope)
+    {
+        std::vector<std::string> reply;
+        reply.reserve(scope.size() + 1);
+        for(const auto& spec : scope)
+            reply.push_back(!spec.empty() && spec[0] == '!' ? spec.substr(1) : "!" + spec);
+        reply.push_back("*");
+        return reply;
+    }
+
+    std::unique_ptr<git_index> get_index_from_tree(Git& git, const git_tree* tree)
+    {
+        git_index* ptr_index = nullptr;
+        auto err = git_index_new(&ptr_index);
+        if(err != GIT_OK)
+            FAIL_WITH(std::nullptr_t(), git, "unable to create index");
+
+        auto index = make_unique(ptr_index);
+        err = git_index_read_tree(ptr_index, tree);
+        if(err != GIT_OK)
+            FAIL_WITH(std::nullptr_t(), git, "unable to read tree into index");
+
+        return index;
+    }
+
+    bool copy_index_entry(Git& git, const git_index_entry* src)
+    {
+        const auto err = git_index_add(&*git.index_, src);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to add %s to index", src->path);
+
+        return true;
+    }
+
+    bool copy_index_conflict(Git& git, git_index* src, const char* path)
+    {
+        const git_index_entry* ancestor = nullptr;
+        const git_index_entry* our      = nullptr;
+        const git_index_entry* their    = nullptr;
+        auto err = git_index_conflict_get(&ancestor, &our, &their, src, path);
+        if(err == GIT_ENOTFOUND)
+        {
+            // stale conflict on our side only
+            git_index_conflict_remove(&*git.index_, path);
+            const auto entry = git_index_get_bypath(src, path, 0);
+            return !entry || copy_index_entry(git, entry);
+        }
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to get conflict on %s", path);
+
+        err = git_index_conflict_add(&*git.index_, ancestor, our, their);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to add conflict on %s", path);
+
+        return true;
+    }
+
+    // out-of-scope files are never written to the working directory
+    // instead, their index entries are copied from src & marked skip-worktree,
+    // which lets diff & status ignore them while commits keep them intact
+    bool sync_scope(Git& git, git_index* src)
+    {
+        const auto outside = invert_scope(git.scope_);
+        std::vector<char*> ptrs;
+        for(const auto& spec : outside)
+            ptrs.push_back(const_cast<char*>(spec.data()));
+
+        git_diff_options opts;
+        git_diff_init_options(&opts, GIT_DIFF_OPTIONS_VERSION);
+        opts.pathspec.strings   = &ptrs[0];
+        opts.pathspec.count     = ptrs.size();
+        git_diff* ptr_diff = nullptr;
+        auto err = git_diff_index_to_index(&ptr_diff, &*git.repo_, src, &*git.index_, &opts);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to diff index to index");
+
+        const auto diff = make_unique(ptr_diff);
+        for(size_t i = 0, end = git_diff_num_deltas(ptr_diff); i < end; ++i)
+        {
+            const auto delta = git_diff_get_delta(ptr_diff, i);
+            const auto path = delta->old_file.path ? delta->old_file.path : delta->new_file.path;
+            if(delta->status == GIT_DELTA_CONFLICTED)
+            {
+                if(!copy_index_conflict(git, src, path))
+                    return false;
+                continue;
+            }
+
+            if(delta->status == GIT_DELTA_ADDED)
+            {
+                err = git_index_remove(&*git.index_, path, 0);
+                if(err != GIT_OK)
+                    FAIL_WITH(false, git, "unable to remove %s from index", path);
+                continue;
+            }
+
+            const auto entry = git_index_get_bypath(src, path, 0);
+            if(entry && !copy_index_entry(git, entry))
+                return false;
+        }
+        return true;
+    }
+
+    // set skip-worktree on out-of-scope entries & remove their files,
+    // in-scope entries lose it & must be checked out by the caller
+    bool apply_scope(Git& git, git_index* src)
+    {
+        if(!load_index(git))
+            return false;
+
+        if(src && !sync_scope(git, src))
+            return false;
+
+        git_pathspec* ptr_pathspec = nullptr;
+        const auto scope = get_scope(git);
+        auto err = git_pathspec_new(&ptr_pathspec, &scope);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to create pathspec");
+
+        const auto pathspec = make_unique(ptr_pathspec);
+        const auto root = fs::path(git.path_);
+        for(size_t i = 0, end = git_index_entrycount(&*git.index_); i < end; ++i)
+        {
+            const auto ptr = git_index_get_byindex(&*git.index_, i);
+            if(git_index_entry_is_conflict(ptr))
+                continue;
+
+            const auto skip     = !git_pathspec_matches_path(ptr_pathspec, 0, ptr->path);
+            const auto skipped  = !!(ptr->flags_extended & GIT_IDXENTRY_SKIP_WORKTREE);
+            if(skip == skipped)
+                continue;
+
+            // ptr is updated in place by git_index_add
+            const auto path = std::string(ptr->path);
+            auto entry = *ptr;
+            entry.path = path.data();
+            if(skip)
+                entry.flags_extended |= GIT_IDXENTRY_SKIP_WORKTREE;
+            else
+                entry.flags_extended &= ~GIT_IDXENTRY_SKIP_WORKTREE;
+            err = git_index_add(&*git.index_, &entry);
+            if(err != GIT_OK)
+                FAIL_WITH(false, git, "unable to update %s in index", path.data());
+
+            std::error_code ec;
+            if(skip)
+                fs::remove(root / path, ec);
+        }
+
+        err = git_index_write(&*git.index_);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to write index");
+
+        return true;
+    }
+
+    bool apply_scope_from(Git& git, const std::string& target)
+    {
+        if(git.scope_.empty() || git_repository_head_unborn(&*git.repo_) == 1)
+            return true;
+
+        const auto tree = get_tree(git, target);
+        if(!tree)
+            return false;
+
+        const auto index = get_index_from_tree(git, &*tree);
+        if(!index)
+            return false;
+
+        return apply_scope(git, &*index);
+    }
+
+    // out-of-scope files written locally, by new objects or updates,
+    // must be visible again to status
+    // only skip-worktree entries under path are checked
+    bool unskip_present_files(Git& git, const std::string& path)
+    {
+        if(git.scope_.empty())
+            return true;
+
+        if(!load_index(git))
+            return false;
+
+        const auto root = fs::path(git.path_);
+        std::vector<git_index_entry> entries;
+        std::vector<std::string> names;
+        for(size_t i = 0, end = git_index_entrycount(&*git.index_); i < end; ++i)
+        {
+            const auto ptr = git_index_get_byindex(&*git.index_, i);
+            if(!(ptr->flags_extended & GIT_IDXENTRY_SKIP_WORKTREE))
+                continue;
+
+            if(strncmp(ptr->path, path.data(), path.size()))
+                continue;
+
+            std::error_code ec;
+            if(!fs::is_regular_file(root / ptr->path, ec))
+                continue;
+
+            entries.push_back(*ptr);
+            names.emplace_back(ptr->path);
+        }
+        if(entries.empty())
+            return true;
+
+        // entries are updated in place by git_index_add
+        for(size_t i = 0; i < entries.size(); ++i)
+        {
+            auto& entry = entries[i];
+            entry.path = names[i].data();
+            entry.flags_extended &= ~GIT_IDXENTRY_SKIP_WORKTREE;
+            const auto err = git_index_add(&*git.index_, &entry);
+            if(err != GIT_OK)
+                FAIL_WITH(false, git, "unable to update %s in index", entry.path);
+        }
+
+        const auto err = git_index_write(&*git.index_);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to write index");
+
+        return true;
+    }
+
     std::unique_ptr<git_blob> get_blob(git_repository* repo, const git_oid& oid)
     {
         git_blob* ptr_blob = nullptr;
@@ -388,31 +631,108 @@ namespace
         return make_unique(ptr_blob);
     }
 
-    template<typename T>
-    bool diff_foreach(Git& git, git_diff* diff, const T& on_blob)
+    struct Delta
+    {
+        std::string path;
+        git_oid     id;
+        bool        added;
+    };
+    using Deltas = std::vector<Delta>;
+
+    bool get_deltas(Git& git, git_diff* diff, Deltas& deltas)
     {
-        using Payload = struct
-        {
-            git_repository* repo;
-            T               on_blob;
-        };
         const auto file_cb = [](const git_diff_delta* delta, float /*progress*/, void* vpayload) -> int
         {
             if(delta->status == GIT_DELTA_CONFLICTED)
                 return GIT_OK;
 
-            const auto& payload = *static_cast<Payload*>(vpayload);
+            auto& deltas = *static_cast<Deltas*>(vpayload);
             const auto  deleted = delta->status == GIT_DELTA_DELETED;
             const auto& file    = deleted ? delta->old_file : delta->new_file;
-            return payload.on_blob(file.path, !deleted, file.id);
+            deltas.push_back({file.path, file.id, !deleted});
+            return GIT_OK;
         };
-        Payload payload{&*git.repo_, on_blob};
-        const auto err = git_diff_foreach(diff, file_cb, nullptr, nullptr, nullptr, &payload);
+        deltas.reserve(git_diff_num_deltas(diff));
+        const auto err = git_diff_foreach(diff, file_cb, nullptr, nullptr, nullptr, &deltas);
         if(err != GIT_OK)
             FAIL_WITH(false, git, "unable to iterate diff");
 
         return true;
     }
+
+    // number of blobs inflated before their callbacks are called
+    const size_t BLOB_BATCH_SIZE = 4096;
+    // minimum number of blobs inflated per worker
+    const size_t BLOB_MIN_RANGE = 64;
+
+    bool read_blobs(git_repository* repo, const Deltas& deltas, size_t begin, size_t end, std::vector<std::string>& blobs, size_t offset)
+    {
+        for(auto i = begin; i < end; ++i)
+        {
+            const auto blob = get_blob(repo, deltas[i].id);
+            if(!blob)
+                return false;
+
+            const auto ptr = static_cast<const char*>(git_blob_rawcontent(&*blob));
+            blobs[i - offset].assign(ptr, git_blob_rawsize(&*blob));
+        }
+        return true;
+    }
+
+    // inflate [begin, end) deltas into blobs, possibly on multiple threads
+    // libgit2 objects must not be shared between threads,
+    // so every worker opens its own repository handle
+    bool inflate_blobs(Git& git, const Deltas& deltas, size_t begin, size_t end, std::vector<std::string>& blobs)
+    {
+        blobs.resize(end - begin);
+        const auto num_ranges = parallel::get_num_ranges(end - begin, BLOB_MIN_RANGE);
+        if(num_ranges < 2)
+            return read_blobs(&*git.repo_, deltas, begin, end, blobs, begin);
+
+        const auto path = std::string(git_repository_path(&*git.repo_));
+        std::vector<uint8_t> oks(num_ranges, false);
+        parallel::for_ranges(end - begin, BLOB_MIN_RANGE, [&](size_t idx, size_t range_begin, size_t range_end)
+        {
+            git_repository* ptr_repo = nullptr;
+            const auto err = git_repository_open(&ptr_repo, path.data());
+            if(err != GIT_OK)
+                return;
+
+            const auto repo = make_unique(ptr_repo);
+            oks[idx] = read_blobs(ptr_repo, deltas, begin + range_begin, begin + range_end, blobs, begin);
+        });
+        for(const auto ok : oks)
+            if(!ok)
+                FAIL_WITH(false, git, "unable to read blobs");
+
+        return true;
+    }
+
+    // inflate blobs by batches & call on_blob on each of them in diff order
+    template<typename T>
+    bool diff_foreach(Git& git, git_diff* diff, const T& on_blob)
+    {
+        Deltas deltas;
+        if(!get_deltas(git, diff, deltas))
+            return false;
+
+        std::vector<std::string> blobs;
+        for(size_t begin = 0; begin < deltas.size(); begin += BLOB_BATCH_SIZE)
+        {
+            const auto end = std::min(deltas.size(), begin + BLOB_BATCH_SIZE);
+            if(!inflate_blobs(git, deltas, begin, end, blobs))
+                return false;
+
+            for(auto i = begin; i < end; ++i)
+            {
+                const auto& blob = blobs[i - begin];
+                const auto err = on_blob(deltas[i].path.data(), deltas[i].added, blob.data(), blob.size());
+                if(err != GIT_OK)
+                    FAIL_WITH(false, git, "unable to iterate diff");
+            }
+        }
+        return true;
+    }
 }
 
 bool Git::diff_index(const std::string& from, const Git::on_blob_fn& on_blob)
@@ -421,17 +741,39 @@ bool Git::diff_index(const std::string& from, const Git::on_blob_fn& on_blob)
     if(!from_tree)
         return false;
 
+    // out-of-scope blobs are neither read nor parsed
+    git_diff_options opts;
+    git_diff_init_options(&opts, GIT_DIFF_OPTIONS_VERSION);
+    opts.pathspec = get_scope(*this);
     git_diff* ptr_diff = nullptr;
-    const auto err = git_diff_tree_to_index(&ptr_diff, &*repo_, &*from_tree, nullptr, nullptr);
+    const auto err = git_diff_tree_to_index(&ptr_diff, &*repo_, &*from_tree, nullptr, &opts);
     if(err != GIT_OK)
         FAIL_WITH(false, *this, "unable to diff tree to index");
 
     const auto diff = make_unique(ptr_diff);
-    return diff_foreach(*this, ptr_diff, [&](const char* path, bool added, const git_oid& oid)
-    {
-        const auto blob = get_blob(&*repo_, oid);
-        return on_blob(path, added, git_blob_rawcontent(&*blob), git_blob_rawsize(&*blob));
-    });
+    return diff_foreach(*this, ptr_diff, on_blob);
+}
+
+bool Git::diff_trees(const std::string& from, const std::string& to, const Git::on_blob_fn& on_blob)
+{
+    const auto from_tree = get_tree(*this, from);
+    if(!from_tree)
+        return false;
+
+    const auto to_tree = get_tree(*this, to);
+    if(!to_tree)
+        return false;
+
+    git_diff_options opts;
+    git_diff_init_options(&opts, GIT_DIFF_OPTIONS_VERSION);
+    opts.pathspec = get_scope(*this);
+    git_diff* ptr_diff = nullptr;
+    const auto err = git_diff_tree_to_tree(&ptr_diff, &*repo_, &*from_tree, &*to_tree, &opts);
+    if(err != GIT_OK)
+        FAIL_WITH(false, *this, "unable to diff tree to tree");
+
+    const auto diff = make_unique(ptr_diff);
+    return diff_foreach(*this, ptr_diff, on_blob);
 }
 
 namespace
@@ -497,6 +839,7 @@ namespace
         git_rebase* ptr_rebase = nullptr;
         git_rebase_options options;
         git_rebase_init_options(&options, GIT_REBASE_OPTIONS_VERSION);
+        options.checkout_options.paths = get_scope(git);
         auto err = git_rebase_open(&ptr_rebase, &*git.repo_, &options);
         if(err == GIT_OK)
             return make_unique(ptr_rebase);
@@ -560,17 +903,10 @@ namespace
 
     bool fixup_blobs(Git& git, git_diff* ptr_diff, IPatcher& patcher, const on_fixup_fn& on_fixup)
     {
-        const auto ok = diff_foreach(git, ptr_diff, [&](const char* path, bool added, const git_oid& oid)
+        const auto ok = diff_foreach(git, ptr_diff, [&](const char* path, bool added, const char* ptr, size_t size)
         {
-            if(!added)
-                return GIT_OK;
-
-            const auto blob = get_blob(&*git.repo_, oid);
-            if(!blob)
-                added = added;
-            const auto ptr  = reinterpret_cast<const char*>(git_blob_rawcontent(&*blob));
-            const auto size = git_blob_rawsize(&*blob);
-            patcher.add(path, ptr, size);
+            if(added)
+                patcher.add(path, ptr, size);
             return GIT_OK;
         });
         if(!ok)
@@ -600,7 +936,10 @@ namespace
         const auto local_tree = get_tree_from_oid(git, oid);
         git_oid_cpy(&oid, &remote);
         const auto remote_tree = get_tree_from_oid(git, remote);
-        const auto err = git_diff_tree_to_tree(&ptr_diff, &*git.repo_, &*local_tree, &*remote_tree, nullptr);
+        git_diff_options opts;
+        git_diff_init_options(&opts, GIT_DIFF_OPTIONS_VERSION);
+        opts.pathspec = get_scope(git);
+        const auto err = git_diff_tree_to_tree(&ptr_diff, &*git.repo_, &*local_tree, &*remote_tree, &opts);
         if(err != GIT_OK)
             FAIL_WITH(false, git, "unable to diff tree to tree");
 
@@ -632,8 +971,11 @@ namespace
             FAIL_WITH(false, git, "unable to get tree from oid");
 
         const auto root = fs::path(git.path_);
+        git_diff_options opts;
+        git_diff_init_options(&opts, GIT_DIFF_OPTIONS_VERSION);
+        opts.pathspec = get_scope(git);
         git_diff* ptr_diff = nullptr;
-        const auto err = git_diff_tree_to_index(&ptr_diff, &*git.repo_, &*prev, nullptr, nullptr);
+        const auto err = git_diff_tree_to_index(&ptr_diff, &*git.repo_, &*prev, nullptr, &opts);
         if(err != GIT_OK)
             FAIL_WITH(false, git, "unable to diff tree to index");
 
@@ -660,8 +1002,39 @@ namespace
         return true;
     }
 
+    // libgit2 only checks out in-scope files, so out-of-scope
+    // index entries must be merged again from the current operation
+    bool apply_rebase_scope(Git& git, const git_rebase_operation* op)
+    {
+        if(git.scope_.empty())
+            return true;
+
+        const auto commit = get_commit_from_oid(git, op->id);
+        if(!commit)
+            return false;
+
+        const auto parent_id    = git_commit_parent_id(&*commit, 0);
+        const auto parent_tree  = parent_id ? get_tree_from_oid(git, *parent_id) : std::nullptr_t();
+        const auto head_tree    = get_tree(git, "HEAD");
+        const auto current_tree = get_tree_from_oid(git, op->id);
+        if((parent_id && !parent_tree) || !head_tree || !current_tree)
+            return false;
+
+        git_index* ptr_index = nullptr;
+        const auto err = git_merge_trees(&ptr_index, &*git.repo_, parent_tree.get(), &*head_tree, &*current_tree, nullptr);
+        if(err != GIT_OK)
+            FAIL_WITH(false, git, "unable to merge trees");
+
+        const auto index = make_unique(ptr_index);
+        return apply_scope(git, ptr_index);
+    }
+
     bool rebase(Git& git, git_rebase* ptr_rebase, IPatcher& patcher, const on_fixup_fn& on_fixup, const Git::on_conflict_fn& on_conflict)
     {
+        // rebase checkout moved HEAD without out-of-scope entries
+        if(!apply_scope_from(git, "HEAD"))
+            FAIL_WITH(false, git, "unable to apply scope on rebase");
+
         // initialize previous oid
         git_oid prev;
         replay_remote_first(git, prev, ptr_rebase, patcher, on_fixup);
@@ -682,6 +1055,9 @@ namespace
             if(!load_index(git))
                 FAIL_WITH(false, git, "unable to load index");
 
+            if(!apply_rebase_scope(git, op))
+                FAIL_WITH(false, git, "unable to apply scope during rebase");
+
             auto ok = fixup_rebase(git, prev, patcher, on_fixup, on_conflict);
             if(!ok)
                 FAIL_WITH(false, git, "error during rebase fixup");
@@ -724,6 +1100,7 @@ bool Git::rebase(const std::string& upstream, const std::string& dst, IPatcher&
     if(!ok)
     {
         const auto err = git_rebase_abort(&*rebase);
+        apply_scope_from(*this, "HEAD");
         if(err != GIT_OK)
             FAIL_WITH(false, *this, "unable to abort rebase");
         return false;
@@ -733,7 +1110,7 @@ bool Git::rebase(const std::string& upstream, const std::string& dst, IPatcher&
     if(err != GIT_OK)
         FAIL_WITH(false, *this, "unable to finish rebase");
 
-    return true;
+    return apply_scope_from(*this, "HEAD");
 }
 
 namespace
@@ -798,13 +1175,44 @@ bool Git::commit(const std::string& message)
 
 bool Git::checkout_head()
 {
+    // local out-of-scope files are discarded too
+    if(!unskip_present_files(*this, std::string()))
+        return false;
+
     git_checkout_options opts;
     git_checkout_init_options(&opts, GIT_CHECKOUT_OPTIONS_VERSION);
     opts.checkout_strategy = GIT_CHECKOUT_FORCE;
+    opts.paths = get_scope(*this);
     const auto err = git_checkout_head(&*repo_, &opts);
     if(err != GIT_OK)
         FAIL_WITH(false, *this, "unable to checkout head");
 
+    return apply_scope_from(*this, "HEAD");
+}
+
+bool Git::set_scope(const std::vector<std::string>& pathspecs)
+{
+    scope_ = pathspecs;
+    scope_ptrs_.clear();
+    for(const auto& spec : scope_)
+        scope_ptrs_.push_back(const_cast<char*>(spec.data()));
+    if(git_repository_head_unborn(&*repo_) == 1)
+        return true;
+
+    // hide out-of-scope files first, so that entries
+    // entering the scope are restored by the checkout below
+    const auto ok = scope_.empty() ? apply_scope(*this, nullptr) : apply_scope_from(*this, "HEAD");
+    if(!ok)
+        return false;
+
+    git_checkout_options opts;
+    git_checkout_init_options(&opts, GIT_CHECKOUT_OPTIONS_VERSION);
+    opts.checkout_strategy = GIT_CHECKOUT_SAFE | GIT_CHECKOUT_RECREATE_MISSING;
+    opts.paths = get_scope(*this);
+    const auto err = git_checkout_head(&*repo_, &opts);
+    if(err != GIT_OK)
+        FAIL_WITH(false, *this, "unable to checkout scope");
+
     return true;
 }
 
@@ -905,6 +1313,9 @@ bool Git::status(const std::string& path, const on_status_fn& on_status)
         opts.pathspec.count = 1;
     }
 
+    if(!unskip_present_files(*this, path))
+        return false;
+
     Payload payload{on_status};
     const auto err = git_status_foreach_ext(&*repo_, &opts, callback, &payload);
     if(err != GIT_OK)
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <functional>
+#include <vector>
 
 using on_fixup_fn = std::function<bool(std::string& path, const char* ptr, size_t size)>;
 
@@ -69,6 +70,7 @@ struct IGit
     virtual std::string config_get_string   (const std::string& name) = 0;
     virtual bool        config_set_string   (const std::string& name, const std::string& value) = 0;
     virtual bool        diff_index          (const std::string& from, const on_blob_fn& on_blob) = 0;
+    virtual bool        diff_trees          (const std::string& from, const std::string& to, const on_blob_fn& on_blob) = 0;
     virtual bool        rebase              (const std::string& upstreal, const std::string& dst, IPatcher& patcher, const on_fixup_fn& on_fixup, const on_conflict_fn& on_conflict) = 0;
     virtual bool        commit              (const std::string& message) = 0;
     virtual bool        checkout_head       () = 0;
@@ -77,6 +79,7 @@ struct IGit
     virtual bool        push                (const std::string& src, const std::string& remote, const std::string& dst) = 0;
     virtual bool        remotes             (const on_remote_fn& on_remote) = 0;
     virtual bool        status              (const std::string& path, const on_status_fn& on_path) = 0;
+    virtual bool        set_scope           (const std::vector<std::string>& pathspecs) = 0;
     virtual void        flush               () = 0;
 };
 
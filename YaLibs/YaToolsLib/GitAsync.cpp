@@ -158,6 +158,7 @@ namespace
         std::string config_get_string   (const std::string& name) override;
         bool        config_set_string   (const std::string& name, const std::string& value) override;
         bool        diff_index          (const std::string& from, const on_blob_fn& on_blob) override;
+        bool        diff_trees          (const std::string& from, const std::string& to, const on_blob_fn& on_blob) override;
         bool        rebase              (const std::string& upstream, const std::string& dst, IPatcher& patcher, const on_fixup_fn& on_fixup, const on_conflict_fn& on_conflict) override;
         bool        commit              (const std::string& message) override;
         bool        checkout_head       () override;
@@ -166,6 +167,7 @@ namespace
         bool        push                (const std::string& src, const std::string& remote, const std::string& dst) override;
         bool        remotes             (const on_remote_fn& on_remote) override;
         bool        status              (const std::string& path, const on_status_fn& on_path) override;
+        bool        set_scope           (const std::vector<std::string>& pathspecs) override;
         void        flush               () override;
 
         std::shared_ptr<IGit>   git_;
@@ -259,6 +261,12 @@ bool GitAsync::diff_index(const std::string& from, const on_blob_fn& on_blob)
     return git_->diff_index(from, on_blob);
 }
 
+bool GitAsync::diff_trees(const std::string& from, const std::string& to, const on_blob_fn& on_blob)
+{
+    const auto flusher = Flusher{*this};
+    return git_->diff_trees(from, to, on_blob);
+}
+
 bool GitAsync::rebase(const std::string& upstream, const std::string& dst, IPatcher& patcher, const on_fixup_fn& on_fixup, const on_conflict_fn& on_conflict)
 {
     const auto flusher = Flusher{*this};
@@ -309,6 +317,12 @@ bool GitAsync::status(const std::string& path, const on_status_fn& on_path)
     return git_->status(path, on_path);
 }
 
+bool GitAsync::set_scope(const std::vector<std::string>& pathspecs)
+{
+    const auto flusher = Flusher{*this};
+    return git_->set_scope(pathspecs);
+}
+
 void GitAsync::flush()
 {
     worker_.post([]{}).wait();
@@ -18,6 +18,8 @@
 #include "Helpers.h"
 
 #include <functional>
+#include <unordered_set>
+#include <vector>
 
 STATIC_ASSERT_POD(HVersion);
 
@@ -86,6 +88,64 @@ int HVersion::string_type()const
     return model_->string_type(idx_);
 }
 
+FunctionSummary HVersion::summary() const
+{
+    return model_->summary(idx_);
+}
+
+FunctionSummary summarize_function(const HVersion& version)
+{
+    FunctionSummary summary = {};
+    if(version.type() != OBJECT_TYPE_FUNCTION)
+        return summary;
+
+    summary.size = version.size();
+    std::vector<HVersion> blocks;
+    std::unordered_set<VersionIndex> block_idxs;
+    version.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+    {
+        switch(xref.type())
+        {
+            case OBJECT_TYPE_BASIC_BLOCK:
+                if(block_idxs.insert(xref.idx_).second)
+                    blocks.push_back(xref);
+                break;
+
+            case OBJECT_TYPE_STACKFRAME:
+                summary.frame_size = xref.size();
+                break;
+
+            default:
+                break;
+        }
+        return WALK_CONTINUE;
+    });
+    summary.basic_blocks = static_cast<uint32_t>(blocks.size());
+
+    std::unordered_set<VersionIndex> callees;
+    for(const auto& block : blocks)
+        block.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+        {
+            const auto type = xref.type();
+            if(type == OBJECT_TYPE_BASIC_BLOCK && block_idxs.count(xref.idx_))
+                ++summary.edges;
+            else if(type == OBJECT_TYPE_FUNCTION)
+                callees.insert(xref.idx_);
+            return WALK_CONTINUE;
+        });
+    summary.callees = static_cast<uint32_t>(callees.size());
+
+    std::unordered_set<YaToolObjectId> callers;
+    version.walk_xrefs_to([&](const HVersion& from)
+    {
+        if(from.type() == OBJECT_TYPE_BASIC_BLOCK)
+            callers.insert(from.parent_id());
+        return WALK_CONTINUE;
+    });
+    summary.callers = static_cast<uint32_t>(callers.size());
+    return summary;
+}
+
 void HVersion::walk_blobs(const IVersions::OnBlobFn& fnWalk)const
 {
     model_->walk_blobs(idx_, fnWalk);
@@ -40,6 +40,7 @@ struct HVersion
     int                 string_type         () const;
     const_string_ref    header_comment      (bool repeatable) const;
     bool                has_header_comment  (bool repeatable) const;
+    FunctionSummary     summary             () const;
 
     void                walk_signatures         (const IVersions::OnSignatureFn& fnWalk) const;
     bool                has_signatures          () const;
@@ -88,6 +89,10 @@ struct HVersion
     VersionIndex        idx_;
 };
 
+// computes a function summary from the model graph
+// zero-initialized for other object types
+FunctionSummary summarize_function(const HVersion& version);
+
 namespace std
 {
     template<>
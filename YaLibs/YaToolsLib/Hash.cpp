@@ -45,6 +45,18 @@ namespace
         wbe32(&ptr[4], static_cast<uint32_t>(x & 0xFFFFFFFF));
     }
 
+    struct ImageBase
+    {
+        bool     relative;
+        uint64_t base;
+    };
+    ImageBase g_image_base = {false, 0};
+
+    inline uint64_t to_offset(uint64_t ea)
+    {
+        return ea - g_image_base.base;
+    }
+
     YaToolObjectId process_hash(const Hashed& value)
     {
         char buffer[20];
@@ -63,12 +75,12 @@ YaToolObjectId hash::hash_binary()
 
 YaToolObjectId hash::hash_segment(uint64_t ea)
 {
-    return process_hash({0, ea, OBJECT_TYPE_SEGMENT});
+    return process_hash({0, to_offset(ea), OBJECT_TYPE_SEGMENT});
 }
 
 YaToolObjectId hash::hash_segment_chunk(uint64_t ea)
 {
-    return process_hash({0, ea, OBJECT_TYPE_SEGMENT_CHUNK});
+    return process_hash({0, to_offset(ea), OBJECT_TYPE_SEGMENT_CHUNK});
 }
 
 YaToolObjectId hash::hash_enum(const const_string_ref& name)
@@ -97,7 +109,7 @@ YaToolObjectId hash::hash_local_type(const const_string_ref& id)
 
 YaToolObjectId hash::hash_stack(uint64_t ea)
 {
-    return process_hash({0, ea, OBJECT_TYPE_STACKFRAME});
+    return process_hash({0, to_offset(ea), OBJECT_TYPE_STACKFRAME});
 }
 
 YaToolObjectId hash::hash_member(YaToolObjectId parent, uint64_t offset)
@@ -109,16 +121,50 @@ YaToolObjectId hash::hash_member(YaToolObjectId parent, uint64_t offset)
 
 YaToolObjectId hash::hash_function(uint64_t ea)
 {
-    return process_hash({0, ea, OBJECT_TYPE_FUNCTION});
+    return process_hash({0, to_offset(ea), OBJECT_TYPE_FUNCTION});
 }
 
 YaToolObjectId hash::hash_ea(uint64_t ea)
 {
     // either CODE, DATA or BASIC_BLOCK
-    return process_hash({0, ea, OBJECT_TYPE_BASIC_BLOCK});
+    return process_hash({0, to_offset(ea), OBJECT_TYPE_BASIC_BLOCK});
 }
 
 YaToolObjectId hash::hash_reference(uint64_t ea, uint64_t base)
 {
-    return process_hash({base, ea, OBJECT_TYPE_REFERENCE_INFO});
+    return process_hash({to_offset(base), to_offset(ea), OBJECT_TYPE_REFERENCE_INFO});
+}
+
+void hash::set_relative_ids(bool enabled, uint64_t image_base)
+{
+    g_image_base = {enabled, enabled ? image_base : 0};
+}
+
+bool hash::has_relative_ids()
+{
+    return g_image_base.relative;
+}
+
+uint64_t hash::get_image_base()
+{
+    return g_image_base.base;
+}
+
+bool hash::is_located(YaToolObjectType_e type)
+{
+    switch(type)
+    {
+        case OBJECT_TYPE_SEGMENT:
+        case OBJECT_TYPE_SEGMENT_CHUNK:
+        case OBJECT_TYPE_FUNCTION:
+        case OBJECT_TYPE_STACKFRAME:
+        case OBJECT_TYPE_CODE:
+        case OBJECT_TYPE_DATA:
+        case OBJECT_TYPE_BASIC_BLOCK:
+        case OBJECT_TYPE_REFERENCE_INFO:
+            return true;
+
+        default:
+            return false;
+    }
 }
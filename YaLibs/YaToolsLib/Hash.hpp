@@ -31,4 +31,11 @@ namespace hash
     YaToolObjectId  hash_function       (uint64_t ea);
     YaToolObjectId  hash_ea             (uint64_t ea);
     YaToolObjectId  hash_reference      (uint64_t ea, uint64_t base);
+
+    // when enabled, located objects ids & addresses are relative
+    // to the image base, so rebasing a binary keeps them stable
+    void            set_relative_ids    (bool enabled, uint64_t image_base);
+    bool            has_relative_ids    ();
+    uint64_t        get_image_base      (); // zero when disabled
+    bool            is_located          (YaToolObjectType_e type);
 };
\ No newline at end of file
@@ -53,6 +53,7 @@ struct IVersions
     virtual int                 string_type     (VersionIndex idx) const = 0;
     virtual const_string_ref    header_comment  (VersionIndex idx, bool repeatable) const = 0;
     virtual bool                has_signature   (VersionIndex idx) const = 0;
+    virtual FunctionSummary     summary         (VersionIndex idx) const = 0;
 
     virtual void                walk_signatures         (VersionIndex idx, const OnSignatureFn& fnWalk) const = 0;
     virtual void                walk_xrefs_from         (VersionIndex idx, const OnXrefFromFn& fnWalk) const = 0;
@@ -74,6 +75,14 @@ struct ISignatures
     virtual Signature get(HSignature_id_t id) const = 0;
 };
 
+/**
+ * Thread-safety
+ * A model is immutable once built: a flatbuffer model on creation, a memory
+ * model when visit_end returns. From then on, every const method of IModel,
+ * and of the HVersion & HSignature handles it returns, may be called
+ * concurrently from any number of threads without locking.
+ * Building a model or calling accept is not thread-safe.
+ */
 struct IModel
 {
     virtual ~IModel() = default;
@@ -92,6 +101,11 @@ struct IModel
     virtual void                walk_matching   (const HSignature& sig, const OnVersionFn& fnWalk) const = 0;
     virtual void                walk_uniques    (const OnSignatureFn& fnWalk) const = 0;
 
+    // versions are walked grouped by ordered_types, in a stable order
+    // walk_range walks positions [begin, end) of this order
+    virtual void                walk_range      (const VersionRange& range, const OnVersionFn& fnWalk) const = 0;
+    virtual VersionRange        type_range      (YaToolObjectType_e type) const = 0;
+
     /**
      * Return all the versions from this object that match a version of another object
      * If the signature has collisions, the local version is checked for its size, and the match is ignored
@@ -17,6 +17,9 @@
 
 #include "YaTypes.hpp"
 
+struct VersionRecord;
+void accept_record(const VersionRecord& record, IModelVisitor& visitor);
+
 struct IModelVisitor
 {
     virtual ~IModelVisitor() = default;
@@ -51,4 +54,8 @@ struct IModelVisitor
     virtual void visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value) = 0;
     virtual void visit_blob(offset_t offset, const void* blob, size_t len) = 0;
     virtual void visit_flags(flags_t flags) = 0;
+
+    // visits one whole version at once
+    // defaults to fine-grained calls, see VersionRecord.hpp
+    virtual void visit_version(const VersionRecord& record) { accept_record(record, *this); }
 };
@@ -21,6 +21,7 @@
 #include "HSignature.hpp"
 #include "IModelSink.hpp"
 #include "ModelIndex.hpp"
+#include "VersionRecord.hpp"
 
 #include <assert.h>
 #include <functional>
@@ -306,6 +307,7 @@ struct ViewVersions
     int                 string_type     (VersionIndex idx) const override;
     const_string_ref    header_comment  (VersionIndex idx, bool repeatable) const override;
     bool                has_signature   (VersionIndex idx) const override;
+    FunctionSummary     summary         (VersionIndex idx) const override;
 
     void                walk_signatures         (VersionIndex idx, const OnSignatureFn& fnWalk) const override;
     void                walk_xrefs_from         (VersionIndex idx, const OnXrefFromFn& fnWalk) const override;
@@ -372,6 +374,7 @@ struct Model
     void visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value) override;
     void visit_blob(offset_t offset, const void* blob, size_t len) override;
     void visit_flags(flags_t flags) override;
+    void visit_version(const VersionRecord& record) override;
 
 
     // IModel
@@ -384,6 +387,8 @@ struct Model
     bool        has             (YaToolObjectId id) const override;
     void        walk_uniques    (const OnSignatureFn& fnWalk) const override;
     void        walk_matching   (const HVersion& object, size_t min_size, const OnVersionFn& fnWalk) const override;
+    void        walk_range      (const VersionRange& range, const OnVersionFn& fnWalk) const override;
+    VersionRange type_range     (YaToolObjectType_e type) const override;
 
     ViewVersions                    view_versions_;
     ViewSignatures                  view_signatures_;
@@ -392,6 +397,7 @@ struct Model
     std::vector<StdSignature>       signatures_;
     std::vector<StdVersion>         deleted_;
     std::vector<const StdVersion*>  ordered_;
+    VersionRange                    type_ranges_[OBJECT_TYPE_COUNT];
     ModelIndex                      index_;
 };
 }
@@ -399,6 +405,7 @@ struct Model
 Model::Model()
     : view_versions_    (*this)
     , view_signatures_  (*this)
+    , type_ranges_      ()
 {
 }
 
@@ -446,77 +453,62 @@ void walk_xrefs(const Model&, const StdVersion& version, const T& operand)
             return;
 }
 
-void accept_version(const Model& db, const StdVersion& version, IModelVisitor& visitor)
+const_string_ref make_record_string(const std::string& value)
 {
-    visitor.visit_start_version(version.type, version.id);
-    visitor.visit_size(version.size);
-    visitor.visit_parent_id(version.parent);
-    visitor.visit_address(version.address);
-
-    if(!version.username.value.empty())
-        visitor.visit_name(make_string_ref(version.username.value), version.username.flags);
-
-    if(!version.prototype.empty())
-        visitor.visit_prototype(make_string_ref(version.prototype));
-
-    visitor.visit_flags(version.flags);
+    if(value.empty())
+        return const_string_ref{nullptr, 0};
+    return make_string_ref(value);
+}
 
-    const auto string_type = version.strtype;
-    if(string_type != UINT8_MAX)
-        visitor.visit_string_type(string_type);
+const VersionRecord& make_record(VersionRecordBuffer& buf, const Model& db, const StdVersion& version)
+{
+    buf.clear();
+    auto& r = buf.record;
+    r.type                          = version.type;
+    r.id                            = version.id;
+    r.parent_id                     = version.parent;
+    r.address                       = version.address;
+    r.size                          = version.size;
+    r.flags                         = version.flags;
+    r.string_type                   = version.strtype;
+    r.username                      = make_record_string(version.username.value);
+    r.username_flags                = version.username.flags;
+    r.prototype                     = make_record_string(version.prototype);
+    r.header_comment_repeatable     = make_record_string(version.header_comment_repeatable);
+    r.header_comment_nonrepeatable  = make_record_string(version.header_comment_nonrepeatable);
 
-    // signatures
-    visitor.visit_start_signatures();
     walk_signatures(db, version, [&](HSignature_id_t, const StdSignature& sig)
     {
         const auto& s = sig.value;
-        visitor.visit_signature(s.method, s.algo, make_string_ref(s.buffer));
+        buf.signatures.push_back({make_string_ref(s.buffer), s.method, s.algo});
         return WALK_CONTINUE;
     });
-    visitor.visit_end_signatures();
-
-    if(!version.header_comment_repeatable.empty())
-        visitor.visit_header_comment(true, make_string_ref(version.header_comment_repeatable));
-
-    if(!version.header_comment_nonrepeatable.empty())
-        visitor.visit_header_comment(false, make_string_ref(version.header_comment_nonrepeatable));
-
-    // offsets
-    if(!version.comments.empty() || !version.valueviews.empty() || !version.registerviews.empty() || !version.hiddenareas.empty())
-    {
-        visitor.visit_start_offsets();
-        for(const auto& comment : version.comments)
-            visitor.visit_offset_comments(comment.offset, comment.type, make_string_ref(comment.value));
-        for(const auto& view : version.valueviews)
-            visitor.visit_offset_valueview(view.offset, view.operand, make_string_ref(view.value));
-        for(const auto& view : version.registerviews)
-            visitor.visit_offset_registerview(view.offset, view.end_offset, make_string_ref(view.name), make_string_ref(view.new_name));
-        for(const auto& hidden : version.hiddenareas)
-            visitor.visit_offset_hiddenarea(hidden.offset, hidden.area_size, make_string_ref(hidden.value));
-        visitor.visit_end_offsets();
-    }
-
-    // xrefs
-    visitor.visit_start_xrefs();
+    for(const auto& comment : version.comments)
+        buf.comments.push_back({comment.offset, comment.type, make_string_ref(comment.value)});
+    for(const auto& view : version.valueviews)
+        buf.valueviews.push_back({view.offset, view.operand, make_string_ref(view.value)});
+    for(const auto& view : version.registerviews)
+        buf.registerviews.push_back({view.offset, view.end_offset, make_string_ref(view.name), make_string_ref(view.new_name)});
+    for(const auto& hidden : version.hiddenareas)
+        buf.hiddenareas.push_back({hidden.offset, hidden.area_size, make_string_ref(hidden.value)});
     walk_xrefs(db, version, [&](const StdXref& xref)
     {
-        visitor.visit_start_xref(xref.offset, xref.id, xref.operand);
+        buf.xrefs.push_back({xref.offset, xref.id, xref.operand, {nullptr, xref.attributes.size()}});
+        buf.xref_attributes_idx.push_back(buf.xref_attributes.size());
         for(const auto& attr : xref.attributes)
-            visitor.visit_xref_attribute(make_string_ref(attr.key), make_string_ref(attr.value));
-        visitor.visit_end_xref();
+            buf.xref_attributes.push_back({make_string_ref(attr.key), make_string_ref(attr.value)});
         return WALK_CONTINUE;
     });
-    visitor.visit_end_xrefs();
-
-    // attributes
     for(const auto& attr : version.attributes)
-        visitor.visit_attribute(make_string_ref(attr.key), make_string_ref(attr.value));
-
-    // blobs
+        buf.attributes.push_back({make_string_ref(attr.key), make_string_ref(attr.value)});
     for(const auto& blob : version.blobs)
-        visitor.visit_blob(blob.offset, &blob.data[0], blob.data.size());
+        buf.blobs.push_back({blob.offset, blob.data.data(), blob.data.size()});
+    return buf.finish();
+}
 
-    visitor.visit_end_version();
+void accept_version(VersionRecordBuffer& buf, const Model& db, const StdVersion& version, IModelVisitor& visitor)
+{
+    visitor.visit_version(make_record(buf, db, version));
 }
 
 void finish_index(Model& db)
@@ -555,6 +547,15 @@ void Model::visit_end()
     {
         return std::make_pair(indexed_types[a->type], a->id) < std::make_pair(indexed_types[b->type], b->id);
     });
+    for(auto& range : type_ranges_)
+        range = {0, 0};
+    for(size_t i = 0; i < ordered_.size(); ++i)
+    {
+        auto& range = type_ranges_[ordered_[i]->type];
+        if(range.begin == range.end)
+            range.begin = i;
+        range.end = i + 1;
+    }
 }
 
 void Model::visit_start_version(YaToolObjectType_e type, YaToolObjectId id)
@@ -705,13 +706,63 @@ void Model::visit_flags(flags_t flags)
     current_.flags = flags;
 }
 
+void Model::visit_version(const VersionRecord& record)
+{
+    visit_start_version(record.type, record.id);
+    current_.parent = record.parent_id;
+    current_.address = record.address;
+    current_.size = record.size;
+    current_.flags = record.flags;
+    current_.strtype = static_cast<uint8_t>(record.string_type);
+    if(record.username.value)
+    {
+        current_.username.value = make_string(record.username);
+        current_.username.flags = record.username_flags;
+    }
+    if(record.prototype.value)
+        current_.prototype = make_string(record.prototype);
+    if(record.header_comment_repeatable.value)
+        current_.header_comment_repeatable = make_string(record.header_comment_repeatable);
+    if(record.header_comment_nonrepeatable.value)
+        current_.header_comment_nonrepeatable = make_string(record.header_comment_nonrepeatable);
+
+    const auto idx = static_cast<VersionIndex>(versions_.size());
+    for(const auto& sig : record.signatures)
+    {
+        current_.sig_idx = std::min(current_.sig_idx, static_cast<HSignature_id_t>(signatures_.size()));
+        signatures_.push_back({MakeSignature(sig.algo, sig.method, sig.value), idx});
+    }
+    for(const auto& comment : record.comments)
+        current_.comments.emplace_back(make_string(comment.value), comment.offset, comment.type);
+    for(const auto& view : record.valueviews)
+        current_.valueviews.emplace_back(make_string(view.value), view.offset, view.operand);
+    for(const auto& view : record.registerviews)
+        current_.registerviews.emplace_back(make_string(view.name), make_string(view.new_name), view.offset, view.end_offset);
+    for(const auto& hidden : record.hiddenareas)
+        current_.hiddenareas.emplace_back(make_string(hidden.value), hidden.offset, hidden.area_size);
+    current_.xrefs.reserve(record.xrefs.size);
+    for(const auto& xref : record.xrefs)
+    {
+        current_.xrefs.emplace_back(std::vector<StdAttribute>(), xref.offset, xref.id, xref.operand);
+        auto& attributes = current_.xrefs.back().attributes;
+        for(const auto& attr : xref.attributes)
+            attributes.emplace_back(make_string(attr.key), make_string(attr.value));
+    }
+    for(const auto& attr : record.attributes)
+        current_.attributes.emplace_back(make_string(attr.key), make_string(attr.value));
+    for(const auto& blob : record.blobs)
+        current_.blobs.emplace_back(static_cast<const uint8_t*>(blob.data), blob.size, blob.offset);
+    visit_end_version();
+}
+
 void Model::accept(IModelVisitor& visitor)
 {
     visitor.visit_start();
     for(const auto it : deleted_)
         visitor.visit_deleted(it.type, it.id);
+    VersionRecordBuffer buf;
     for(const auto& version : versions_)
-        accept_version(*this, version, visitor);
+        accept_version(buf, *this, version, visitor);
     visitor.visit_end();
 }
 
@@ -722,6 +773,22 @@ void Model::walk(const OnVersionFn& fnWalk) const
             return;
 }
 
+void Model::walk_range(const VersionRange& range, const OnVersionFn& fnWalk) const
+{
+    const auto end = std::min(range.end, ordered_.size());
+    for(auto i = range.begin; i < end; ++i)
+        if(fnWalk({&view_versions_, ordered_[i]->idx}) != WALK_CONTINUE)
+            return;
+}
+
+VersionRange Model::type_range(YaToolObjectType_e type) const
+{
+    if(static_cast<size_t>(type) >= OBJECT_TYPE_COUNT)
+        return {0, 0};
+
+    return type_ranges_[type];
+}
+
 size_t Model::size() const
 {
     return versions_.size();
@@ -796,7 +863,8 @@ bool ViewVersions::has_signature(VersionIndex idx) const
 
 void ViewVersions::accept(VersionIndex idx, IModelVisitor& visitor) const
 {
-    accept_version(db_, db_.versions_[idx], visitor);
+    VersionRecordBuffer buf;
+    accept_version(buf, db_, db_.versions_[idx], visitor);
 }
 
 YaToolObjectId ViewVersions::id(VersionIndex idx) const
@@ -856,6 +924,11 @@ const_string_ref ViewVersions::header_comment(VersionIndex idx, bool repeatable)
     return make_string_ref(value);
 }
 
+FunctionSummary ViewVersions::summary(VersionIndex idx) const
+{
+    return summarize_function({this, idx});
+}
+
 void ViewVersions::walk_signatures(VersionIndex idx, const OnSignatureFn& fnWalk) const
 {
     ::walk_signatures(db_, db_.versions_[idx], [&](HSignature_id_t id, const StdSignature&)
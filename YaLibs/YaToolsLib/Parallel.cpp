@@ -0,0 +1,115 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Parallel.hpp"
+
+#include "IModel.hpp"
+#include "HVersion.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+size_t parallel::get_num_ranges(size_t size, size_t min_range)
+{
+    if(!size)
+        return 0;
+
+    const auto max_ranges = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const auto num_ranges = (size + min_range - 1) / std::max<size_t>(1, min_range);
+    return std::min(max_ranges, std::max<size_t>(1, num_ranges));
+}
+
+namespace
+{
+    std::vector<VersionRange> split(const VersionRange& range, size_t min_range)
+    {
+        const auto size = range.end - range.begin;
+        const auto num_ranges = parallel::get_num_ranges(size, min_range);
+        std::vector<VersionRange> ranges;
+        if(!num_ranges)
+            return ranges;
+
+        const auto step = size / num_ranges;
+        const auto rest = size % num_ranges;
+        const auto get_begin = [&](size_t idx)
+        {
+            return range.begin + idx * step + std::min(idx, rest);
+        };
+        ranges.reserve(num_ranges);
+        for(size_t i = 0; i + 1 < num_ranges; ++i)
+            ranges.push_back({get_begin(i), get_begin(i + 1)});
+        ranges.push_back({get_begin(num_ranges - 1), range.end});
+        return ranges;
+    }
+
+    void walk_ranges(const IModel& model, const std::vector<VersionRange>& ranges, const parallel::on_version_fn& on_version)
+    {
+        const auto on_range = [&](size_t idx)
+        {
+            model.walk_range(ranges[idx], [&](const HVersion& version)
+            {
+                return on_version(idx, version);
+            });
+        };
+        if(ranges.empty())
+            return;
+
+        // last range is processed on current thread
+        std::vector<std::thread> workers;
+        workers.reserve(ranges.size() - 1);
+        for(size_t i = 0; i + 1 < ranges.size(); ++i)
+            workers.emplace_back(on_range, i);
+        on_range(ranges.size() - 1);
+        for(auto& worker : workers)
+            worker.join();
+    }
+}
+
+void parallel::for_ranges(size_t size, size_t min_range, const on_range_fn& on_range)
+{
+    const auto ranges = split({0, size}, min_range);
+    if(ranges.empty())
+        return;
+
+    // last range is processed on current thread
+    std::vector<std::thread> workers;
+    workers.reserve(ranges.size() - 1);
+    for(size_t i = 0; i + 1 < ranges.size(); ++i)
+        workers.emplace_back(on_range, i, ranges[i].begin, ranges[i].end);
+    on_range(ranges.size() - 1, ranges.back().begin, ranges.back().end);
+    for(auto& worker : workers)
+        worker.join();
+}
+
+std::vector<VersionRange> parallel::get_version_ranges(const IModel& model, size_t min_range)
+{
+    return split({0, model.size()}, min_range);
+}
+
+std::vector<VersionRange> parallel::get_version_ranges(const IModel& model, YaToolObjectType_e type, size_t min_range)
+{
+    return split(model.type_range(type), min_range);
+}
+
+void parallel::walk_versions(const IModel& model, size_t min_range, const on_version_fn& on_version)
+{
+    walk_ranges(model, get_version_ranges(model, min_range), on_version);
+}
+
+void parallel::walk_versions(const IModel& model, YaToolObjectType_e type, size_t min_range, const on_version_fn& on_version)
+{
+    walk_ranges(model, get_version_ranges(model, type, min_range), on_version);
+}
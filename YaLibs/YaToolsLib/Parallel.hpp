@@ -0,0 +1,46 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "YaTypes.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace parallel
+{
+    // splits [0, size) into contiguous ranges of at least min_range items,
+    // at most one per hardware thread
+    size_t  get_num_ranges(size_t size, size_t min_range);
+
+    // calls on_range once per range, concurrently
+    // ranges are indexed in increasing order, so per-range results
+    // can be merged back deterministically by the caller
+    using on_range_fn = std::function<void(size_t idx, size_t begin, size_t end)>;
+    void    for_ranges(size_t size, size_t min_range, const on_range_fn& on_range);
+
+    // splits model versions, optionally of one type only, into contiguous ranges
+    // which can be walked by any worker pool with IModel::walk_range
+    std::vector<VersionRange>   get_version_ranges(const IModel& model, size_t min_range);
+    std::vector<VersionRange>   get_version_ranges(const IModel& model, YaToolObjectType_e type, size_t min_range);
+
+    // walks model versions, optionally of one type only, concurrently
+    // on_version is called from multiple threads with the index of its range
+    // & WALK_STOP only stops the current range
+    using on_version_fn = std::function<ContinueWalking_e(size_t idx, const HVersion& version)>;
+    void    walk_versions(const IModel& model, size_t min_range, const on_version_fn& on_version);
+    void    walk_versions(const IModel& model, YaToolObjectType_e type, size_t min_range, const on_version_fn& on_version);
+}
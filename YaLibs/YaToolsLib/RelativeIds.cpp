@@ -0,0 +1,212 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "RelativeIds.hpp"
+
+#include "Hash.hpp"
+#include "HVersion.hpp"
+#include "IModel.hpp"
+#include "IModelVisitor.hpp"
+#include "Helpers.h"
+
+namespace
+{
+    const char key_txt[] = "ids";
+    const char value_txt[] = "relative";
+}
+
+const const_string_ref relative_ids::key = {key_txt, sizeof key_txt - 1};
+const const_string_ref relative_ids::value = {value_txt, sizeof value_txt - 1};
+
+bool relative_ids::is_enabled(const HVersion& binary)
+{
+    bool enabled = false;
+    binary.walk_attributes([&](const const_string_ref& k, const const_string_ref& v)
+    {
+        enabled = k == key && v == value;
+        return enabled ? WALK_STOP : WALK_CONTINUE;
+    });
+    return enabled;
+}
+
+namespace
+{
+    // hash functions translate addresses on their own,
+    // so we enable relative ids while computing them
+    struct ScopedImageBase
+    {
+        ScopedImageBase(uint64_t image_base)
+            : relative(hash::has_relative_ids())
+            , base(hash::get_image_base())
+        {
+            hash::set_relative_ids(true, image_base);
+        }
+
+        ~ScopedImageBase()
+        {
+            hash::set_relative_ids(relative, base);
+        }
+
+        const bool      relative;
+        const uint64_t  base;
+    };
+
+    YaToolObjectId get_located_id(const HVersion& hver)
+    {
+        const auto ea = hver.address();
+        switch(hver.type())
+        {
+            case OBJECT_TYPE_SEGMENT:       return hash::hash_segment(ea);
+            case OBJECT_TYPE_SEGMENT_CHUNK: return hash::hash_segment_chunk(ea);
+            case OBJECT_TYPE_FUNCTION:      return hash::hash_function(ea);
+            case OBJECT_TYPE_STACKFRAME:    return hash::hash_stack(ea);
+            case OBJECT_TYPE_CODE:
+            case OBJECT_TYPE_DATA:
+            case OBJECT_TYPE_BASIC_BLOCK:   return hash::hash_ea(ea);
+            default:                        return hver.id();
+        }
+    }
+}
+
+relative_ids::Ids relative_ids::get_ids(const IModel& model, uint64_t image_base)
+{
+    const ScopedImageBase scoped(image_base);
+    Ids ids;
+    model.walk([&](const HVersion& hver)
+    {
+        if(hash::is_located(hver.type()))
+            ids.emplace(hver.id(), get_located_id(hver));
+        return WALK_CONTINUE;
+    });
+
+    // reference infos are hashed from their referencing address
+    // & stackframe members from their parent
+    model.walk([&](const HVersion& hver)
+    {
+        hver.walk_xrefs([&](offset_t offset, operand_t /*operand*/, YaToolObjectId id, const XrefAttributes* /*attrs*/)
+        {
+            const auto ref = model.get(id);
+            if(ref.is_valid() && ref.type() == OBJECT_TYPE_REFERENCE_INFO)
+                ids[id] = hash::hash_reference(hver.address() + offset, ref.address());
+            return WALK_CONTINUE;
+        });
+        if(hver.type() == OBJECT_TYPE_STACKFRAME_MEMBER)
+        {
+            const auto it = ids.find(hver.parent_id());
+            if(it != ids.end())
+                ids.emplace(hver.id(), hash::hash_member(it->second, hver.address()));
+        }
+        return WALK_CONTINUE;
+    });
+    return ids;
+}
+
+namespace
+{
+    struct RelativeVisitor
+        : public IModelVisitor
+    {
+        RelativeVisitor(IModelVisitor& next, const relative_ids::Ids& ids, uint64_t image_base)
+            : next_(next)
+            , ids_(ids)
+            , image_base_(image_base)
+            , type_(OBJECT_TYPE_UNKNOWN)
+        {
+        }
+
+        YaToolObjectId get_id(YaToolObjectId id) const
+        {
+            const auto it = ids_.find(id);
+            return it == ids_.end() ? id : it->second;
+        }
+
+        void visit_start() override { next_.visit_start(); }
+        void visit_end() override { next_.visit_end(); }
+
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override
+        {
+            next_.visit_deleted(type, get_id(id));
+        }
+
+        void visit_start_version(YaToolObjectType_e type, YaToolObjectId id) override
+        {
+            type_ = type;
+            next_.visit_start_version(type, get_id(id));
+        }
+
+        void visit_end_version() override
+        {
+            if(type_ == OBJECT_TYPE_BINARY)
+                next_.visit_attribute(relative_ids::key, relative_ids::value);
+            next_.visit_end_version();
+        }
+
+        void visit_parent_id(YaToolObjectId parent_id) override
+        {
+            next_.visit_parent_id(get_id(parent_id));
+        }
+
+        void visit_address(offset_t address) override
+        {
+            next_.visit_address(hash::is_located(type_) ? address - image_base_ : address);
+        }
+
+        void visit_start_xref(offset_t offset, YaToolObjectId offset_value, operand_t operand) override
+        {
+            next_.visit_start_xref(offset, get_id(offset_value), operand);
+        }
+
+        void visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value) override
+        {
+            // already added on binary end
+            if(type_ == OBJECT_TYPE_BINARY && attr_name == relative_ids::key)
+                return;
+            next_.visit_attribute(attr_name, attr_value);
+        }
+
+        void visit_name(const const_string_ref& name, int flags) override { next_.visit_name(name, flags); }
+        void visit_size(offset_t size) override { next_.visit_size(size); }
+        void visit_start_signatures() override { next_.visit_start_signatures(); }
+        void visit_signature(SignatureMethod_e method, SignatureAlgo_e algo, const const_string_ref& hex) override { next_.visit_signature(method, algo, hex); }
+        void visit_end_signatures() override { next_.visit_end_signatures(); }
+        void visit_prototype(const const_string_ref& prototype) override { next_.visit_prototype(prototype); }
+        void visit_string_type(int str_type) override { next_.visit_string_type(str_type); }
+        void visit_header_comment(bool repeatable, const const_string_ref& comment) override { next_.visit_header_comment(repeatable, comment); }
+        void visit_start_offsets() override { next_.visit_start_offsets(); }
+        void visit_end_offsets() override { next_.visit_end_offsets(); }
+        void visit_offset_comments(offset_t offset, CommentType_e comment_type, const const_string_ref& comment) override { next_.visit_offset_comments(offset, comment_type, comment); }
+        void visit_offset_valueview(offset_t offset, operand_t operand, const const_string_ref& view_value) override { next_.visit_offset_valueview(offset, operand, view_value); }
+        void visit_offset_registerview(offset_t offset, offset_t end_offset, const const_string_ref& register_name, const const_string_ref& register_new_name) override { next_.visit_offset_registerview(offset, end_offset, register_name, register_new_name); }
+        void visit_offset_hiddenarea(offset_t offset, offset_t area_size, const const_string_ref& hidden_area_value) override { next_.visit_offset_hiddenarea(offset, area_size, hidden_area_value); }
+        void visit_start_xrefs() override { next_.visit_start_xrefs(); }
+        void visit_end_xrefs() override { next_.visit_end_xrefs(); }
+        void visit_end_xref() override { next_.visit_end_xref(); }
+        void visit_xref_attribute(const const_string_ref& key, const const_string_ref& value) override { next_.visit_xref_attribute(key, value); }
+        void visit_segments_start() override { next_.visit_segments_start(); }
+        void visit_segments_end() override { next_.visit_segments_end(); }
+        void visit_blob(offset_t offset, const void* blob, size_t len) override { next_.visit_blob(offset, blob, len); }
+        void visit_flags(flags_t flags) override { next_.visit_flags(flags); }
+
+        IModelVisitor&              next_;
+        const relative_ids::Ids&    ids_;
+        const uint64_t              image_base_;
+        YaToolObjectType_e          type_;
+    };
+}
+
+std::shared_ptr<IModelVisitor> relative_ids::make_visitor(IModelVisitor& next, const Ids& ids, uint64_t image_base)
+{
+    return std::make_shared<RelativeVisitor>(next, ids, image_base);
+}
@@ -0,0 +1,44 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "YaTypes.hpp"
+
+#include <memory>
+#include <unordered_map>
+
+struct IModel;
+struct IModelVisitor;
+struct HVersion;
+
+namespace relative_ids
+{
+    // binary attribute set on models using image-relative ids
+    extern const const_string_ref key;
+    extern const const_string_ref value;
+
+    bool is_enabled(const HVersion& binary);
+
+    // absolute id to image-relative id
+    using Ids = std::unordered_map<YaToolObjectId, YaToolObjectId>;
+
+    // compute image-relative ids of every located object of an absolute model
+    // & of every object depending on them
+    Ids get_ids(const IModel& model, uint64_t image_base);
+
+    // forward absolute objects to next visitor with image-relative ids & addresses
+    std::shared_ptr<IModelVisitor> make_visitor(IModelVisitor& next, const Ids& ids, uint64_t image_base);
+}
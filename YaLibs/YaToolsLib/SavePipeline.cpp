@@ -0,0 +1,174 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "SavePipeline.hpp"
+
+#include "IModel.hpp"
+#include "Helpers.h"
+#include "Yatools.hpp"
+#include "XmlVisitor.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#define LOG(LEVEL, FMT, ...) CONCAT(YALOG_, LEVEL)("save", (FMT), ## __VA_ARGS__)
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Snapshot = std::shared_ptr<IModel>;
+
+    struct SavePipeline
+        : public ISavePipeline
+    {
+        SavePipeline(const SaveSnapshotFn& save, size_t max_pending);
+        ~SavePipeline();
+
+        // ISavePipeline
+        void post   (const Snapshot& snapshot) override;
+        bool flush  () override;
+        bool idle   () override;
+
+        void run    ();
+        bool save   (IModel& snapshot);
+
+        const SaveSnapshotFn    save_;
+        const size_t            max_pending_;
+        std::mutex              mutex_;
+        std::condition_variable posted_;
+        std::condition_variable done_;
+        std::deque<Snapshot>    queue_;
+        bool                    stop_;
+        bool                    ok_;
+        std::thread             thread_;
+    };
+}
+
+std::shared_ptr<ISavePipeline> MakeSavePipeline(const SaveSnapshotFn& save, size_t max_pending)
+{
+    return std::make_shared<SavePipeline>(save, max_pending);
+}
+
+SavePipeline::SavePipeline(const SaveSnapshotFn& save, size_t max_pending)
+    : save_         (save)
+    , max_pending_  (max_pending)
+    , stop_         (false)
+    , ok_           (true)
+{
+    if(max_pending_)
+        thread_ = std::thread(&SavePipeline::run, this);
+}
+
+SavePipeline::~SavePipeline()
+{
+    if(!thread_.joinable())
+        return;
+
+    // pending snapshots are still saved before stopping
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    posted_.notify_one();
+    thread_.join();
+}
+
+bool SavePipeline::save(IModel& snapshot)
+{
+    const auto start = Clock::now();
+    const auto ok = save_(snapshot);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+    if(!ok)
+        LOG(ERROR, "unable to save %zd objects\n", snapshot.size());
+    else if(elapsed)
+        LOG(DEBUG, "saved %zd objects in %d ms\n", snapshot.size(), static_cast<int>(elapsed));
+    return ok;
+}
+
+void SavePipeline::post(const Snapshot& snapshot)
+{
+    if(!max_pending_)
+    {
+        const auto ok = save(*snapshot);
+        std::lock_guard<std::mutex> lock(mutex_);
+        ok_ &= ok;
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if(queue_.size() >= max_pending_)
+        LOG(INFO, "waiting for %zd pending saves\n", queue_.size());
+    done_.wait(lock, [&]
+    {
+        return queue_.size() < max_pending_;
+    });
+    queue_.push_back(snapshot);
+    lock.unlock();
+    posted_.notify_one();
+}
+
+bool SavePipeline::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&]
+    {
+        return queue_.empty();
+    });
+    const auto ok = ok_;
+    ok_ = true;
+    return ok;
+}
+
+bool SavePipeline::idle()
+{
+    // snapshots stay queued while saved
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.empty();
+}
+
+void SavePipeline::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        posted_.wait(lock, [&]
+        {
+            return stop_ || !queue_.empty();
+        });
+        if(queue_.empty())
+            return;
+
+        // keep the snapshot queued while saving so post blocks on it too
+        const auto snapshot = queue_.front();
+        lock.unlock();
+        const auto ok = save(*snapshot);
+        lock.lock();
+        ok_ &= ok;
+        queue_.pop_front();
+        done_.notify_all();
+    }
+}
+
+SaveSnapshotFn MakeXmlCacheSave(const std::string& path, const std::shared_ptr<IFileWriter>& files, const std::function<bool()>& commit)
+{
+    return [=](IModel& snapshot)
+    {
+        snapshot.accept(*MakeXmlVisitor(path, files));
+        return commit();
+    };
+}
@@ -0,0 +1,49 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+struct IModel;
+struct IFileWriter;
+
+// serializes & commits immutable snapshots on a background thread
+// snapshots are saved one at a time, in posting order,
+// and must not be modified once posted
+struct ISavePipeline
+{
+    virtual ~ISavePipeline() = default;
+
+    // queue a snapshot, blocks while max_pending snapshots are already queued
+    // post must be called from a single thread
+    virtual void post   (const std::shared_ptr<IModel>& snapshot) = 0;
+
+    // wait for every queued snapshot, false if any failed since last flush
+    virtual bool flush  () = 0;
+
+    // true when every queued snapshot is saved, never blocks
+    virtual bool idle   () = 0;
+};
+
+using SaveSnapshotFn = std::function<bool(IModel& snapshot)>;
+
+// max_pending = 0 saves synchronously inside post
+std::shared_ptr<ISavePipeline> MakeSavePipeline(const SaveSnapshotFn& save, size_t max_pending);
+
+// writes snapshots into the xml cache at path, then commits them
+SaveSnapshotFn MakeXmlCacheSave(const std::string& path, const std::shared_ptr<IFileWriter>& files, const std::function<bool()>& commit);
@@ -0,0 +1,443 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "VersionRecord.hpp"
+
+#include "IModelVisitor.hpp"
+
+#include <deque>
+#include <string>
+
+namespace
+{
+    template<typename T>
+    RecordSpan<T> make_span(const std::vector<T>& values)
+    {
+        return RecordSpan<T>{values.data(), values.size()};
+    }
+
+    bool has_string(const const_string_ref& ref)
+    {
+        return !!ref.value;
+    }
+}
+
+void VersionRecordBuffer::clear()
+{
+    memset(&record, 0, sizeof record);
+    record.type = OBJECT_TYPE_UNKNOWN;
+    record.string_type = UINT8_MAX;
+    signatures.clear();
+    comments.clear();
+    valueviews.clear();
+    registerviews.clear();
+    hiddenareas.clear();
+    xrefs.clear();
+    xref_attributes.clear();
+    xref_attributes_idx.clear();
+    attributes.clear();
+    blobs.clear();
+}
+
+const VersionRecord& VersionRecordBuffer::finish()
+{
+    // xref attributes may have moved while appending
+    for(size_t i = 0; i < xrefs.size(); ++i)
+        xrefs[i].attributes.data = xref_attributes.data() + xref_attributes_idx[i];
+    record.signatures       = make_span(signatures);
+    record.comments         = make_span(comments);
+    record.valueviews       = make_span(valueviews);
+    record.registerviews    = make_span(registerviews);
+    record.hiddenareas      = make_span(hiddenareas);
+    record.xrefs            = make_span(xrefs);
+    record.attributes       = make_span(attributes);
+    record.blobs            = make_span(blobs);
+    return record;
+}
+
+void VersionRecordStore::clear()
+{
+    buffer.clear();
+    strings.clear();
+    blobs.clear();
+}
+
+const_string_ref VersionRecordStore::store(const const_string_ref& value)
+{
+    if(!value.value)
+        return value;
+    strings.emplace_back(value.value, value.size);
+    return make_string_ref(strings.back());
+}
+
+const void* VersionRecordStore::store(const void* data, size_t size)
+{
+    const auto ptr = static_cast<const uint8_t*>(data);
+    blobs.emplace_back(ptr, ptr + size);
+    return blobs.back().data();
+}
+
+const VersionRecord& VersionRecordStore::copy(const VersionRecord& record)
+{
+    clear();
+    auto& r = buffer.record;
+    r = record;
+    r.username                      = store(record.username);
+    r.prototype                     = store(record.prototype);
+    r.header_comment_repeatable     = store(record.header_comment_repeatable);
+    r.header_comment_nonrepeatable  = store(record.header_comment_nonrepeatable);
+    for(const auto& sig : record.signatures)
+        buffer.signatures.push_back({store(sig.value), sig.method, sig.algo});
+    for(const auto& comment : record.comments)
+        buffer.comments.push_back({comment.offset, comment.type, store(comment.value)});
+    for(const auto& view : record.valueviews)
+        buffer.valueviews.push_back({view.offset, view.operand, store(view.value)});
+    for(const auto& view : record.registerviews)
+        buffer.registerviews.push_back({view.offset, view.end_offset, store(view.name), store(view.new_name)});
+    for(const auto& hidden : record.hiddenareas)
+        buffer.hiddenareas.push_back({hidden.offset, hidden.area_size, store(hidden.value)});
+    for(const auto& xref : record.xrefs)
+    {
+        buffer.xrefs.push_back({xref.offset, xref.id, xref.operand, {nullptr, xref.attributes.size}});
+        buffer.xref_attributes_idx.push_back(buffer.xref_attributes.size());
+        for(const auto& attr : xref.attributes)
+            buffer.xref_attributes.push_back({store(attr.key), store(attr.value)});
+    }
+    for(const auto& attr : record.attributes)
+        buffer.attributes.push_back({store(attr.key), store(attr.value)});
+    for(const auto& blob : record.blobs)
+        buffer.blobs.push_back({blob.offset, store(blob.data, blob.size), blob.size});
+    return buffer.finish();
+}
+
+void accept_record(const VersionRecord& record, IModelVisitor& visitor)
+{
+    visitor.visit_start_version(record.type, record.id);
+    visitor.visit_size(record.size);
+    visitor.visit_parent_id(record.parent_id);
+    visitor.visit_address(record.address);
+
+    if(has_string(record.username))
+        visitor.visit_name(record.username, record.username_flags);
+
+    if(has_string(record.prototype))
+        visitor.visit_prototype(record.prototype);
+
+    visitor.visit_flags(record.flags);
+
+    if(record.string_type != UINT8_MAX)
+        visitor.visit_string_type(record.string_type);
+
+    // signatures
+    visitor.visit_start_signatures();
+    for(const auto& sig : record.signatures)
+        visitor.visit_signature(sig.method, sig.algo, sig.value);
+    visitor.visit_end_signatures();
+
+    if(has_string(record.header_comment_repeatable))
+        visitor.visit_header_comment(true, record.header_comment_repeatable);
+
+    if(has_string(record.header_comment_nonrepeatable))
+        visitor.visit_header_comment(false, record.header_comment_nonrepeatable);
+
+    // offsets
+    if(!record.comments.empty() || !record.valueviews.empty() || !record.registerviews.empty() || !record.hiddenareas.empty())
+    {
+        visitor.visit_start_offsets();
+        for(const auto& comment : record.comments)
+            visitor.visit_offset_comments(comment.offset, comment.type, comment.value);
+        for(const auto& view : record.valueviews)
+            visitor.visit_offset_valueview(view.offset, view.operand, view.value);
+        for(const auto& view : record.registerviews)
+            visitor.visit_offset_registerview(view.offset, view.end_offset, view.name, view.new_name);
+        for(const auto& hidden : record.hiddenareas)
+            visitor.visit_offset_hiddenarea(hidden.offset, hidden.area_size, hidden.value);
+        visitor.visit_end_offsets();
+    }
+
+    // xrefs
+    visitor.visit_start_xrefs();
+    for(const auto& xref : record.xrefs)
+    {
+        visitor.visit_start_xref(xref.offset, xref.id, xref.operand);
+        for(const auto& attr : xref.attributes)
+            visitor.visit_xref_attribute(attr.key, attr.value);
+        visitor.visit_end_xref();
+    }
+    visitor.visit_end_xrefs();
+
+    // attributes
+    for(const auto& attr : record.attributes)
+        visitor.visit_attribute(attr.key, attr.value);
+
+    // blobs
+    for(const auto& blob : record.blobs)
+        visitor.visit_blob(blob.offset, blob.data, blob.size);
+
+    visitor.visit_end_version();
+}
+
+namespace
+{
+    struct RecordVisitor
+        : public IModelVisitor
+    {
+        RecordVisitor(IModelVisitor& next);
+
+        const_string_ref store(const const_string_ref& value);
+
+        // IModelVisitor
+        void visit_start() override;
+        void visit_end() override;
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override;
+        void visit_start_version(YaToolObjectType_e type, YaToolObjectId id) override;
+        void visit_end_version() override;
+        void visit_version(const VersionRecord& record) override;
+        void visit_parent_id(YaToolObjectId parent_id) override;
+        void visit_address(offset_t address) override;
+        void visit_name(const const_string_ref& name, int flags) override;
+        void visit_size(offset_t size) override;
+        void visit_start_signatures() override;
+        void visit_signature(SignatureMethod_e method, SignatureAlgo_e algo, const const_string_ref& hex) override;
+        void visit_end_signatures() override;
+        void visit_prototype(const const_string_ref& prototype) override;
+        void visit_string_type(int str_type) override;
+        void visit_header_comment(bool repeatable, const const_string_ref& comment) override;
+        void visit_start_offsets() override;
+        void visit_end_offsets() override;
+        void visit_offset_comments(offset_t offset, CommentType_e comment_type, const const_string_ref& comment) override;
+        void visit_offset_valueview(offset_t offset, operand_t operand, const const_string_ref& view_value) override;
+        void visit_offset_registerview(offset_t offset, offset_t end_offset, const const_string_ref& register_name, const const_string_ref& register_new_name) override;
+        void visit_offset_hiddenarea(offset_t offset, offset_t area_size, const const_string_ref& hidden_area_value) override;
+        void visit_start_xrefs() override;
+        void visit_end_xrefs() override;
+        void visit_start_xref(offset_t offset, YaToolObjectId offset_value, operand_t operand) override;
+        void visit_end_xref() override;
+        void visit_xref_attribute(const const_string_ref& key_attribute, const const_string_ref& value_attribute) override;
+        void visit_segments_start() override;
+        void visit_segments_end() override;
+        void visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value) override;
+        void visit_blob(offset_t offset, const void* blob, size_t len) override;
+        void visit_flags(flags_t flags) override;
+
+        IModelVisitor&                      next_;
+        VersionRecordBuffer                 buffer_;
+        // deque elements never move, so record references stay valid
+        std::deque<std::string>             strings_;
+        std::deque<std::vector<uint8_t>>    blobs_;
+    };
+}
+
+std::shared_ptr<IModelVisitor> MakeVersionRecordVisitor(IModelVisitor& next)
+{
+    return std::make_shared<RecordVisitor>(next);
+}
+
+namespace
+{
+    struct OwningRecordVisitor
+        : public RecordVisitor
+    {
+        OwningRecordVisitor(const std::shared_ptr<IModelVisitor>& next)
+            : RecordVisitor(*next)
+            , owned_(next)
+        {
+        }
+
+        const std::shared_ptr<IModelVisitor> owned_;
+    };
+}
+
+std::shared_ptr<IModelVisitor> MakeVersionRecordVisitor(const std::shared_ptr<IModelVisitor>& next)
+{
+    return std::make_shared<OwningRecordVisitor>(next);
+}
+
+RecordVisitor::RecordVisitor(IModelVisitor& next)
+    : next_(next)
+{
+    buffer_.clear();
+}
+
+const_string_ref RecordVisitor::store(const const_string_ref& value)
+{
+    if(!value.value)
+        return value;
+    strings_.emplace_back(value.value, value.size);
+    return make_string_ref(strings_.back());
+}
+
+void RecordVisitor::visit_start()
+{
+    next_.visit_start();
+}
+
+void RecordVisitor::visit_end()
+{
+    next_.visit_end();
+}
+
+void RecordVisitor::visit_deleted(YaToolObjectType_e type, YaToolObjectId id)
+{
+    next_.visit_deleted(type, id);
+}
+
+void RecordVisitor::visit_start_version(YaToolObjectType_e type, YaToolObjectId id)
+{
+    buffer_.clear();
+    strings_.clear();
+    blobs_.clear();
+    buffer_.record.type = type;
+    buffer_.record.id = id;
+}
+
+void RecordVisitor::visit_end_version()
+{
+    next_.visit_version(buffer_.finish());
+}
+
+void RecordVisitor::visit_version(const VersionRecord& record)
+{
+    next_.visit_version(record);
+}
+
+void RecordVisitor::visit_parent_id(YaToolObjectId parent_id)
+{
+    buffer_.record.parent_id = parent_id;
+}
+
+void RecordVisitor::visit_address(offset_t address)
+{
+    buffer_.record.address = address;
+}
+
+void RecordVisitor::visit_name(const const_string_ref& name, int flags)
+{
+    buffer_.record.username = store(name);
+    buffer_.record.username_flags = flags;
+}
+
+void RecordVisitor::visit_size(offset_t size)
+{
+    buffer_.record.size = size;
+}
+
+void RecordVisitor::visit_start_signatures()
+{
+}
+
+void RecordVisitor::visit_signature(SignatureMethod_e method, SignatureAlgo_e algo, const const_string_ref& hex)
+{
+    buffer_.signatures.push_back({store(hex), method, algo});
+}
+
+void RecordVisitor::visit_end_signatures()
+{
+}
+
+void RecordVisitor::visit_prototype(const const_string_ref& prototype)
+{
+    buffer_.record.prototype = store(prototype);
+}
+
+void RecordVisitor::visit_string_type(int str_type)
+{
+    buffer_.record.string_type = str_type;
+}
+
+void RecordVisitor::visit_header_comment(bool repeatable, const const_string_ref& comment)
+{
+    auto& dst = repeatable ? buffer_.record.header_comment_repeatable : buffer_.record.header_comment_nonrepeatable;
+    dst = store(comment);
+}
+
+void RecordVisitor::visit_start_offsets()
+{
+}
+
+void RecordVisitor::visit_end_offsets()
+{
+}
+
+void RecordVisitor::visit_offset_comments(offset_t offset, CommentType_e comment_type, const const_string_ref& comment)
+{
+    buffer_.comments.push_back({offset, comment_type, store(comment)});
+}
+
+void RecordVisitor::visit_offset_valueview(offset_t offset, operand_t operand, const const_string_ref& view_value)
+{
+    buffer_.valueviews.push_back({offset, operand, store(view_value)});
+}
+
+void RecordVisitor::visit_offset_registerview(offset_t offset, offset_t end_offset, const const_string_ref& register_name, const const_string_ref& register_new_name)
+{
+    buffer_.registerviews.push_back({offset, end_offset, store(register_name), store(register_new_name)});
+}
+
+void RecordVisitor::visit_offset_hiddenarea(offset_t offset, offset_t area_size, const const_string_ref& hidden_area_value)
+{
+    buffer_.hiddenareas.push_back({offset, area_size, store(hidden_area_value)});
+}
+
+void RecordVisitor::visit_start_xrefs()
+{
+}
+
+void RecordVisitor::visit_end_xrefs()
+{
+}
+
+void RecordVisitor::visit_start_xref(offset_t offset, YaToolObjectId offset_value, operand_t operand)
+{
+    buffer_.xrefs.push_back({offset, offset_value, operand, {nullptr, 0}});
+    buffer_.xref_attributes_idx.push_back(buffer_.xref_attributes.size());
+}
+
+void RecordVisitor::visit_end_xref()
+{
+}
+
+void RecordVisitor::visit_xref_attribute(const const_string_ref& key_attribute, const const_string_ref& value_attribute)
+{
+    buffer_.xref_attributes.push_back({store(key_attribute), store(value_attribute)});
+    buffer_.xrefs.back().attributes.size++;
+}
+
+void RecordVisitor::visit_segments_start()
+{
+    next_.visit_segments_start();
+}
+
+void RecordVisitor::visit_segments_end()
+{
+    next_.visit_segments_end();
+}
+
+void RecordVisitor::visit_attribute(const const_string_ref& attr_name, const const_string_ref& attr_value)
+{
+    buffer_.attributes.push_back({store(attr_name), store(attr_value)});
+}
+
+void RecordVisitor::visit_blob(offset_t offset, const void* blob, size_t len)
+{
+    const auto ptr = static_cast<const uint8_t*>(blob);
+    blobs_.emplace_back(ptr, ptr + len);
+    buffer_.blobs.push_back({offset, blobs_.back().data(), len});
+}
+
+void RecordVisitor::visit_flags(flags_t flags)
+{
+    buffer_.record.flags = flags;
+}
@@ -0,0 +1,168 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "YaTypes.hpp"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+// read-only view on contiguous values
+template<typename T>
+struct RecordSpan
+{
+    const T*    begin   () const { return data; }
+    const T*    end     () const { return data + size; }
+    bool        empty   () const { return !size; }
+
+    const T*    data;
+    size_t      size;
+};
+
+struct RecordSignature
+{
+    const_string_ref    value;
+    SignatureMethod_e   method;
+    SignatureAlgo_e     algo;
+};
+
+struct RecordAttribute
+{
+    const_string_ref    key;
+    const_string_ref    value;
+};
+
+struct RecordXref
+{
+    offset_t                    offset;
+    YaToolObjectId              id;
+    operand_t                   operand;
+    RecordSpan<RecordAttribute> attributes;
+};
+
+struct RecordComment
+{
+    offset_t            offset;
+    CommentType_e       type;
+    const_string_ref    value;
+};
+
+struct RecordValueView
+{
+    offset_t            offset;
+    operand_t           operand;
+    const_string_ref    value;
+};
+
+struct RecordRegisterView
+{
+    offset_t            offset;
+    offset_t            end_offset;
+    const_string_ref    name;
+    const_string_ref    new_name;
+};
+
+struct RecordHiddenArea
+{
+    offset_t            offset;
+    offset_t            area_size;
+    const_string_ref    value;
+};
+
+struct RecordBlob
+{
+    offset_t    offset;
+    const void* data;
+    size_t      size;
+};
+
+// one whole version, only valid during a visit_version call
+// absent strings have a null value
+struct VersionRecord
+{
+    YaToolObjectType_e  type;
+    YaToolObjectId      id;
+    YaToolObjectId      parent_id;
+    offset_t            address;
+    offset_t            size;
+    flags_t             flags;
+    int                 string_type;    // UINT8_MAX if absent
+    const_string_ref    username;
+    int                 username_flags;
+    const_string_ref    prototype;
+    const_string_ref    header_comment_repeatable;
+    const_string_ref    header_comment_nonrepeatable;
+
+    RecordSpan<RecordSignature>     signatures;
+    RecordSpan<RecordComment>       comments;
+    RecordSpan<RecordValueView>     valueviews;
+    RecordSpan<RecordRegisterView>  registerviews;
+    RecordSpan<RecordHiddenArea>    hiddenareas;
+    RecordSpan<RecordXref>          xrefs;
+    RecordSpan<RecordAttribute>     attributes;
+    RecordSpan<RecordBlob>          blobs;
+};
+
+// backing storage for records built one version at a time
+// capacities are kept from one version to the next
+struct VersionRecordBuffer
+{
+    void clear();
+
+    // points every record span to buffer values
+    const VersionRecord& finish();
+
+    VersionRecord                   record;
+    std::vector<RecordSignature>    signatures;
+    std::vector<RecordComment>      comments;
+    std::vector<RecordValueView>    valueviews;
+    std::vector<RecordRegisterView> registerviews;
+    std::vector<RecordHiddenArea>   hiddenareas;
+    std::vector<RecordXref>         xrefs;
+    std::vector<RecordAttribute>    xref_attributes;    // xref attributes, sliced by xref spans
+    std::vector<size_t>             xref_attributes_idx;
+    std::vector<RecordAttribute>    attributes;
+    std::vector<RecordBlob>         blobs;
+};
+
+// owns copies of every string & blob referenced by a record
+struct VersionRecordStore
+{
+    void clear();
+
+    const_string_ref    store(const const_string_ref& value);
+    const void*         store(const void* data, size_t size);
+
+    // deep copy, valid until next clear or copy
+    const VersionRecord& copy(const VersionRecord& record);
+
+    VersionRecordBuffer                 buffer;
+    // deque elements never move, so record references stay valid
+    std::deque<std::string>             strings;
+    std::deque<std::vector<uint8_t>>    blobs;
+};
+
+// emits one record as fine-grained visitor calls
+void accept_record(const VersionRecord& record, IModelVisitor& visitor);
+
+// gathers fine-grained calls into records forwarded to next.visit_version
+// strings are copied until the record is forwarded
+std::shared_ptr<IModelVisitor> MakeVersionRecordVisitor(IModelVisitor& next);
+
+// same, keeping next alive with the returned visitor
+std::shared_ptr<IModelVisitor> MakeVersionRecordVisitor(const std::shared_ptr<IModelVisitor>& next);
@@ -0,0 +1,394 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "VisitorCombinators.hpp"
+
+#include "IModelVisitor.hpp"
+#include "VersionRecord.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    // receives whole versions only, fine-grained calls are gathered
+    // into records by MakeVersionRecordVisitor before reaching sinks
+    struct RecordSink
+        : public IModelVisitor
+    {
+        void visit_start_version(YaToolObjectType_e, YaToolObjectId) override {}
+        void visit_end_version() override {}
+        void visit_parent_id(YaToolObjectId) override {}
+        void visit_address(offset_t) override {}
+        void visit_name(const const_string_ref&, int) override {}
+        void visit_size(offset_t) override {}
+        void visit_start_signatures() override {}
+        void visit_signature(SignatureMethod_e, SignatureAlgo_e, const const_string_ref&) override {}
+        void visit_end_signatures() override {}
+        void visit_prototype(const const_string_ref&) override {}
+        void visit_string_type(int) override {}
+        void visit_header_comment(bool, const const_string_ref&) override {}
+        void visit_start_offsets() override {}
+        void visit_end_offsets() override {}
+        void visit_offset_comments(offset_t, CommentType_e, const const_string_ref&) override {}
+        void visit_offset_valueview(offset_t, operand_t, const const_string_ref&) override {}
+        void visit_offset_registerview(offset_t, offset_t, const const_string_ref&, const const_string_ref&) override {}
+        void visit_offset_hiddenarea(offset_t, offset_t, const const_string_ref&) override {}
+        void visit_start_xrefs() override {}
+        void visit_end_xrefs() override {}
+        void visit_start_xref(offset_t, YaToolObjectId, operand_t) override {}
+        void visit_end_xref() override {}
+        void visit_xref_attribute(const const_string_ref&, const const_string_ref&) override {}
+        void visit_attribute(const const_string_ref&, const const_string_ref&) override {}
+        void visit_blob(offset_t, const void*, size_t) override {}
+        void visit_flags(flags_t) override {}
+    };
+
+    VersionRecord make_deleted_record(YaToolObjectType_e type, YaToolObjectId id)
+    {
+        VersionRecord record;
+        memset(&record, 0, sizeof record);
+        record.type = type;
+        record.id = id;
+        record.string_type = UINT8_MAX;
+        return record;
+    }
+
+    struct Tee
+        : public RecordSink
+    {
+        Tee(const std::vector<IModelVisitor*>& sinks)
+            : sinks_(sinks)
+        {
+        }
+
+        void visit_start() override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_start();
+        }
+
+        void visit_end() override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_end();
+        }
+
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_deleted(type, id);
+        }
+
+        void visit_version(const VersionRecord& record) override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_version(record);
+        }
+
+        void visit_segments_start() override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_segments_start();
+        }
+
+        void visit_segments_end() override
+        {
+            for(const auto sink : sinks_)
+                sink->visit_segments_end();
+        }
+
+        const std::vector<IModelVisitor*> sinks_;
+    };
+
+    enum EventType_e
+    {
+        EVENT_START,
+        EVENT_END,
+        EVENT_DELETED,
+        EVENT_VERSION,
+        EVENT_SEGMENTS_START,
+        EVENT_SEGMENTS_END,
+    };
+
+    struct Event
+    {
+        EventType_e                                 event;
+        YaToolObjectType_e                          type;
+        YaToolObjectId                              id;
+        std::shared_ptr<const VersionRecordStore>   version;
+    };
+
+    struct Worker
+    {
+        IModelVisitor*      sink;
+        std::deque<Event>   queue;      // front event stays queued while visited
+        std::thread         thread;
+    };
+
+    struct AsyncTee
+        : public RecordSink
+    {
+        AsyncTee(const std::vector<IModelVisitor*>& sinks, size_t max_pending);
+        ~AsyncTee();
+
+        void post(const Event& event);
+        void wait_idle();
+        void run(Worker& worker);
+
+        // IModelVisitor
+        void visit_start() override;
+        void visit_end() override;
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override;
+        void visit_version(const VersionRecord& record) override;
+        void visit_segments_start() override;
+        void visit_segments_end() override;
+
+        const size_t            max_pending_;
+        std::mutex              mutex_;
+        std::condition_variable posted_;
+        std::condition_variable done_;
+        std::deque<Worker>      workers_;
+        bool                    stop_;
+    };
+}
+
+AsyncTee::AsyncTee(const std::vector<IModelVisitor*>& sinks, size_t max_pending)
+    : max_pending_  (max_pending)
+    , stop_         (false)
+{
+    for(const auto sink : sinks)
+        workers_.push_back({sink, {}, {}});
+    for(auto& worker : workers_)
+        worker.thread = std::thread(&AsyncTee::run, this, std::ref(worker));
+}
+
+AsyncTee::~AsyncTee()
+{
+    // queued events are still visited before stopping
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    posted_.notify_all();
+    for(auto& worker : workers_)
+        worker.thread.join();
+}
+
+void AsyncTee::post(const Event& event)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&]
+        {
+            for(const auto& worker : workers_)
+                if(worker.queue.size() >= max_pending_)
+                    return false;
+            return true;
+        });
+        for(auto& worker : workers_)
+            worker.queue.push_back(event);
+    }
+    posted_.notify_all();
+}
+
+void AsyncTee::wait_idle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&]
+    {
+        for(const auto& worker : workers_)
+            if(!worker.queue.empty())
+                return false;
+        return true;
+    });
+}
+
+void AsyncTee::run(Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        posted_.wait(lock, [&]
+        {
+            return stop_ || !worker.queue.empty();
+        });
+        if(worker.queue.empty())
+            return;
+
+        const auto event = worker.queue.front();
+        lock.unlock();
+        auto& sink = *worker.sink;
+        switch(event.event)
+        {
+            case EVENT_START:           sink.visit_start(); break;
+            case EVENT_END:             sink.visit_end(); break;
+            case EVENT_DELETED:         sink.visit_deleted(event.type, event.id); break;
+            case EVENT_VERSION:         sink.visit_version(event.version->buffer.record); break;
+            case EVENT_SEGMENTS_START:  sink.visit_segments_start(); break;
+            case EVENT_SEGMENTS_END:    sink.visit_segments_end(); break;
+        }
+        lock.lock();
+        worker.queue.pop_front();
+        done_.notify_all();
+    }
+}
+
+void AsyncTee::visit_start()
+{
+    post({EVENT_START, OBJECT_TYPE_UNKNOWN, 0, nullptr});
+}
+
+void AsyncTee::visit_end()
+{
+    post({EVENT_END, OBJECT_TYPE_UNKNOWN, 0, nullptr});
+    wait_idle();
+}
+
+void AsyncTee::visit_deleted(YaToolObjectType_e type, YaToolObjectId id)
+{
+    post({EVENT_DELETED, type, id, nullptr});
+}
+
+void AsyncTee::visit_version(const VersionRecord& record)
+{
+    // one copy shared by every sink
+    const auto version = std::make_shared<VersionRecordStore>();
+    version->copy(record);
+    post({EVENT_VERSION, record.type, record.id, version});
+}
+
+void AsyncTee::visit_segments_start()
+{
+    post({EVENT_SEGMENTS_START, OBJECT_TYPE_UNKNOWN, 0, nullptr});
+}
+
+void AsyncTee::visit_segments_end()
+{
+    post({EVENT_SEGMENTS_END, OBJECT_TYPE_UNKNOWN, 0, nullptr});
+}
+
+std::shared_ptr<IModelVisitor> MakeTeeVisitor(const std::vector<IModelVisitor*>& sinks, size_t max_pending)
+{
+    if(!max_pending)
+        return MakeVersionRecordVisitor(std::make_shared<Tee>(sinks));
+    return MakeVersionRecordVisitor(std::make_shared<AsyncTee>(sinks, max_pending));
+}
+
+namespace
+{
+    struct Filter
+        : public RecordSink
+    {
+        Filter(IModelVisitor& next, const VersionFilterFn& filter)
+            : next_(next)
+            , filter_(filter)
+        {
+        }
+
+        void visit_start() override { next_.visit_start(); }
+        void visit_end() override { next_.visit_end(); }
+        void visit_segments_start() override { next_.visit_segments_start(); }
+        void visit_segments_end() override { next_.visit_segments_end(); }
+
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override
+        {
+            if(filter_(make_deleted_record(type, id)))
+                next_.visit_deleted(type, id);
+        }
+
+        void visit_version(const VersionRecord& record) override
+        {
+            if(filter_(record))
+                next_.visit_version(record);
+        }
+
+        IModelVisitor&          next_;
+        const VersionFilterFn   filter_;
+    };
+}
+
+std::shared_ptr<IModelVisitor> MakeFilterVisitor(IModelVisitor& next, const VersionFilterFn& filter)
+{
+    return MakeVersionRecordVisitor(std::make_shared<Filter>(next, filter));
+}
+
+VersionFilterFn filter_types(const std::vector<YaToolObjectType_e>& types)
+{
+    bool accepted[OBJECT_TYPE_COUNT] = {};
+    for(const auto type : types)
+        if(type < OBJECT_TYPE_COUNT)
+            accepted[type] = true;
+    return [=](const VersionRecord& record)
+    {
+        return record.type < OBJECT_TYPE_COUNT && accepted[record.type];
+    };
+}
+
+VersionFilterFn filter_ids(const std::unordered_set<YaToolObjectId>& ids)
+{
+    return [=](const VersionRecord& record)
+    {
+        return !!ids.count(record.id);
+    };
+}
+
+namespace
+{
+    struct Remap
+        : public RecordSink
+    {
+        Remap(IModelVisitor& next, const RemapIdFn& remap)
+            : next_(next)
+            , remap_(remap)
+        {
+        }
+
+        void visit_start() override { next_.visit_start(); }
+        void visit_end() override { next_.visit_end(); }
+        void visit_segments_start() override { next_.visit_segments_start(); }
+        void visit_segments_end() override { next_.visit_segments_end(); }
+
+        void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override
+        {
+            next_.visit_deleted(type, remap_(id));
+        }
+
+        void visit_version(const VersionRecord& record) override
+        {
+            auto remapped = record;
+            remapped.id = remap_(record.id);
+            // zero means no parent
+            if(record.parent_id)
+                remapped.parent_id = remap_(record.parent_id);
+            xrefs_.assign(record.xrefs.begin(), record.xrefs.end());
+            for(auto& xref : xrefs_)
+                xref.id = remap_(xref.id);
+            remapped.xrefs = {xrefs_.data(), xrefs_.size()};
+            next_.visit_version(remapped);
+        }
+
+        IModelVisitor&          next_;
+        const RemapIdFn         remap_;
+        std::vector<RecordXref> xrefs_;
+    };
+}
+
+std::shared_ptr<IModelVisitor> MakeRemapVisitor(IModelVisitor& next, const RemapIdFn& remap)
+{
+    return MakeVersionRecordVisitor(std::make_shared<Remap>(next, remap));
+}
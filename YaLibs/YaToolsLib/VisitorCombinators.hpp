@@ -0,0 +1,46 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "YaTypes.hpp"
+
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+struct IModelVisitor;
+struct VersionRecord;
+
+// forwards every call to all sinks, in sink order
+// max_pending = 0 visits sinks synchronously, else each sink
+// runs on its own thread with at most max_pending queued versions
+// visit_end returns once every sink has visited its end
+std::shared_ptr<IModelVisitor> MakeTeeVisitor(const std::vector<IModelVisitor*>& sinks, size_t max_pending);
+
+// deleted versions are filtered on records with type & id only
+using VersionFilterFn = std::function<bool(const VersionRecord& record)>;
+
+// forwards versions accepted by filter
+std::shared_ptr<IModelVisitor> MakeFilterVisitor(IModelVisitor& next, const VersionFilterFn& filter);
+
+VersionFilterFn filter_types(const std::vector<YaToolObjectType_e>& types);
+VersionFilterFn filter_ids(const std::unordered_set<YaToolObjectId>& ids);
+
+using RemapIdFn = std::function<YaToolObjectId(YaToolObjectId id)>;
+
+// rewrites version, parent & xref ids
+std::shared_ptr<IModelVisitor> MakeRemapVisitor(IModelVisitor& next, const RemapIdFn& remap);
@@ -45,6 +45,13 @@ namespace
 {
     struct XmlCleanup
     {
+        // parser must be initialized before readers
+        // are created concurrently on worker threads
+        XmlCleanup()
+        {
+            xmlInitParser();
+        }
+
         ~XmlCleanup()
         {
             xmlCleanupParser();
@@ -19,6 +19,7 @@
 #include "Signature.hpp"
 #include "IModelVisitor.hpp"
 #include "BinHex.hpp"
+#include "FileWriter.hpp"
 
 #include <iostream>
 #include <sstream>
@@ -91,7 +92,7 @@ protected:
 class XmlVisitor : public XmlVisitor_common
 {
 public:
-    XmlVisitor(const std::string& path);
+    XmlVisitor(const std::string& path, const std::shared_ptr<IFileWriter>& files);
     void visit_start() override;
     void visit_end() override;
     void visit_deleted(YaToolObjectType_e type, YaToolObjectId id) override;
@@ -99,8 +100,9 @@ public:
     void visit_end_version() override;
 
 private:
-    std::string path_;
-    std::string current_xml_file_path_;
+    std::shared_ptr<IFileWriter>    files_;
+    std::string                     path_;
+    std::string                     current_xml_file_path_;
 };
 
 struct MemExporter
@@ -138,7 +140,12 @@ struct StringXmlVisitor
 
 std::shared_ptr<IModelVisitor> MakeXmlVisitor(const std::string& path)
 {
-    return std::make_shared<XmlVisitor>(path);
+    return MakeXmlVisitor(path, MakeFileWriter(DURABILITY_NONE, 0));
+}
+
+std::shared_ptr<IModelVisitor> MakeXmlVisitor(const std::string& path, const std::shared_ptr<IFileWriter>& files)
+{
+    return std::make_shared<XmlVisitor>(path, files);
 }
 
 std::shared_ptr<IModelVisitor> MakeFileXmlVisitor(const std::string& path)
@@ -156,8 +163,9 @@ FileXmlVisitor::FileXmlVisitor(const std::string& path)
 {
 }
 
-XmlVisitor::XmlVisitor(const std::string& path)
-    : path_     (path)
+XmlVisitor::XmlVisitor(const std::string& path, const std::shared_ptr<IFileWriter>& files)
+    : files_    (files)
+    , path_     (path)
 {
 }
 
@@ -192,6 +200,8 @@ void XmlVisitor::visit_start()
 
 void XmlVisitor::visit_end()
 {
+    if(!files_->flush())
+        YALOG_ERROR(nullptr, "error: unable to write xml files to %s\n", path_.data());
 }
 
 void FileXmlVisitor::visit_end()
@@ -313,8 +323,15 @@ void XmlVisitor::visit_end_version()
     }
     writer_.reset();
 
-    rc = xmlSaveFormatFileEnc((char*)current_xml_file_path_.c_str(), &*doc_, XML_ENCODING, 1);
+    xmlChar* data = nullptr;
+    int size = 0;
+    xmlDocDumpFormatMemoryEnc(&*doc_, &data, &size, XML_ENCODING, 1);
     doc_.reset();
+    if(!data)
+        throw "could not dump xml document";
+
+    files_->write(current_xml_file_path_, std::string(reinterpret_cast<const char*>(data), size));
+    xmlFree(data);
 }
 
 void XmlVisitor::visit_deleted(YaToolObjectType_e type, YaToolObjectId id)
@@ -324,10 +341,7 @@ void XmlVisitor::visit_deleted(YaToolObjectType_e type, YaToolObjectId id)
 
     std::string dummy;
     current_xml_file_path_ = get_path(dummy, type, id, path_);
-    std::error_code ec;
-    const auto ok = filesystem::remove(current_xml_file_path_, ec);
-    if(!ok && ec && ec != std::errc::no_such_file_or_directory)
-        YALOG_ERROR(nullptr, "warning: unable to delete %s\n", current_xml_file_path_.data());
+    files_->remove(current_xml_file_path_);
 }
 
 MemExporter::MemExporter()
@@ -19,7 +19,9 @@
 #include <string>
 
 struct IModelVisitor;
+struct IFileWriter;
 
 std::shared_ptr<IModelVisitor> MakeXmlVisitor      (const std::string& path);
+std::shared_ptr<IModelVisitor> MakeXmlVisitor      (const std::string& path, const std::shared_ptr<IFileWriter>& files);
 std::shared_ptr<IModelVisitor> MakeFileXmlVisitor  (const std::string& path);
 std::shared_ptr<IModelVisitor> MakeMemoryXmlVisitor(std::string& output);
\ No newline at end of file
@@ -34,6 +34,13 @@ struct HSystem;
 
 typedef uint32_t VersionIndex;
 
+// [begin, end) positions in model walk order
+struct VersionRange
+{
+    size_t begin;
+    size_t end;
+};
+
 typedef uint32_t HSignature_id_t;
 typedef uint32_t VersionRelation_id_t;
 
@@ -42,6 +49,17 @@ typedef int32_t  operand_t;
 typedef uint32_t flags_t;
 typedef uint64_t YaToolObjectId;
 
+// structural facts about one function, read from its basic blocks & stackframe
+struct FunctionSummary
+{
+    offset_t    size;
+    offset_t    frame_size;
+    uint32_t    basic_blocks;
+    uint32_t    edges;          // edges between basic blocks of this function
+    uint32_t    callees;        // distinct called functions
+    uint32_t    callers;        // distinct calling functions
+};
+
 YaToolObjectType_e  get_object_type(const char* object_type);
 const char*         get_object_type_string(YaToolObjectType_e object_type);
 
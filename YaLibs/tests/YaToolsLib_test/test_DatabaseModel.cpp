@@ -28,9 +28,15 @@
 #include "FlatBufferModel.hpp"
 #include "FlatBufferVisitor.hpp"
 #include "FileUtils.hpp"
+#include "Parallel.hpp"
+#include "VersionRecord.hpp"
+#include "XmlVisitor.hpp"
+
+#include <yadb_generated.h>
 
 #include "test_model.hpp"
 
+#include <atomic>
 #include <functional>
 #include <map>
 
@@ -137,6 +143,8 @@ public:
     void        walk_matching   (const HSignature&, const OnVersionFn&) const override {};
     void        walk_uniques    (const OnSignatureFn&) const override {};
     void        walk_matching   (const HVersion&, size_t, const OnVersionFn&) const override {};
+    void        walk_range      (const VersionRange&, const OnVersionFn&) const override {};
+    VersionRange type_range     (YaToolObjectType_e) const override { return {0, 0}; };
 };
 }
 
@@ -805,4 +813,381 @@ TEST_F(TestYaToolDatabaseModel, test_model_get_object_with_invalid_id)
         EXPECT_EQ(hobj3.is_valid(), false);
         return WALK_CONTINUE;
     });
-}
\ No newline at end of file
+}
+
+namespace
+{
+// same model as create_model, with objects & sub-elements in another order
+void create_model_shuffled(IModelVisitor& v)
+{
+    v.visit_start();
+    create_object(v, 0xCCCCCCCC, "22222222", {});
+    create_object(v, 0xDDDDDDDD, "22222222", {{{0x20, 2, 0xBBBBBBBB}, {0x20, 1, 0xCCCCCCCC}}});
+    v.visit_start_version(OBJECT_TYPE_CODE, 0xAAAAAAAA);
+    v.visit_size(0x10);
+    v.visit_start_signatures();
+    v.visit_signature(SIGNATURE_FIRSTBYTE,   SIGNATURE_ALGORITHM_CRC32, make_string_ref("BADBAD00"));
+    v.visit_signature(SIGNATURE_OPCODE_HASH, SIGNATURE_ALGORITHM_CRC32, make_string_ref("BADBADBA"));
+    v.visit_end_signatures();
+    v.visit_start_xrefs();
+    v.visit_start_xref(0x30, 0xDDDDDDDD, 0);  v.visit_end_xref();
+    v.visit_start_xref(0x30, 0xBBBBBBBB, 0);  v.visit_end_xref();
+    v.visit_start_xref(0x30, 0xCCCCCCCC, 1);  v.visit_end_xref();
+    v.visit_start_xref(0x20, 0xBBBBBBBB, 1);  v.visit_end_xref();
+    v.visit_start_xref(0x20, 0xBBBBBBBB, 0);  v.visit_end_xref();
+    v.visit_start_xref(0x10, 0xBBBBBBBB, 0);  v.visit_end_xref();
+    v.visit_end_xrefs();
+    v.visit_end_version();
+    create_object(v, 0xBBBBBBBB, "11111111", {{{0x10, 0, 0xDDDDDDDD}}});
+    v.visit_end();
+}
+
+std::string export_canonical(const IModel& model)
+{
+    const auto exporter = ExportCanonicalFlatBuffer(model);
+    const auto buf = exporter->GetBuffer();
+    return std::string(static_cast<const char*>(buf.value), buf.size);
+}
+}
+
+TEST_F(TestYaToolDatabaseModel, canonical_export_is_order_independent)
+{
+    const auto ref = MakeMemoryModel();
+    create_model(*ref);
+    const auto shuffled = MakeMemoryModel();
+    create_model_shuffled(*shuffled);
+
+    const auto want = export_canonical(*ref);
+    EXPECT_FALSE(want.empty());
+    EXPECT_EQ(want, export_canonical(*shuffled));
+
+    // models exported in visit order canonicalize to the same bytes
+    const auto plain_ref = create_fbmodel_with(&create_model);
+    const auto plain_shuffled = create_fbmodel_with(&create_model_shuffled);
+    EXPECT_EQ(want, export_canonical(*plain_ref));
+    EXPECT_EQ(want, export_canonical(*plain_shuffled));
+
+    // canonical exports are a fixed point
+    const auto reloaded = MakeFlatBufferModel(std::make_shared<Buffer>(want.data(), want.size()));
+    EXPECT_EQ(want, export_canonical(*reloaded));
+}
+
+namespace
+{
+    void create_large_model(IModelVisitor& v)
+    {
+        const YaToolObjectType_e types[] = {OBJECT_TYPE_DATA, OBJECT_TYPE_CODE, OBJECT_TYPE_FUNCTION, OBJECT_TYPE_STRUCT};
+        const YaToolObjectId num_versions = 2048;
+        v.visit_start();
+        for(YaToolObjectId id = 1; id <= num_versions; ++id)
+        {
+            v.visit_start_version(types[id % COUNT_OF(types)], id);
+            v.visit_size(id);
+            v.visit_start_signatures();
+            char crc[16];
+            snprintf(crc, sizeof crc, "%08X", static_cast<uint32_t>(id % 97));
+            v.visit_signature(SIGNATURE_OPCODE_HASH, SIGNATURE_ALGORITHM_CRC32, make_string_ref(crc));
+            v.visit_end_signatures();
+            v.visit_start_xrefs();
+            v.visit_start_xref(0, id % num_versions + 1, 0);
+            v.visit_end_xref();
+            v.visit_end_xrefs();
+            v.visit_end_version();
+        }
+        v.visit_end();
+    }
+
+    std::vector<YaToolObjectId> walk_ids(const IModel& db, const optional<YaToolObjectType_e>& type)
+    {
+        std::vector<YaToolObjectId> ids;
+        db.walk([&](const HVersion& hver)
+        {
+            if(!type || hver.type() == *type)
+                ids.push_back(hver.id());
+            return WALK_CONTINUE;
+        });
+        return ids;
+    }
+
+    // every range is walked on its own thread & reads shared model data
+    void walk_parallel_impl(const IModel& db)
+    {
+        const auto num_ranges = parallel::get_version_ranges(db, 64).size();
+        std::vector<std::vector<YaToolObjectId>> ranges(num_ranges);
+        std::atomic<size_t> num_xrefs_to(0);
+        parallel::walk_versions(db, 64, [&](size_t idx, const HVersion& hver)
+        {
+            ranges[idx].push_back(hver.id());
+            EXPECT_EQ(hver.id(), db.get(hver.id()).id());
+            hver.walk_xrefs_from([&](offset_t, operand_t, const HVersion& to)
+            {
+                to.walk_xrefs_to([&](const HVersion&)
+                {
+                    ++num_xrefs_to;
+                    return WALK_CONTINUE;
+                });
+                return WALK_CONTINUE;
+            });
+            hver.walk_signatures([&](const HSignature& sig)
+            {
+                EXPECT_NE(0u, db.size_matching(sig));
+                return WALK_CONTINUE;
+            });
+            return WALK_CONTINUE;
+        });
+        std::vector<YaToolObjectId> got;
+        for(const auto& range : ranges)
+            got.insert(got.end(), range.begin(), range.end());
+        EXPECT_EQ(walk_ids(db, nullopt), got);
+        EXPECT_EQ(db.size(), num_xrefs_to.load());
+
+        // type-filtered ranges are contiguous
+        for(const auto type : {OBJECT_TYPE_CODE, OBJECT_TYPE_STRUCT, OBJECT_TYPE_BINARY})
+        {
+            const auto type_ranges = parallel::get_version_ranges(db, type, 16);
+            std::vector<std::vector<YaToolObjectId>> typed(type_ranges.size());
+            parallel::walk_versions(db, type, 16, [&](size_t idx, const HVersion& hver)
+            {
+                EXPECT_EQ(type, hver.type());
+                typed[idx].push_back(hver.id());
+                return WALK_CONTINUE;
+            });
+            got.clear();
+            for(const auto& range : typed)
+                got.insert(got.end(), range.begin(), range.end());
+            EXPECT_EQ(walk_ids(db, type), got);
+        }
+    }
+}
+
+TEST_F(TestYaToolDatabaseModel, memoryModel_walkParallel) {
+    const auto db = MakeMemoryModel();
+    create_large_model(*db);
+    walk_parallel_impl(*db);
+}
+
+TEST_F(TestYaToolDatabaseModel, FBModel_walkParallel) {
+    walk_parallel_impl(*create_fbmodel_with(&create_large_model));
+}
+
+namespace
+{
+    void create_functions(IModelVisitor& v)
+    {
+        const auto create_version = [&](YaToolObjectType_e type, YaToolObjectId id, YaToolObjectId parent, offset_t size, const std::vector<YaToolObjectId>& xrefs)
+        {
+            v.visit_start_version(type, id);
+            v.visit_parent_id(parent);
+            v.visit_size(size);
+            v.visit_start_xrefs();
+            offset_t offset = 0;
+            for(const auto xref : xrefs)
+            {
+                v.visit_start_xref(offset++, xref, 0);
+                v.visit_end_xref();
+            }
+            v.visit_end_xrefs();
+            v.visit_end_version();
+        };
+        v.visit_start();
+        create_version(OBJECT_TYPE_FUNCTION,    0x100, 0,     0x40, {0x900, 0x110, 0x120, 0x130});
+        create_version(OBJECT_TYPE_STACKFRAME,  0x900, 0x100, 0x18, {});
+        create_version(OBJECT_TYPE_BASIC_BLOCK, 0x110, 0x100, 0x10, {0x120, 0x130, 0x200});
+        create_version(OBJECT_TYPE_BASIC_BLOCK, 0x120, 0x100, 0x10, {0x130, 0x200, 0xA00});
+        create_version(OBJECT_TYPE_BASIC_BLOCK, 0x130, 0x100, 0x20, {});
+        create_version(OBJECT_TYPE_FUNCTION,    0x200, 0,     0x10, {0x210});
+        create_version(OBJECT_TYPE_BASIC_BLOCK, 0x210, 0x200, 0x10, {0x100, 0x200});
+        create_version(OBJECT_TYPE_DATA,        0xA00, 0,     0x08, {0x100});
+        v.visit_end();
+    }
+
+    std::vector<uint64_t> str(const FunctionSummary& s)
+    {
+        return {s.size, s.frame_size, s.basic_blocks, s.edges, s.callees, s.callers};
+    }
+
+    void function_summary_impl(const IModel& db)
+    {
+        EXPECT_EQ(std::vector<uint64_t>({0x40, 0x18, 3, 3, 1, 1}), str(db.get(0x100).summary()));
+        EXPECT_EQ(std::vector<uint64_t>({0x10, 0, 1, 0, 2, 2}), str(db.get(0x200).summary()));
+        EXPECT_EQ(std::vector<uint64_t>({0, 0, 0, 0, 0, 0}), str(db.get(0xA00).summary()));
+        db.walk([&](const HVersion& hver)
+        {
+            EXPECT_EQ(str(summarize_function(hver)), str(hver.summary()));
+            return WALK_CONTINUE;
+        });
+    }
+}
+
+TEST_F(TestYaToolDatabaseModel, memoryModel_functionSummary) {
+    const auto db = MakeMemoryModel();
+    create_functions(*db);
+    function_summary_impl(*db);
+}
+
+TEST_F(TestYaToolDatabaseModel, FBModel_functionSummary) {
+    // summaries must be stored, the model falls back to summarize_function otherwise
+    const auto exporter = MakeFlatBufferVisitor();
+    create_functions(*exporter);
+    const auto buf = exporter->GetBuffer();
+    const auto summaries = yadb::GetRoot(buf.value)->function_summaries();
+    ASSERT_NE(nullptr, summaries);
+    ASSERT_EQ(2u, summaries->size());
+    EXPECT_EQ(0x40u, summaries->Get(0)->size());
+    EXPECT_EQ(3u, summaries->Get(0)->basic_blocks());
+    EXPECT_EQ(0x10u, summaries->Get(1)->size());
+    EXPECT_EQ(2u, summaries->Get(1)->callers());
+
+    function_summary_impl(*create_fbmodel_with(&create_functions));
+}
+
+namespace
+{
+    void create_records(IModelVisitor& v)
+    {
+        const uint8_t blob[] = {0xDE, 0xAD, 0xBE, 0xEF};
+        v.visit_start();
+        v.visit_start_version(OBJECT_TYPE_STRUCT, 0x300);
+        v.visit_size(0x10);
+        v.visit_name(make_string_ref("some_struct"), 0);
+        v.visit_header_comment(true, make_string_ref("repeatable header"));
+        v.visit_start_xrefs();
+        v.visit_start_xref(0, 0x310, 0);
+        v.visit_end_xref();
+        v.visit_end_xrefs();
+        v.visit_end_version();
+
+        v.visit_start_version(OBJECT_TYPE_CODE, 0x400);
+        v.visit_size(0x20);
+        v.visit_parent_id(0x300);
+        v.visit_address(0x1000);
+        v.visit_name(make_string_ref("some_code"), 0x3);
+        v.visit_prototype(make_string_ref("int __cdecl(int)"));
+        v.visit_flags(0x8000);
+        v.visit_string_type(2);
+        v.visit_start_signatures();
+        v.visit_signature(SIGNATURE_FIRSTBYTE, SIGNATURE_ALGORITHM_CRC32, make_string_ref("ABCDEF01"));
+        v.visit_end_signatures();
+        v.visit_header_comment(false, make_string_ref("non-repeatable header"));
+        v.visit_start_offsets();
+        v.visit_offset_comments(0x4, COMMENT_ANTERIOR, make_string_ref("anterior"));
+        v.visit_offset_valueview(0x8, 1, make_string_ref("hexadecimal"));
+        v.visit_offset_registerview(0x8, 0x10, make_string_ref("eax"), make_string_ref("count"));
+        v.visit_offset_hiddenarea(0xC, 0x4, make_string_ref("hidden"));
+        v.visit_end_offsets();
+        v.visit_start_xrefs();
+        v.visit_start_xref(0x4, 0x300, 0);
+        v.visit_xref_attribute(make_string_ref("delta"), make_string_ref("0x10"));
+        v.visit_end_xref();
+        v.visit_start_xref(0x8, 0x500, 1);
+        v.visit_xref_attribute(make_string_ref("path_idx"), make_string_ref("1"));
+        v.visit_xref_attribute(make_string_ref("delta"), make_string_ref("0x20"));
+        v.visit_end_xref();
+        v.visit_end_xrefs();
+        v.visit_attribute(make_string_ref("format"), make_string_ref("code"));
+        v.visit_blob(0x0, blob, sizeof blob);
+        v.visit_end_version();
+        v.visit_end();
+    }
+
+    std::string export_xml(IModel& db)
+    {
+        std::string output;
+        db.accept(*MakeMemoryXmlVisitor(output));
+        return output;
+    }
+}
+
+TEST_F(TestYaToolDatabaseModel, versionRecord_transfers) {
+    const auto db = MakeMemoryModel();
+    create_records(*db);
+    const auto expected = export_xml(*db);
+    for(const auto* value : {"some_code", "int __cdecl(int)", "anterior", "count", "hidden", "path_idx", "0x20", "format", "DEADBEEF"})
+        EXPECT_NE(std::string::npos, expected.find(value)) << value;
+
+    // fine-grained calls gathered into records
+    const auto gathered = MakeMemoryModel();
+    create_records(*MakeVersionRecordVisitor(*gathered));
+    EXPECT_EQ(expected, export_xml(*gathered));
+
+    // native record transfers between models
+    const auto copy = MakeMemoryModel();
+    db->accept(*copy);
+    EXPECT_EQ(expected, export_xml(*copy));
+
+    const auto fb = create_fbmodel_with([&](IModelVisitor& v) { db->accept(v); });
+    const auto fb_expected = create_fbmodel_with(&create_records);
+    EXPECT_EQ(export_xml(*fb_expected), export_xml(*fb));
+
+    const auto fb_copy = MakeMemoryModel();
+    fb->accept(*fb_copy);
+    EXPECT_EQ(export_xml(*fb), export_xml(*fb_copy));
+}
+
+namespace
+{
+    struct AdvisedBuffer
+        : public Buffer
+    {
+        AdvisedBuffer(const void* pdata, size_t szdata)
+            : Buffer(pdata, szdata)
+        {
+        }
+
+        void Advise(MmapAccess_e access) const override
+        {
+            hints.push_back(access);
+        }
+
+        mutable std::vector<MmapAccess_e> hints;
+    };
+
+    class TestFlatBufferMmap
+        : public TestInTempFolder
+    {
+    };
+}
+
+TEST_F(TestYaToolDatabaseModel, FBModel_mmapHints) {
+    auto exporter = MakeFlatBufferVisitor();
+    create_model(*exporter);
+    const auto buf = exporter->GetBuffer();
+    const auto mmap = std::make_shared<AdvisedBuffer>(buf.value, buf.size);
+
+    // prefetched & read sequentially while indexing, random afterwards
+    const auto db = MakeFlatBufferModel(mmap);
+    EXPECT_EQ(std::vector<MmapAccess_e>({MMAP_ACCESS_WILLNEED, MMAP_ACCESS_SEQUENTIAL, MMAP_ACCESS_RANDOM}), mmap->hints);
+
+    mmap->hints.clear();
+    db->accept(*MakeMemoryModel());
+    EXPECT_EQ(std::vector<MmapAccess_e>({MMAP_ACCESS_SEQUENTIAL, MMAP_ACCESS_RANDOM}), mmap->hints);
+}
+
+TEST_F(TestFlatBufferMmap, advised_file_reads_unchanged) {
+    auto exporter = MakeFlatBufferVisitor();
+    create_model(*exporter);
+    const auto buf = exporter->GetBuffer();
+    const auto expected = std::string(static_cast<const char*>(buf.value), buf.size);
+    {
+        auto fh = fopen("model.yadb", "wb");
+        ASSERT_TRUE(!!fh);
+        ASSERT_EQ(1u, fwrite(buf.value, buf.size, 1, fh));
+        fclose(fh);
+    }
+
+    const auto before = GetIoStats();
+    const auto mmap = MmapFile("model.yadb");
+    for(const auto access : {MMAP_ACCESS_WILLNEED, MMAP_ACCESS_SEQUENTIAL, MMAP_ACCESS_RANDOM, MMAP_ACCESS_NORMAL})
+    {
+        mmap->Advise(access);
+        ASSERT_EQ(expected.size(), mmap->GetSize());
+        EXPECT_EQ(expected, std::string(static_cast<const char*>(mmap->Get()), mmap->GetSize()));
+    }
+    const auto after = GetIoStats();
+    EXPECT_LE(before.minor_faults, after.minor_faults);
+    EXPECT_LE(before.major_faults, after.major_faults);
+    EXPECT_LE(before.read_bytes, after.read_bytes);
+
+    const auto db = MakeFlatBufferModel(mmap);
+    EXPECT_EQ(4u, db->size());
+}
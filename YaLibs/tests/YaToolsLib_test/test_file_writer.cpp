@@ -0,0 +1,100 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "FileWriter.hpp"
+#include "test_common.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    class TestFileWriter : public TestInTempFolder
+    {
+    };
+
+    std::string read_file(const std::string& path)
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        std::stringstream data;
+        data << ifs.rdbuf();
+        return data.str();
+    }
+
+    std::string get_name(size_t i)
+    {
+        return "cache/" + std::to_string(i % 7) + "/" + std::to_string(i) + ".xml";
+    }
+}
+
+TEST_F(TestFileWriter, write_remove_and_flush)
+{
+    const size_t num_files = 1024;
+    for(const auto durability : {DURABILITY_NONE, DURABILITY_BATCH, DURABILITY_FILE})
+    {
+        const auto files = MakeFileWriter(durability, 4);
+        for(size_t i = 0; i < num_files; ++i)
+            files->write(get_name(i), "first " + std::to_string(i));
+
+        // operations on one path are applied in order
+        for(size_t i = 0; i < num_files; i += 2)
+            files->remove(get_name(i));
+        for(size_t i = 0; i < num_files; i += 4)
+            files->write(get_name(i), "second " + std::to_string(i));
+        EXPECT_TRUE(files->flush());
+
+        size_t bytes = 0;
+        for(size_t i = 0; i < num_files; ++i)
+        {
+            const auto name = get_name(i);
+            const auto data = read_file(name);
+            if(i % 4 == 0)
+                EXPECT_EQ("second " + std::to_string(i), data);
+            else if(i % 2 == 0)
+                EXPECT_FALSE(fs::exists(name));
+            else
+                EXPECT_EQ("first " + std::to_string(i), data);
+            bytes += ("first " + std::to_string(i)).size();
+            if(i % 4 == 0)
+                bytes += ("second " + std::to_string(i)).size();
+        }
+
+        const auto stats = files->stats();
+        EXPECT_EQ(num_files + num_files / 4, stats.written);
+        EXPECT_EQ(num_files / 2, stats.removed);
+        EXPECT_EQ(bytes, stats.bytes);
+
+        std::error_code ec;
+        fs::remove_all("cache", ec);
+        EXPECT_FALSE(ec);
+    }
+}
+
+TEST_F(TestFileWriter, report_errors_on_flush)
+{
+    const auto files = MakeFileWriter(DURABILITY_NONE, 2);
+    std::ofstream("blocker") << "not a directory";
+    files->write("blocker/file.xml", "data");
+    files->write("valid.xml", "data");
+    EXPECT_FALSE(files->flush());
+    EXPECT_EQ("data", read_file("valid.xml"));
+
+    // errors are reset on flush
+    files->write("valid.xml", "next");
+    EXPECT_TRUE(files->flush());
+    EXPECT_EQ("next", read_file("valid.xml"));
+}
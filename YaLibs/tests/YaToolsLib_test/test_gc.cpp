@@ -0,0 +1,160 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "Gc.hpp"
+#include "HVersion.hpp"
+#include "IModelVisitor.hpp"
+#include "MemoryModel.hpp"
+#include "XmlAccept.hpp"
+#include "XmlVisitor.hpp"
+
+#include <set>
+#include <vector>
+
+#ifdef _MSC_VER
+#   include <filesystem>
+#else
+#   include <experimental/filesystem>
+#endif
+
+namespace fs = std::experimental::filesystem;
+
+namespace
+{
+    void add_object(IModelVisitor& v, YaToolObjectType_e type, YaToolObjectId id, YaToolObjectId parent, const std::vector<YaToolObjectId>& xrefs = {})
+    {
+        v.visit_start_version(type, id);
+        if(parent)
+            v.visit_parent_id(parent);
+        v.visit_size(1);
+        v.visit_start_xrefs();
+        for(const auto& x : xrefs)
+        {
+            v.visit_start_xref(0, x, 0);
+            v.visit_end_xref();
+        }
+        v.visit_end_xrefs();
+        v.visit_end_version();
+    }
+
+    // a small cache with one orphan of each kind
+    void create_cache(IModelVisitor& v)
+    {
+        v.visit_start();
+        add_object(v, OBJECT_TYPE_BINARY,             0x01, 0,    {0x02});
+        add_object(v, OBJECT_TYPE_SEGMENT,            0x02, 0x01, {0x03});
+        add_object(v, OBJECT_TYPE_SEGMENT_CHUNK,      0x03, 0x02, {0x04});
+        add_object(v, OBJECT_TYPE_FUNCTION,           0x04, 0x03, {0x05, 0x06});
+        add_object(v, OBJECT_TYPE_STACKFRAME,         0x05, 0x04);
+        add_object(v, OBJECT_TYPE_STACKFRAME_MEMBER,  0x07, 0x05);
+        add_object(v, OBJECT_TYPE_BASIC_BLOCK,        0x06, 0x04, {0x08, 0x10});
+        add_object(v, OBJECT_TYPE_REFERENCE_INFO,     0x08, 0);
+        add_object(v, OBJECT_TYPE_STRUCT,             0x10, 0);
+        add_object(v, OBJECT_TYPE_STRUCT_MEMBER,      0x11, 0x10);
+        add_object(v, OBJECT_TYPE_ENUM,               0x20, 0);
+        add_object(v, OBJECT_TYPE_ENUM_MEMBER,        0x21, 0x20);
+
+        // member of a deleted struct
+        add_object(v, OBJECT_TYPE_STRUCT_MEMBER,      0x81, 0x80);
+        // basic block of an undefined function
+        add_object(v, OBJECT_TYPE_BASIC_BLOCK,        0x82, 0x83, {0x84});
+        // reference info only used by an orphan
+        add_object(v, OBJECT_TYPE_REFERENCE_INFO,     0x84, 0);
+        // stale reference info
+        add_object(v, OBJECT_TYPE_REFERENCE_INFO,     0x85, 0);
+        // stackframe member of a deleted stackframe
+        add_object(v, OBJECT_TYPE_STACKFRAME_MEMBER,  0x86, 0x87);
+        // orphan cycle
+        add_object(v, OBJECT_TYPE_CODE,               0x88, 0x89, {0x89});
+        add_object(v, OBJECT_TYPE_CODE,               0x89, 0x88, {0x88});
+        v.visit_end();
+    }
+
+    std::set<YaToolObjectId> get_orphans(const IModel& db)
+    {
+        std::set<YaToolObjectId> orphans;
+        gc::walk_orphans(db, [&](const HVersion& hver)
+        {
+            orphans.insert(hver.id());
+            return WALK_CONTINUE;
+        });
+        return orphans;
+    }
+
+    std::set<YaToolObjectId> get_ids(const IModel& db)
+    {
+        std::set<YaToolObjectId> ids;
+        db.walk([&](const HVersion& hver)
+        {
+            ids.insert(hver.id());
+            return WALK_CONTINUE;
+        });
+        return ids;
+    }
+
+    const std::set<YaToolObjectId> expected_orphans = {0x81, 0x82, 0x84, 0x85, 0x86, 0x88, 0x89};
+}
+
+TEST(gc, walks_unreachable_objects)
+{
+    const auto db = MakeMemoryModel();
+    create_cache(*db);
+    EXPECT_EQ(expected_orphans, get_orphans(*db));
+}
+
+TEST(gc, keeps_clean_models)
+{
+    const auto db = MakeMemoryModel();
+    create_cache(*db);
+    const auto clean = MakeMemoryModel();
+    clean->visit_start();
+    db->walk([&](const HVersion& hver)
+    {
+        if(!expected_orphans.count(hver.id()))
+            hver.accept(*clean);
+        return WALK_CONTINUE;
+    });
+    clean->visit_end();
+    EXPECT_EQ(std::set<YaToolObjectId>(), get_orphans(*clean));
+}
+
+TEST(gc, deletes_orphans_from_xml_cache)
+{
+    const auto folder = fs::path("gc_cache");
+    std::error_code ec;
+    fs::remove_all(folder, ec);
+
+    create_cache(*MakeXmlVisitor(folder.string()));
+    const auto db = MakeMemoryModel();
+    AcceptXmlCache(*db, folder.string());
+    const auto all = get_ids(*db);
+    ASSERT_EQ(19u, all.size());
+
+    // walking orphans is read-only, deleting them goes through a visitor
+    EXPECT_EQ(expected_orphans, get_orphans(*db));
+    EXPECT_EQ(7u, gc::delete_orphans(*db, *MakeXmlVisitor(folder.string())));
+
+    const auto after = MakeMemoryModel();
+    AcceptXmlCache(*after, folder.string());
+    std::set<YaToolObjectId> expected;
+    for(const auto id : all)
+        if(!expected_orphans.count(id))
+            expected.insert(id);
+    EXPECT_EQ(expected, get_ids(*after));
+    EXPECT_EQ(std::set<YaToolObjectId>(), get_orphans(*after));
+    fs::remove_all(folder, ec);
+}
@@ -16,10 +16,14 @@
 #include <iostream>
 #include <fstream>
 #include <iso646.h>
+#include <set>
 
 #include "gtest/gtest.h"
 
 #include <Git.hpp>
+#include "CacheDelta.hpp"
+#include "HVersion.hpp"
+#include "IModel.hpp"
 #include "Utils.hpp"
 #include "test_common.hpp"
 
@@ -223,6 +227,134 @@ TEST_F (TestYaGitLib, test_git_status_with_path)
     EXPECT_EQ(files, ref2);
 }
 
+TEST_F (TestYaGitLib, test_git_diff_index)
+{
+    const auto repo = MakeGitAsync("test");
+    set_user_config(*repo);
+
+    // enough files to inflate blobs on multiple threads
+    const auto num_files = 512;
+    const auto get_name = [](int i)
+    {
+        char buf[32];
+        snprintf(buf, sizeof buf, "file%03d.txt", i);
+        return std::string(buf);
+    };
+    for(int i = 0; i < num_files; ++i)
+    {
+        write_file("test/" + get_name(i), "content " + std::to_string(i));
+        repo->add_file(get_name(i));
+    }
+    auto ok = repo->commit("add files");
+    EXPECT_TRUE(ok);
+    const auto commit = repo->get_commit("HEAD");
+
+    using Blob = std::tuple<std::string, bool, std::string>;
+    std::vector<Blob> expected;
+    for(int i = 0; i < num_files; ++i)
+    {
+        if(i % 3 == 0)
+        {
+            ok = repo->remove_file(get_name(i));
+            EXPECT_TRUE(ok);
+            expected.emplace_back(get_name(i), false, "content " + std::to_string(i) + "\n");
+        }
+        else if(i % 3 == 1)
+        {
+            write_file("test/" + get_name(i), "updated " + std::to_string(i));
+            ok = repo->add_file(get_name(i));
+            EXPECT_TRUE(ok);
+            expected.emplace_back(get_name(i), true, "updated " + std::to_string(i) + "\n");
+        }
+    }
+
+    std::vector<Blob> blobs;
+    ok = repo->diff_index(commit, [&](const char* path, bool added, const void* data, size_t size)
+    {
+        blobs.emplace_back(path, added, std::string(static_cast<const char*>(data), size));
+        return 0;
+    });
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(expected, blobs);
+}
+
+namespace
+{
+    std::string make_xml_object(const std::string& id, const std::string& address)
+    {
+        return
+            "<?xml version=\"1.0\" encoding=\"iso-8859-15\"?>\n"
+            "<sigfile>\n"
+            "<basic_block>\n"
+            "  <id>" + id + "</id>\n"
+            "  <version>\n"
+            "    <address>" + address + "</address>\n"
+            "    <size>0x8</size>\n"
+            "  </version>\n"
+            "</basic_block>\n"
+            "</sigfile>";
+    }
+
+    std::set<YaToolObjectId> get_ids(const IModel& model)
+    {
+        std::set<YaToolObjectId> ids;
+        model.walk([&](const HVersion& hver)
+        {
+            ids.insert(hver.id());
+            return WALK_CONTINUE;
+        });
+        return ids;
+    }
+}
+
+TEST_F (TestYaGitLib, test_git_diff_commits)
+{
+    const auto repo = MakeGitAsync("test");
+    set_user_config(*repo);
+    std::error_code ec;
+    fs::create_directories("test/cache/basic_block", ec);
+    EXPECT_FALSE(ec);
+
+    const auto add_object = [&](const std::string& id, const std::string& address)
+    {
+        const auto name = "cache/basic_block/" + id + ".xml";
+        write_file("test/" + name, make_xml_object(id, address));
+        const auto ok = repo->add_file(name);
+        EXPECT_TRUE(ok);
+    };
+    add_object("0000000000000001", "0x10");
+    add_object("0000000000000002", "0x20");
+    add_object("0000000000000003", "0x30");
+    auto ok = repo->commit("first");
+    EXPECT_TRUE(ok);
+    const auto checkpoint = repo->get_commit("HEAD");
+
+    // update 2, delete 3 & add 4 over two commits
+    add_object("0000000000000002", "0x22");
+    commit_file(*repo, "test/", "database.idb", "second", "not an object");
+    delete_file(*repo, "test/", "cache/basic_block/0000000000000003.xml", "third");
+    add_object("0000000000000004", "0x40");
+    ok = repo->commit("fourth");
+    EXPECT_TRUE(ok);
+
+    CacheDelta delta;
+    ok = cache::diff_commits(delta, *repo, checkpoint, "HEAD");
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(std::set<YaToolObjectId>({2, 4}), get_ids(*delta.updated));
+    EXPECT_EQ(std::set<YaToolObjectId>({3}), get_ids(*delta.deleted));
+    EXPECT_EQ(0x22u, delta.updated->get(2).address());
+
+    // nothing changed since head
+    ok = cache::diff_commits(delta, *repo, repo->get_commit("HEAD"), "HEAD");
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(0u, delta.updated->size());
+    EXPECT_EQ(0u, delta.deleted->size());
+
+    // unknown checkpoints must not be trusted
+    ok = cache::diff_commits(delta, *repo, "0123456789012345678901234567890123456789", "HEAD");
+    EXPECT_FALSE(ok);
+}
+
 TEST_F (TestYaGitLib, test_git_rebase)
 {
     // initialize upstream bare repository
@@ -393,6 +525,101 @@ TEST_F (TestYaGitLib, test_git_rebase_fixup)
     EXPECT_EQ("z content\n", file_a);
 }
 
+TEST_F (TestYaGitLib, test_git_scope)
+{
+    // initialize upstream bare repository
+    const auto c = MakeGitBare("c");
+    auto ok = c->clone("a", IGit::CLONE_FULL);
+    EXPECT_TRUE(ok);
+
+    const auto a = MakeGitAsync("a");
+    set_user_config(*a);
+    std::error_code ec;
+    fs::create_directories("a/cache/struct", ec);
+    fs::create_directories("a/cache/function", ec);
+    commit_file(*a, "a/", "file.txt", "file", "file content");
+    commit_file(*a, "a/", "cache/struct/s1.xml", "s1", "s1 content");
+    push_file(*a, "a/", "cache/function/f1.xml", "f1", "f1 content");
+
+    ok = c->clone("b", IGit::CLONE_FULL);
+    EXPECT_TRUE(ok);
+    const auto b = MakeGitAsync("b");
+    set_user_config(*b);
+
+    // only structures are kept in cache
+    ok = b->set_scope({"cache/struct/", "!cache/", "*"});
+    EXPECT_TRUE(ok);
+    EXPECT_TRUE(fs::exists("b/file.txt"));
+    EXPECT_TRUE(fs::exists("b/cache/struct/s1.xml"));
+    EXPECT_FALSE(fs::exists("b/cache/function/f1.xml"));
+
+    const auto get_status = [&](IGit& git, const std::string& path = "")
+    {
+        std::set<std::string> files;
+        ok = git.status(path, [&](const char* name, const IGit::Status& status)
+        {
+            if(status.deleted || status.modified || status.untracked)
+                files.insert(name);
+        });
+        EXPECT_TRUE(ok);
+        return files;
+    };
+    EXPECT_EQ(std::set<std::string>(), get_status(*b));
+
+    // out-of-scope upstream changes are neither checked out nor parsed
+    commit_file(*a, "a/", "cache/struct/s1.xml", "s1 update", "s1 updated");
+    commit_file(*a, "a/", "cache/function/f1.xml", "f1 update", "f1 updated");
+    push_file(*a, "a/", "cache/function/f2.xml", "f2", "f2 content");
+    commit_file(*b, "b/", "cache/struct/s2.xml", "s2", "s2 content");
+    fetch_rebase(*b, "origin", "master",
+    {
+        {0, "cache/struct/s1.xml", "s1 updated\n"},
+        {1, "cache/struct/s2.xml", "s2 content\n"},
+    }, {});
+    EXPECT_EQ("s1 updated\n", read_file("b/cache/struct/s1.xml"));
+    EXPECT_FALSE(fs::exists("b/cache/function/f1.xml"));
+    EXPECT_FALSE(fs::exists("b/cache/function/f2.xml"));
+    EXPECT_EQ(std::set<std::string>(), get_status(*b));
+
+    // out-of-scope files must survive local commits
+    push(*b);
+    fetch_rebase(*a, "origin", "master", {}, {});
+    EXPECT_EQ("f1 updated\n", read_file("a/cache/function/f1.xml"));
+    EXPECT_EQ("f2 content\n", read_file("a/cache/function/f2.xml"));
+    EXPECT_EQ("s2 content\n", read_file("a/cache/struct/s2.xml"));
+
+    // out-of-scope files written locally are visible again
+    write_file("b/cache/function/f1.xml", "f1 local");
+    EXPECT_EQ(std::set<std::string>(), get_status(*b, "cache/struct/"));
+    EXPECT_EQ(std::set<std::string>({"cache/function/f1.xml"}), get_status(*b));
+    ok = b->add_file("cache/function/f1.xml");
+    EXPECT_TRUE(ok);
+    ok = b->commit("f1 local");
+    EXPECT_TRUE(ok);
+    push_file(*a, "a/", "cache/struct/s3.xml", "s3", "s3 content");
+    fetch_rebase(*b, "origin", "master",
+    {
+        {0, "cache/struct/s3.xml", "s3 content\n"},
+    }, {});
+    EXPECT_FALSE(fs::exists("b/cache/function/f1.xml"));
+    push(*b);
+    fetch_rebase(*a, "origin", "master", {}, {});
+    EXPECT_EQ("f1 local\n", read_file("a/cache/function/f1.xml"));
+
+    // checkout discards local out-of-scope files
+    write_file("b/cache/function/f1.xml", "f1 discarded");
+    ok = b->checkout_head();
+    EXPECT_TRUE(ok);
+    EXPECT_FALSE(fs::exists("b/cache/function/f1.xml"));
+
+    // empty scope restores every file
+    ok = b->set_scope({});
+    EXPECT_TRUE(ok);
+    EXPECT_EQ("f1 local\n", read_file("b/cache/function/f1.xml"));
+    EXPECT_EQ("f2 content\n", read_file("b/cache/function/f2.xml"));
+    EXPECT_EQ(std::set<std::string>(), get_status(*b));
+}
+
 TEST(yatools, test_check_yaco_version)
 {
     const struct
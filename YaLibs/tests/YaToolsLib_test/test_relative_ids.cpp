@@ -0,0 +1,145 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "Hash.hpp"
+#include "HVersion.hpp"
+#include "IModelVisitor.hpp"
+#include "MemoryModel.hpp"
+#include "RelativeIds.hpp"
+
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    void add_object(IModelVisitor& v, YaToolObjectType_e type, YaToolObjectId id, YaToolObjectId parent, offset_t address, const std::vector<std::pair<offset_t, YaToolObjectId>>& xrefs = {})
+    {
+        v.visit_start_version(type, id);
+        if(parent)
+            v.visit_parent_id(parent);
+        v.visit_address(address);
+        v.visit_start_xrefs();
+        for(const auto& x : xrefs)
+        {
+            v.visit_start_xref(x.first, x.second, 0);
+            v.visit_end_xref();
+        }
+        v.visit_end_xrefs();
+        v.visit_end_version();
+    }
+
+    // export a small binary loaded at base, with legacy absolute ids
+    std::shared_ptr<IModelAndVisitor> make_absolute_model(uint64_t base)
+    {
+        const auto func_ea  = base + 0x1100;
+        const auto binary   = hash::hash_binary();
+        const auto segment  = hash::hash_segment(base + 0x1000);
+        const auto chunk    = hash::hash_segment_chunk(base + 0x1000);
+        const auto function = hash::hash_function(func_ea);
+        const auto stack    = hash::hash_stack(func_ea);
+        const auto member   = hash::hash_member(stack, 8);
+        const auto block    = hash::hash_ea(func_ea);
+        const auto ref      = hash::hash_reference(func_ea + 4, base);
+
+        const auto db = MakeMemoryModel();
+        db->visit_start();
+        add_object(*db, OBJECT_TYPE_BINARY,             binary,     0,          base,           {{0x1000, segment}});
+        add_object(*db, OBJECT_TYPE_SEGMENT,            segment,    binary,     base + 0x1000,  {{0, chunk}});
+        add_object(*db, OBJECT_TYPE_SEGMENT_CHUNK,      chunk,      segment,    base + 0x1000,  {{0x100, function}});
+        add_object(*db, OBJECT_TYPE_FUNCTION,           function,   chunk,      func_ea,        {{0, block}, {0, stack}});
+        add_object(*db, OBJECT_TYPE_STACKFRAME,         stack,      function,   func_ea,        {{8, member}});
+        add_object(*db, OBJECT_TYPE_STACKFRAME_MEMBER,  member,     stack,      8);
+        add_object(*db, OBJECT_TYPE_BASIC_BLOCK,        block,      function,   func_ea,        {{4, ref}});
+        add_object(*db, OBJECT_TYPE_REFERENCE_INFO,     ref,        0,          base);
+        db->visit_end();
+        return db;
+    }
+
+    std::shared_ptr<IModelAndVisitor> make_relative_model(uint64_t base)
+    {
+        const auto absolute = make_absolute_model(base);
+        const auto ids = relative_ids::get_ids(*absolute, base);
+        const auto db = MakeMemoryModel();
+        absolute->accept(*relative_ids::make_visitor(*db, ids, base));
+        return db;
+    }
+
+    using Object = std::tuple<YaToolObjectType_e, YaToolObjectId, YaToolObjectId, offset_t, std::vector<YaToolObjectId>>;
+
+    std::vector<Object> get_objects(const IModel& model)
+    {
+        std::vector<Object> objects;
+        model.walk([&](const HVersion& hver)
+        {
+            if(hver.type() == OBJECT_TYPE_BINARY)
+                return WALK_CONTINUE;
+
+            std::vector<YaToolObjectId> xrefs;
+            hver.walk_xrefs([&](offset_t, operand_t, YaToolObjectId id, const XrefAttributes*)
+            {
+                xrefs.push_back(id);
+                return WALK_CONTINUE;
+            });
+            objects.emplace_back(hver.type(), hver.id(), hver.parent_id(), hver.address(), xrefs);
+            return WALK_CONTINUE;
+        });
+        return objects;
+    }
+}
+
+TEST(relative_ids, absolute_ids_are_unchanged_by_default)
+{
+    EXPECT_FALSE(hash::has_relative_ids());
+    EXPECT_EQ(0u, hash::get_image_base());
+    const auto a = get_objects(*make_absolute_model(0x400000));
+    const auto b = get_objects(*make_absolute_model(0x10000000));
+    EXPECT_EQ(a.size(), b.size());
+    EXPECT_NE(a, b);
+}
+
+TEST(relative_ids, rebase_keeps_relative_objects)
+{
+    const auto a = make_relative_model(0x400000);
+    const auto b = make_relative_model(0x10000000);
+    EXPECT_EQ(get_objects(*a), get_objects(*b));
+    EXPECT_EQ(8u, a->size());
+    EXPECT_FALSE(hash::has_relative_ids());
+
+    // only binary object records image base
+    const auto binary = a->get(hash::hash_binary());
+    EXPECT_TRUE(relative_ids::is_enabled(binary));
+    EXPECT_EQ(0x400000u, binary.address());
+    EXPECT_EQ(0x10000000u, b->get(hash::hash_binary()).address());
+}
+
+TEST(relative_ids, converted_ids_match_relative_hashes)
+{
+    const auto base = 0x400000;
+    const auto db = make_relative_model(base);
+    hash::set_relative_ids(true, base);
+    const auto function = hash::hash_function(base + 0x1100);
+    const auto stack = hash::hash_stack(base + 0x1100);
+    const auto member = hash::hash_member(stack, 8);
+    const auto ref = hash::hash_reference(base + 0x1104, base);
+    hash::set_relative_ids(false, 0);
+
+    EXPECT_EQ(0x1100u, db->get(function).address());
+    EXPECT_TRUE(db->has(stack));
+    EXPECT_EQ(stack, db->get(member).parent_id());
+    EXPECT_EQ(OBJECT_TYPE_REFERENCE_INFO, db->get(ref).type());
+    EXPECT_EQ(0u, db->get(ref).address());
+}
@@ -0,0 +1,186 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "SavePipeline.hpp"
+#include "IModel.hpp"
+#include "MemoryModel.hpp"
+#include "HVersion.hpp"
+#include "FileWriter.hpp"
+#include "Git.hpp"
+#include "test_common.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // synthetic snapshot with one object per id
+    std::shared_ptr<IModel> make_snapshot(const std::vector<YaToolObjectId>& ids)
+    {
+        const auto db = MakeMemoryModel();
+        db->visit_start();
+        for(const auto id : ids)
+        {
+            db->visit_start_version(OBJECT_TYPE_DATA, id);
+            db->visit_size(1);
+            db->visit_end_version();
+        }
+        db->visit_end();
+        return db;
+    }
+
+    YaToolObjectId first_id(const IModel& snapshot)
+    {
+        YaToolObjectId id = 0;
+        snapshot.walk([&](const HVersion& hver)
+        {
+            id = hver.id();
+            return WALK_STOP;
+        });
+        return id;
+    }
+}
+
+TEST(save_pipeline, saves_snapshots_in_order)
+{
+    for(const auto max_pending : {0, 1, 3})
+    {
+        std::mutex mutex;
+        std::vector<YaToolObjectId> saved;
+        const auto pipeline = MakeSavePipeline([&](IModel& snapshot)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::lock_guard<std::mutex> lock(mutex);
+            saved.push_back(first_id(snapshot));
+            return true;
+        }, max_pending);
+
+        std::vector<YaToolObjectId> expected;
+        for(YaToolObjectId id = 1; id <= 16; ++id)
+        {
+            pipeline->post(make_snapshot({id, id + 100}));
+            expected.push_back(id);
+        }
+        EXPECT_TRUE(pipeline->flush());
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(expected, saved);
+    }
+}
+
+TEST(save_pipeline, blocks_when_saves_pile_up)
+{
+    std::atomic<size_t> num_saved(0);
+    std::atomic<bool> release(false);
+    const auto pipeline = MakeSavePipeline([&](IModel&)
+    {
+        while(!release)
+            std::this_thread::yield();
+        ++num_saved;
+        return true;
+    }, 2);
+
+    pipeline->post(make_snapshot({1}));
+    pipeline->post(make_snapshot({2}));
+    std::atomic<bool> posted(false);
+    std::thread poster([&]
+    {
+        pipeline->post(make_snapshot({3}));
+        posted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(posted);
+    EXPECT_EQ(0u, num_saved);
+
+    release = true;
+    poster.join();
+    EXPECT_TRUE(posted);
+    EXPECT_TRUE(pipeline->flush());
+    EXPECT_EQ(3u, num_saved);
+}
+
+TEST(save_pipeline, reports_errors_on_flush)
+{
+    const auto pipeline = MakeSavePipeline([&](IModel& snapshot)
+    {
+        return first_id(snapshot) != 2;
+    }, 2);
+    for(YaToolObjectId id = 1; id <= 3; ++id)
+        pipeline->post(make_snapshot({id}));
+    EXPECT_FALSE(pipeline->flush());
+
+    // errors are reported once
+    pipeline->post(make_snapshot({4}));
+    EXPECT_TRUE(pipeline->flush());
+}
+
+TEST(save_pipeline, saves_pending_snapshots_on_destruction)
+{
+    std::atomic<size_t> num_saved(0);
+    {
+        const auto pipeline = MakeSavePipeline([&](IModel&)
+        {
+            ++num_saved;
+            return true;
+        }, 4);
+        for(YaToolObjectId id = 1; id <= 4; ++id)
+            pipeline->post(make_snapshot({id}));
+    }
+    EXPECT_EQ(4u, num_saved);
+}
+
+namespace
+{
+    class TestSavePipeline
+        : public TestInTempFolder
+    {
+    };
+}
+
+TEST_F(TestSavePipeline, posts_before_xml_cache_is_committed)
+{
+    const auto git = MakeGit("test");
+    git->config_set_string("user.name", "test_user");
+    git->config_set_string("user.email", "test_email");
+
+    // commits wait for post to return, or give up after one second
+    std::atomic<bool> posted(false);
+    std::atomic<bool> committed_after_post(false);
+    size_t num_added = 0;
+    const auto commit = [&]
+    {
+        for(int i = 0; i < 1000 && !posted; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        committed_after_post = posted.load();
+        git->status("cache/", [&](const char* name, const IGit::Status& status)
+        {
+            if(status.untracked && git->add_file(name))
+                ++num_added;
+        });
+        return git->commit("cache: save");
+    };
+    const auto pipeline = MakeSavePipeline(MakeXmlCacheSave("test/cache", MakeFileWriter(DURABILITY_NONE, 0), commit), 2);
+
+    pipeline->post(make_snapshot({1, 2, 3}));
+    posted = true;
+    EXPECT_TRUE(pipeline->flush());
+    EXPECT_TRUE(committed_after_post);
+    EXPECT_EQ(3u, num_added);
+    EXPECT_FALSE(git->get_commit("HEAD").empty());
+}
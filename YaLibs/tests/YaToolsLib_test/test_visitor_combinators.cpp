@@ -0,0 +1,180 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "FlatBufferVisitor.hpp"
+#include "HVersion.hpp"
+#include "IModelVisitor.hpp"
+#include "MemoryModel.hpp"
+#include "VersionRecord.hpp"
+#include "VisitorCombinators.hpp"
+#include "XmlVisitor.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void add_object(IModelVisitor& v, YaToolObjectType_e type, YaToolObjectId id, YaToolObjectId parent, const char* name, const std::vector<YaToolObjectId>& xrefs = {})
+    {
+        v.visit_start_version(type, id);
+        if(parent)
+            v.visit_parent_id(parent);
+        v.visit_name(make_string_ref(name), 0);
+        v.visit_start_xrefs();
+        offset_t offset = 0;
+        for(const auto xref : xrefs)
+        {
+            v.visit_start_xref(offset++, xref, 0);
+            v.visit_xref_attribute(make_string_ref("key"), make_string_ref(name));
+            v.visit_end_xref();
+        }
+        v.visit_end_xrefs();
+        v.visit_end_version();
+    }
+
+    void create_model(IModelVisitor& v)
+    {
+        v.visit_start();
+        v.visit_deleted(OBJECT_TYPE_DATA, 0x900);
+        add_object(v, OBJECT_TYPE_FUNCTION,    0x100, 0,     "func",  {0x110, 0x120});
+        add_object(v, OBJECT_TYPE_BASIC_BLOCK, 0x110, 0x100, "block", {0x120, 0x200});
+        add_object(v, OBJECT_TYPE_BASIC_BLOCK, 0x120, 0x100, "block", {});
+        add_object(v, OBJECT_TYPE_DATA,        0x200, 0,     "data",  {0x100});
+        add_object(v, OBJECT_TYPE_STRUCT,      0x300, 0,     "struc", {});
+        v.visit_end();
+    }
+
+    std::string export_xml(IModel& db)
+    {
+        std::string output;
+        db.accept(*MakeMemoryXmlVisitor(output));
+        return output;
+    }
+
+    std::string to_string(const ExportedBuffer& buf)
+    {
+        return std::string(static_cast<const char*>(buf.value), buf.size);
+    }
+
+    std::string export_fb(IModel& db)
+    {
+        const auto exporter = MakeFlatBufferVisitor();
+        db.accept(*exporter);
+        return to_string(exporter->GetBuffer());
+    }
+
+    std::vector<YaToolObjectId> get_ids(const IModel& db)
+    {
+        std::vector<YaToolObjectId> ids;
+        db.walk([&](const HVersion& hver)
+        {
+            ids.push_back(hver.id());
+            return WALK_CONTINUE;
+        });
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    void check_tee(size_t max_pending)
+    {
+        const auto db = MakeMemoryModel();
+        create_model(*db);
+        const auto expected = export_xml(*db);
+
+        std::string xml;
+        const auto xml_sink = MakeMemoryXmlVisitor(xml);
+        const auto mem = MakeMemoryModel();
+        const auto fb = MakeFlatBufferVisitor();
+        db->accept(*MakeTeeVisitor({xml_sink.get(), mem.get(), fb.get()}, max_pending));
+
+        EXPECT_EQ(expected, xml);
+        EXPECT_EQ(expected, export_xml(*mem));
+        EXPECT_EQ(export_fb(*db), to_string(fb->GetBuffer()));
+    }
+}
+
+TEST(visitor_combinators, tee_forwards_to_every_sink)
+{
+    check_tee(0);
+}
+
+TEST(visitor_combinators, async_tee_forwards_to_every_sink)
+{
+    check_tee(1);
+    check_tee(64);
+}
+
+TEST(visitor_combinators, tee_gathers_fine_grained_calls)
+{
+    const auto expected = MakeMemoryModel();
+    create_model(*expected);
+
+    const auto a = MakeMemoryModel();
+    const auto b = MakeMemoryModel();
+    create_model(*MakeTeeVisitor({a.get(), b.get()}, 2));
+    EXPECT_EQ(export_xml(*expected), export_xml(*a));
+    EXPECT_EQ(export_xml(*expected), export_xml(*b));
+}
+
+TEST(visitor_combinators, filter_types_and_ids)
+{
+    const auto db = MakeMemoryModel();
+    create_model(*db);
+
+    const auto blocks = MakeMemoryModel();
+    db->accept(*MakeFilterVisitor(*blocks, filter_types({OBJECT_TYPE_BASIC_BLOCK})));
+    EXPECT_EQ(std::vector<YaToolObjectId>({0x110, 0x120}), get_ids(*blocks));
+
+    const auto some = MakeMemoryModel();
+    db->accept(*MakeFilterVisitor(*some, filter_ids({0x100, 0x300, 0x400})));
+    EXPECT_EQ(std::vector<YaToolObjectId>({0x100, 0x300}), get_ids(*some));
+
+    const auto named = MakeMemoryModel();
+    db->accept(*MakeFilterVisitor(*named, [](const VersionRecord& record)
+    {
+        return make_string(record.username) == "data";
+    }));
+    EXPECT_EQ(std::vector<YaToolObjectId>({0x200}), get_ids(*named));
+}
+
+TEST(visitor_combinators, remap_ids)
+{
+    const auto db = MakeMemoryModel();
+    create_model(*db);
+
+    const auto remapped = MakeMemoryModel();
+    db->accept(*MakeRemapVisitor(*remapped, [](YaToolObjectId id)
+    {
+        return id + 0x1000;
+    }));
+    EXPECT_EQ(std::vector<YaToolObjectId>({0x1100, 0x1110, 0x1120, 0x1200, 0x1300}), get_ids(*remapped));
+
+    const auto block = remapped->get(0x1110);
+    ASSERT_TRUE(block.is_valid());
+    EXPECT_EQ(0x1100u, block.parent_id());
+    std::vector<YaToolObjectId> xrefs;
+    block.walk_xrefs_from([&](offset_t, operand_t, const HVersion& xref)
+    {
+        xrefs.push_back(xref.id());
+        return WALK_CONTINUE;
+    });
+    EXPECT_EQ(std::vector<YaToolObjectId>({0x1120, 0x1200}), xrefs);
+
+    // parentless versions stay parentless
+    EXPECT_EQ(0u, remapped->get(0x1100).parent_id());
+}
@@ -0,0 +1,122 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <YaTypes.hpp>
+#include <BinHex.hpp>
+#include <Gc.hpp>
+#include <Git.hpp>
+#include <HVersion.hpp>
+#include <MemoryModel.hpp>
+#include <XmlAccept.hpp>
+#include <XmlVisitor.hpp>
+#include <Yatools.hpp>
+
+#include <iostream>
+#include <cstring>
+
+// removes objects unreachable from cache roots, see gc::walk_orphans
+
+void usage(char* name)
+{
+    std::cerr << "Usage: " << std::endl;
+    std::cerr << name << " [--dry-run] REPO_FOLDER" << std::endl;
+    std::cerr << "\t--dry-run:\t\tonly list orphans" << std::endl;
+    std::cerr << "\tREPO_FOLDER:\t\tgit repository with a cache folder" << std::endl;
+}
+
+std::string get_cache_path(const HVersion& hver)
+{
+    char buf[sizeof(YaToolObjectId) * 2 + 1];
+    to_hex<NullTerminate>(buf, hver.id());
+    return std::string("cache/") + get_object_type_string(hver.type()) + "/" + buf + ".xml";
+}
+
+int main_func(bool dry_run, const std::string& repo)
+{
+    const auto cache = repo + "/cache";
+    const auto db = MakeMemoryModel();
+    AcceptXmlCache(*db, cache);
+
+    std::vector<std::string> orphans;
+    gc::walk_orphans(*db, [&](const HVersion& hver)
+    {
+        orphans.push_back(get_cache_path(hver));
+        std::cout << orphans.back() << " " << make_string(hver.username()) << std::endl;
+        return WALK_CONTINUE;
+    });
+    std::cout << repo << ": " << orphans.size() << "/" << db->size() << " orphans" << std::endl;
+    if(dry_run || orphans.empty())
+        return 0;
+
+    const auto git = is_git_directory(repo) ? MakeGit(repo) : nullptr;
+    if(!git)
+    {
+        std::cerr << "error: unable to open git repository " << repo << std::endl;
+        return -1;
+    }
+
+    gc::delete_orphans(*db, *MakeXmlVisitor(cache));
+    for(const auto& path : orphans)
+        if(!git->remove_file(path))
+            std::cerr << "warning: unable to remove " << path << " from index" << std::endl;
+
+    const auto msg = "cache: " + std::to_string(orphans.size()) + " orphans deleted";
+    if(!git->commit(msg))
+    {
+        std::cerr << "error: unable to commit" << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    globals::InitFileLogger(*globals::Get().logger, stdout);
+    std::vector<std::string> args;
+    bool dry_run = false;
+    for(int i = 1; i < argc; ++i)
+        if(!strcmp(argv[i], "--dry-run"))
+            dry_run = true;
+        else
+            args.push_back(argv[i]);
+    if(args.size() != 1)
+    {
+        usage(argv[0]);
+        return -1;
+    }
+    try
+    {
+        return main_func(dry_run, args[0]);
+    }
+    catch(std::string& exc)
+    {
+        std::cerr << "error: " << exc << std::endl;
+        return -1;
+    }
+    catch(const char* message)
+    {
+        std::cerr << "error: " << message << std::endl;
+        return -1;
+    }
+    catch(std::exception& exc)
+    {
+        std::cerr << "error: " << exc.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cerr << "error !!!" << std::endl;
+    }
+    return -1;
+}
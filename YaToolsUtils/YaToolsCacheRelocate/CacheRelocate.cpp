@@ -0,0 +1,107 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Hash.hpp>
+#include <HVersion.hpp>
+#include <MemoryModel.hpp>
+#include <RelativeIds.hpp>
+#include <XmlAccept.hpp>
+#include <XmlVisitor.hpp>
+#include <Yatools.hpp>
+
+#include <iostream>
+
+// converts an xml cache using absolute ids to image-relative ids,
+// see hash::set_relative_ids
+
+void usage(char* name)
+{
+    std::cerr << "Usage: " << std::endl;
+    std::cerr << name << " CACHE_FOLDER" << std::endl;
+}
+
+int main_func(const std::string& folder)
+{
+    const auto db = MakeMemoryModel();
+    AcceptXmlCache(*db, folder);
+    const auto binary = db->get(hash::hash_binary());
+    if(!binary.is_valid())
+    {
+        std::cerr << "error: missing binary object in " << folder << std::endl;
+        return -1;
+    }
+    if(relative_ids::is_enabled(binary))
+    {
+        std::cout << folder << " already uses relative ids" << std::endl;
+        return 0;
+    }
+
+    const auto image_base = binary.address();
+    const auto ids = relative_ids::get_ids(*db, image_base);
+    const auto output = MakeXmlVisitor(folder);
+    output->visit_start();
+
+    // remove absolute files first, relative ids never collide with them
+    size_t moved = 0;
+    for(const auto& it : ids)
+        if(it.first != it.second)
+        {
+            output->visit_deleted(db->get(it.first).type(), it.first);
+            ++moved;
+        }
+
+    const auto relative = relative_ids::make_visitor(*output, ids, image_base);
+    db->walk([&](const HVersion& hver)
+    {
+        hver.accept(*relative);
+        return WALK_CONTINUE;
+    });
+    output->visit_end();
+    std::cout << folder << ": " << moved << "/" << db->size() << " objects relocated from image base 0x" << std::hex << image_base << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    globals::InitFileLogger(*globals::Get().logger, stdout);
+    if(argc < 2)
+    {
+        usage(argv[0]);
+        return -1;
+    }
+    try
+    {
+        return main_func(argv[1]);
+    }
+    catch(std::string& exc)
+    {
+        std::cerr << "error: " << exc << std::endl;
+        return -1;
+    }
+    catch(const char* message)
+    {
+        std::cerr << "error: " << message << std::endl;
+        return -1;
+    }
+    catch(std::exception& exc)
+    {
+        std::cerr << "error: " << exc.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cerr << "error !!!" << std::endl;
+    }
+    return -1;
+}
@@ -16,14 +16,24 @@
 #include <Yatools.hpp>
 #include <FlatBufferVisitor.hpp>
 
+#include <cstring>
+
 using namespace std;
 
 int main(int argc, char** argv)
 {
     globals::InitFileLogger(*globals::Get().logger, stdout);
 
+    // --canonical: sort objects, equal inputs give byte-identical outputs
+    int first = 1;
+    const auto canonical = argc > 1 && !strcmp(argv[1], "--canonical");
+    if(canonical)
+        ++first;
+    if(argc <= first)
+        return 1;
+
     std::vector<std::string> files;
-    for(int i = 2; i < argc; i++)
+    for(int i = first + 1; i < argc; i++)
         files.push_back(argv[i]);
-    return !merge_xmls_to_yadb(argv[1], files);
+    return !merge_xmls_to_yadb(argv[first], files, canonical);
 }
@@ -0,0 +1,114 @@
+//  Copyright (C) 2017 The YaCo Authors
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <FileUtils.hpp>
+#include <FlatBufferModel.hpp>
+#include <FlatBufferVisitor.hpp>
+#include <IModel.hpp>
+#include <Yatools.hpp>
+
+#include <farmhash.h>
+
+#include <cstring>
+#include <iostream>
+
+// rewrites a yadb database in canonical order, see canonical::accept
+// & prints a fingerprint usable as a cache key for the whole database
+
+void usage(char* name)
+{
+    std::cerr << "Usage: " << std::endl;
+    std::cerr << name << " [--check] INPUT_FILE [OUTPUT_FILE]" << std::endl;
+    std::cerr << "\t--check:\t\tfail if INPUT_FILE is not canonical" << std::endl;
+    std::cerr << "\tINPUT_FILE:\t\tinput yadb file" << std::endl;
+    std::cerr << "\tOUTPUT_FILE:\t\toptional canonical yadb file" << std::endl;
+}
+
+bool write_file(const std::string& filename, const ExportedBuffer& buf)
+{
+    FILE* fh = fopen(filename.data(), "wb");
+    if(!fh)
+        return false;
+    const auto size = fwrite(buf.value, buf.size, 1, fh);
+    const auto err = fclose(fh);
+    return size == 1 && !err;
+}
+
+int main_func(bool check, const std::string& input, const std::string& output)
+{
+    const auto mmap = MmapFile(input.data());
+    const auto model = MakeFlatBufferModel(mmap);
+    const auto exporter = ExportCanonicalFlatBuffer(*model);
+    const auto buf = exporter->GetBuffer();
+    const auto fingerprint = util::Fingerprint64(static_cast<const char*>(buf.value), buf.size);
+    std::cout << input << ": " << model->size() << " objects, fingerprint " << std::hex << fingerprint << std::endl;
+
+    if(!output.empty() && !write_file(output, buf))
+    {
+        std::cerr << "error: unable to write " << output << std::endl;
+        return -1;
+    }
+
+    if(!check)
+        return 0;
+
+    const auto canonical = mmap->GetSize() == buf.size && !memcmp(mmap->Get(), buf.value, buf.size);
+    if(!canonical)
+    {
+        std::cerr << "error: " << input << " is not canonical" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    globals::InitFileLogger(*globals::Get().logger, stdout);
+    std::vector<std::string> args;
+    bool check = false;
+    for(int i = 1; i < argc; ++i)
+        if(!strcmp(argv[i], "--check"))
+            check = true;
+        else
+            args.push_back(argv[i]);
+    if(args.empty() || args.size() > 2)
+    {
+        usage(argv[0]);
+        return -1;
+    }
+    try
+    {
+        return main_func(check, args[0], args.size() > 1 ? args[1] : std::string());
+    }
+    catch(std::string& exc)
+    {
+        std::cerr << "error: " << exc << std::endl;
+        return -1;
+    }
+    catch(const char* message)
+    {
+        std::cerr << "error: " << message << std::endl;
+        return -1;
+    }
+    catch(std::exception& exc)
+    {
+        std::cerr << "error: " << exc.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cerr << "error !!!" << std::endl;
+    }
+    return -1;
+}
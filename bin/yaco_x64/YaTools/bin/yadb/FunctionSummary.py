@@ -0,0 +1,35 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+import flatbuffers
+
+class FunctionSummary(object):
+    __slots__ = ['_tab']
+
+    # FunctionSummary
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # FunctionSummary
+    def Size(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(0))
+    # FunctionSummary
+    def FrameSize(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(8))
+    # FunctionSummary
+    def BasicBlocks(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(16))
+    # FunctionSummary
+    def Edges(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(20))
+    # FunctionSummary
+    def Callees(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(24))
+    # FunctionSummary
+    def Callers(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(28))
+
+def CreateFunctionSummary(builder, size, frameSize, basicBlocks, edges, callees, callers):
+    builder.Prep(8, 32)
+    builder.PrependUint32(callers)
+    builder.PrependUint32(callees)
+    builder.PrependUint32(edges)
+    builder.PrependUint32(basicBlocks)
+    builder.PrependUint64(frameSize)
+    builder.PrependUint64(size)
+    return builder.Offset()
@@ -0,0 +1,29 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+import flatbuffers
+
+class RegisterView(object):
+    __slots__ = ['_tab']
+
+    # RegisterView
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # RegisterView
+    def Offset(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(0))
+    # RegisterView
+    def EndOffset(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(8))
+    # RegisterView
+    def RegisterName(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(16))
+    # RegisterView
+    def RegisterNewName(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(20))
+
+def CreateRegisterView(builder, offset, endOffset, registerName, registerNewName):
+    builder.Prep(8, 24)
+    builder.PrependUint32(registerNewName)
+    builder.PrependUint32(registerName)
+    builder.PrependUint64(endOffset)
+    builder.PrependUint64(offset)
+    return builder.Offset()
@@ -0,0 +1,27 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+import flatbuffers
+
+class Signature(object):
+    __slots__ = ['_tab']
+
+    # Signature
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # Signature
+    def Value(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(0))
+    # Signature
+    def Type(self): return self._tab.Get(flatbuffers.number_types.Int8Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(4))
+    # Signature
+    def Method(self): return self._tab.Get(flatbuffers.number_types.Int8Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(5))
+
+def CreateSignature(builder, value, type, method):
+    builder.Prep(4, 8)
+    builder.Pad(2)
+    builder.PrependInt8(method)
+    builder.PrependInt8(type)
+    builder.PrependUint32(value)
+    return builder.Offset()
@@ -0,0 +1,276 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+import flatbuffers
+
+class Version(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAsVersion(cls, buf, offset):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = Version()
+        x.Init(buf, n + offset)
+        return x
+
+    # Version
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # Version
+    def ObjectId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def ParentId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Address(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(8))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Flags(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(10))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint32Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Prototype(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(12))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint32Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Size(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(14))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint32Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Username(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(16))
+        if o != 0:
+            x = o + self._tab.Pos
+            from .UserName import UserName
+            obj = UserName()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def HeaderCommentRepeatable(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(18))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint32Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def HeaderCommentNonrepeatable(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(20))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint32Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def StringType(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(22))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint8Flags, o + self._tab.Pos)
+        return 0
+
+    # Version
+    def Attributes(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(24))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 8
+            from .Attribute import Attribute
+            obj = Attribute()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def AttributesLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(24))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Blobs(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(26))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 4
+            x = self._tab.Indirect(x)
+            from .Blob import Blob
+            obj = Blob()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def BlobsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(26))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Comments(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(28))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 16
+            from .Comment import Comment
+            obj = Comment()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def CommentsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(28))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Valueviews(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(30))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 16
+            from .ValueView import ValueView
+            obj = ValueView()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def ValueviewsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(30))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Registerviews(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(32))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 24
+            from .RegisterView import RegisterView
+            obj = RegisterView()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def RegisterviewsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(32))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Hiddenareas(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(34))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 24
+            from .HiddenArea import HiddenArea
+            obj = HiddenArea()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def HiddenareasLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(34))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Xrefs(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(36))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 4
+            x = self._tab.Indirect(x)
+            from .Xref import Xref
+            obj = Xref()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def XrefsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(36))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # Version
+    def Signatures(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(38))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 8
+            from .Signature import Signature
+            obj = Signature()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # Version
+    def SignaturesLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(38))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+def VersionStart(builder): builder.StartObject(18)
+def VersionAddObjectId(builder, objectId): builder.PrependUint64Slot(0, objectId, 0)
+def VersionAddParentId(builder, parentId): builder.PrependUint64Slot(1, parentId, 0)
+def VersionAddAddress(builder, address): builder.PrependUint64Slot(2, address, 0)
+def VersionAddFlags(builder, flags): builder.PrependUint32Slot(3, flags, 0)
+def VersionAddPrototype(builder, prototype): builder.PrependUint32Slot(4, prototype, 0)
+def VersionAddSize(builder, size): builder.PrependUint32Slot(5, size, 0)
+def VersionAddUsername(builder, username): builder.PrependStructSlot(6, flatbuffers.number_types.UOffsetTFlags.py_type(username), 0)
+def VersionAddHeaderCommentRepeatable(builder, headerCommentRepeatable): builder.PrependUint32Slot(7, headerCommentRepeatable, 0)
+def VersionAddHeaderCommentNonrepeatable(builder, headerCommentNonrepeatable): builder.PrependUint32Slot(8, headerCommentNonrepeatable, 0)
+def VersionAddStringType(builder, stringType): builder.PrependUint8Slot(9, stringType, 0)
+def VersionAddAttributes(builder, attributes): builder.PrependUOffsetTRelativeSlot(10, flatbuffers.number_types.UOffsetTFlags.py_type(attributes), 0)
+def VersionStartAttributesVector(builder, numElems): return builder.StartVector(8, numElems, 4)
+def VersionAddBlobs(builder, blobs): builder.PrependUOffsetTRelativeSlot(11, flatbuffers.number_types.UOffsetTFlags.py_type(blobs), 0)
+def VersionStartBlobsVector(builder, numElems): return builder.StartVector(4, numElems, 4)
+def VersionAddComments(builder, comments): builder.PrependUOffsetTRelativeSlot(12, flatbuffers.number_types.UOffsetTFlags.py_type(comments), 0)
+def VersionStartCommentsVector(builder, numElems): return builder.StartVector(16, numElems, 8)
+def VersionAddValueviews(builder, valueviews): builder.PrependUOffsetTRelativeSlot(13, flatbuffers.number_types.UOffsetTFlags.py_type(valueviews), 0)
+def VersionStartValueviewsVector(builder, numElems): return builder.StartVector(16, numElems, 8)
+def VersionAddRegisterviews(builder, registerviews): builder.PrependUOffsetTRelativeSlot(14, flatbuffers.number_types.UOffsetTFlags.py_type(registerviews), 0)
+def VersionStartRegisterviewsVector(builder, numElems): return builder.StartVector(24, numElems, 8)
+def VersionAddHiddenareas(builder, hiddenareas): builder.PrependUOffsetTRelativeSlot(15, flatbuffers.number_types.UOffsetTFlags.py_type(hiddenareas), 0)
+def VersionStartHiddenareasVector(builder, numElems): return builder.StartVector(24, numElems, 8)
+def VersionAddXrefs(builder, xrefs): builder.PrependUOffsetTRelativeSlot(16, flatbuffers.number_types.UOffsetTFlags.py_type(xrefs), 0)
+def VersionStartXrefsVector(builder, numElems): return builder.StartVector(4, numElems, 4)
+def VersionAddSignatures(builder, signatures): builder.PrependUOffsetTRelativeSlot(17, flatbuffers.number_types.UOffsetTFlags.py_type(signatures), 0)
+def VersionStartSignaturesVector(builder, numElems): return builder.StartVector(8, numElems, 4)
+def VersionEnd(builder): return builder.EndObject()
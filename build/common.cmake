@@ -484,6 +484,40 @@ function(add_target target group)
     make_target(${target} ${group} ${files} OPTIONS ${options})
 endfunction()
 
+# patch_sources <target> <root> <patches...>
+# build patched copies of target sources instead of the originals
+# patches are applied with git apply relatively to root, see deps/patches
+# originals stay untouched & listed in target files, but are not compiled
+function(patch_sources target root)
+    find_package(Git REQUIRED)
+    set(dst "${CMAKE_CURRENT_BINARY_DIR}/${target}_patched")
+    file(REMOVE_RECURSE "${dst}")
+    set(patched)
+    foreach(patch ${ARGN})
+        set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${patch}")
+        file(STRINGS "${patch}" paths REGEX "^[+][+][+] b/")
+        foreach(it ${paths})
+            string(REGEX REPLACE "^[+][+][+] b/" "" it "${it}")
+            if(NOT EXISTS "${dst}/${it}")
+                configure_file("${root}/${it}" "${dst}/${it}" COPYONLY)
+                set_source_files_properties("${root}/${it}" PROPERTIES HEADER_FILE_ONLY true)
+                list(APPEND patched "${dst}/${it}")
+            endif()
+        endforeach()
+        # stop git from looking for a parent repository
+        execute_process(COMMAND
+            ${CMAKE_COMMAND} -E env "GIT_CEILING_DIRECTORIES=${CMAKE_CURRENT_BINARY_DIR}"
+            ${GIT_EXECUTABLE} apply --whitespace=nowarn "${patch}"
+            WORKING_DIRECTORY "${dst}"
+            RESULT_VARIABLE retcode)
+        if(NOT "${retcode}" STREQUAL "0")
+            message(FATAL_ERROR "unable to apply ${patch} on ${root}")
+        endif()
+    endforeach()
+    target_sources(${target} PRIVATE ${patched})
+    source_group(patched FILES ${patched})
+endfunction()
+
 function(split_swig_files itarget deps)
     set(itarget_)
     set(deps_)
@@ -0,0 +1,4 @@
+# generated with cmake
+set(_yacachegc_files
+    "../YaToolsUtils/YaToolsCacheGc/CacheGc.cpp"
+)
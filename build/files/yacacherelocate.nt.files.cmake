@@ -0,0 +1,4 @@
+# generated with cmake
+set(_yacacherelocate_files
+    "../YaToolsUtils/YaToolsCacheRelocate/CacheRelocate.cpp"
+)
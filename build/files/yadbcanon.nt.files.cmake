@@ -0,0 +1,4 @@
+# generated with cmake
+set(_yadbcanon_files
+    "../YaToolsUtils/YaToolsYaDBCanon/YaDBCanon.cpp"
+)
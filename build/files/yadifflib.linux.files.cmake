@@ -8,6 +8,10 @@ set(_yadifflib_files
     "../YaDiff/YaDiffLib/Algo/ExactMatch.hpp"
     "../YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp"
     "../YaDiff/YaDiffLib/Algo/ExternalMappingMatch.hpp"
+    "../YaDiff/YaDiffLib/Algo/NameMatch.cpp"
+    "../YaDiff/YaDiffLib/Algo/NameMatch.hpp"
+    "../YaDiff/YaDiffLib/Algo/TypeMatch.cpp"
+    "../YaDiff/YaDiffLib/Algo/TypeMatch.hpp"
     "../YaDiff/YaDiffLib/Algo/VectorSign.cpp"
     "../YaDiff/YaDiffLib/Algo/VectorSign.hpp"
     "../YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp"
@@ -31,8 +35,12 @@ set(_yadifflib_files
     "../YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp"
     "../YaDiff/YaDiffLib/Algo/XRefOffsetMatch.hpp"
     "../YaDiff/YaDiffLib/Algo/json.hpp"
+    "../YaDiff/YaDiffLib/FunctionDiff.cpp"
+    "../YaDiff/YaDiffLib/FunctionDiff.hpp"
     "../YaDiff/YaDiffLib/Matching.cpp"
     "../YaDiff/YaDiffLib/Matching.hpp"
+    "../YaDiff/YaDiffLib/MemoryBudget.cpp"
+    "../YaDiff/YaDiffLib/MemoryBudget.hpp"
     "../YaDiff/YaDiffLib/Propagate.cpp"
     "../YaDiff/YaDiffLib/Propagate.hpp"
     "../YaDiff/YaDiffLib/VersionRelation.cpp"
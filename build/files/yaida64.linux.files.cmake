@@ -2,8 +2,6 @@
 set(_yaida64_files
     "../YaLibs/YaToolsIDALib/Events.cpp"
     "../YaLibs/YaToolsIDALib/Events.hpp"
-    "../YaLibs/YaToolsIDALib/Hash.cpp"
-    "../YaLibs/YaToolsIDALib/Hash.hpp"
     "../YaLibs/YaToolsIDALib/Hooks.cpp"
     "../YaLibs/YaToolsIDALib/Hooks.hpp"
     "../YaLibs/YaToolsIDALib/Ida.h"
@@ -3,14 +3,22 @@ set(_yatools_files
     "../YaLibs/YaToolsLib/Bench.h"
     "../YaLibs/YaToolsLib/BinHex.cpp"
     "../YaLibs/YaToolsLib/BinHex.hpp"
+    "../YaLibs/YaToolsLib/CacheDelta.cpp"
+    "../YaLibs/YaToolsLib/CacheDelta.hpp"
+    "../YaLibs/YaToolsLib/Canonical.cpp"
+    "../YaLibs/YaToolsLib/Canonical.hpp"
     "../YaLibs/YaToolsLib/Configuration.cpp"
     "../YaLibs/YaToolsLib/Configuration.hpp"
     "../YaLibs/YaToolsLib/FileUtils.cpp"
     "../YaLibs/YaToolsLib/FileUtils.hpp"
+    "../YaLibs/YaToolsLib/FileWriter.cpp"
+    "../YaLibs/YaToolsLib/FileWriter.hpp"
     "../YaLibs/YaToolsLib/FlatBufferModel.cpp"
     "../YaLibs/YaToolsLib/FlatBufferModel.hpp"
     "../YaLibs/YaToolsLib/FlatBufferVisitor.cpp"
     "../YaLibs/YaToolsLib/FlatBufferVisitor.hpp"
+    "../YaLibs/YaToolsLib/Gc.cpp"
+    "../YaLibs/YaToolsLib/Gc.hpp"
     "../YaLibs/YaToolsLib/Git.cpp"
     "../YaLibs/YaToolsLib/Git.hpp"
     "../YaLibs/YaToolsLib/GitAsync.cpp"
@@ -18,6 +26,8 @@ set(_yatools_files
     "../YaLibs/YaToolsLib/HSignature.hpp"
     "../YaLibs/YaToolsLib/HVersion.cpp"
     "../YaLibs/YaToolsLib/HVersion.hpp"
+    "../YaLibs/YaToolsLib/Hash.cpp"
+    "../YaLibs/YaToolsLib/Hash.hpp"
     "../YaLibs/YaToolsLib/Helpers.h"
     "../YaLibs/YaToolsLib/IModel.hpp"
     "../YaLibs/YaToolsLib/IModelSink.hpp"
@@ -30,13 +40,23 @@ set(_yatools_files
     "../YaLibs/YaToolsLib/Merger.cpp"
     "../YaLibs/YaToolsLib/Merger.hpp"
     "../YaLibs/YaToolsLib/ModelIndex.hpp"
+    "../YaLibs/YaToolsLib/Parallel.cpp"
+    "../YaLibs/YaToolsLib/Parallel.hpp"
     "../YaLibs/YaToolsLib/Random.cpp"
     "../YaLibs/YaToolsLib/Random.hpp"
     "../YaLibs/YaToolsLib/Relation.hpp"
+    "../YaLibs/YaToolsLib/RelativeIds.cpp"
+    "../YaLibs/YaToolsLib/RelativeIds.hpp"
+    "../YaLibs/YaToolsLib/SavePipeline.cpp"
+    "../YaLibs/YaToolsLib/SavePipeline.hpp"
     "../YaLibs/YaToolsLib/Signature.cpp"
     "../YaLibs/YaToolsLib/Signature.hpp"
     "../YaLibs/YaToolsLib/Utils.cpp"
     "../YaLibs/YaToolsLib/Utils.hpp"
+    "../YaLibs/YaToolsLib/VersionRecord.cpp"
+    "../YaLibs/YaToolsLib/VersionRecord.hpp"
+    "../YaLibs/YaToolsLib/VisitorCombinators.cpp"
+    "../YaLibs/YaToolsLib/VisitorCombinators.hpp"
     "../YaLibs/YaToolsLib/XmlAccept.cpp"
     "../YaLibs/YaToolsLib/XmlAccept.hpp"
     "../YaLibs/YaToolsLib/XmlVisitor.cpp"
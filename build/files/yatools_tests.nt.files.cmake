@@ -6,7 +6,12 @@ set(_yatools_tests_files
     "../YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp"
     "../YaLibs/tests/YaToolsLib_test/test_common.hpp"
     "../YaLibs/tests/YaToolsLib_test/test_configuration.cpp"
+    "../YaLibs/tests/YaToolsLib_test/test_file_writer.cpp"
+    "../YaLibs/tests/YaToolsLib_test/test_gc.cpp"
     "../YaLibs/tests/YaToolsLib_test/test_git.cpp"
     "../YaLibs/tests/YaToolsLib_test/test_model.hpp"
+    "../YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp"
+    "../YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp"
+    "../YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp"
     "../YaLibs/tests/YaToolsLib_test/test_yatools.cpp"
 )
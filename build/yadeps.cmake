@@ -110,6 +110,17 @@ endif()
 # libxml2
 get_files(files ${xml_dir})
 get_files(includes ${xml_dir}/include OPTIONS recurse)
+# cache deltas are parsed on worker threads, config.h.in pthread
+# comments are not detected by autoconfigure
+set(xml_threads)
+if(NOT WIN32)
+    set(xml_threads
+        "\n#undef  HAVE_PTHREAD_H"
+        "\n#define HAVE_PTHREAD_H 1"
+        "\n#undef  HAVE_LIBPTHREAD"
+        "\n#define HAVE_LIBPTHREAD 1"
+    )
+endif()
 autoconfigure(files includes libxml2 "${xml_dir}/config.h.in"
     "\n#define ICONV_CONST const"
     "\n#define HAVE_VA_COPY 1"
@@ -117,6 +128,7 @@ autoconfigure(files includes libxml2 "${xml_dir}/config.h.in"
     "\n#if defined(WIN32) && defined(NEED_SOCKETS)"
     "\n#include <wsockcompat.h>"
     "\n#endif"
+    ${xml_threads}
 )
 filter_out(files
     "runsuite[.]c$"
@@ -144,6 +156,11 @@ if(WIN32)
         PRIVATE
         _CRT_SECURE_NO_WARNINGS
     )
+else()
+    # LIBXML_THREAD_ENABLED must match in libxml2 & its users
+    find_package(Threads)
+    target_compile_definitions(libxml2 PUBLIC _REENTRANT)
+    target_link_libraries(libxml2 PUBLIC Threads::Threads)
 endif()
 
 # regex
@@ -267,6 +284,7 @@ target_compile_definitions(git2 PRIVATE
     LIBGIT2_NO_FEATURES_H
 )
 setup_git2_mtime(git2)
+patch_sources(git2 "${git_dir}" "${ya_dir}/deps/patches/libgit2-0.27.2-skip-worktree.patch")
 target_link_libraries(git2 PUBLIC
     http_parser
     iconv
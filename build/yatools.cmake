@@ -103,6 +103,8 @@ add_target(yatools_tests yatools/tests "${ya_dir}/YaLibs/tests/YaToolsLib_test"
 setup_yatools(yatools_tests)
 target_include_directories(yatools_tests PRIVATE
     "${ya_dir}/YaLibs/tests"
+    # generated yadb headers
+    "${CMAKE_CURRENT_BINARY_DIR}"
 )
 target_link_libraries(yatools_tests PRIVATE
     gtest
@@ -149,6 +151,15 @@ add_tool(yafb2xml YaToolsUtils/YaToolsFBToXML)
 # yacachemerger
 add_tool(yacachemerger YaToolsUtils/YaToolsCacheMerger)
 
+# yacachegc
+add_tool(yacachegc YaToolsUtils/YaToolsCacheGc)
+
+# yacacherelocate
+add_tool(yacacherelocate YaToolsUtils/YaToolsCacheRelocate)
+
+# yadbcanon
+add_tool(yadbcanon YaToolsUtils/YaToolsYaDBCanon)
+
 # yadbtovector
 add_tool(yadbtovector YaToolsUtils/YaToolsYaDBToVectors yadifflib)
 
@@ -0,0 +1,219 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/build/CMakeLists.txt"
+  "/root/repo/build/capstone.cmake"
+  "/root/repo/build/common.cmake"
+  "/root/repo/build/files/capstone.linux.files.cmake"
+  "/root/repo/build/files/charset.linux.files.cmake"
+  "/root/repo/build/files/farmhash.linux.files.cmake"
+  "/root/repo/build/files/flatbuffers.linux.files.cmake"
+  "/root/repo/build/files/flatc.linux.files.cmake"
+  "/root/repo/build/files/git2.linux.files.cmake"
+  "/root/repo/build/files/gtest.linux.files.cmake"
+  "/root/repo/build/files/http_parser.linux.files.cmake"
+  "/root/repo/build/files/iconv.linux.files.cmake"
+  "/root/repo/build/files/integration_tests.linux.files.cmake"
+  "/root/repo/build/files/libxml2.linux.files.cmake"
+  "/root/repo/build/files/mbedtls.linux.files.cmake"
+  "/root/repo/build/files/regex.linux.files.cmake"
+  "/root/repo/build/files/ssh2.linux.files.cmake"
+  "/root/repo/build/files/swig.linux.files.cmake"
+  "/root/repo/build/files/yacachegc.linux.files.cmake"
+  "/root/repo/build/files/yacachemerger.linux.files.cmake"
+  "/root/repo/build/files/yacacherelocate.linux.files.cmake"
+  "/root/repo/build/files/yadbcanon.linux.files.cmake"
+  "/root/repo/build/files/yadbtovector.linux.files.cmake"
+  "/root/repo/build/files/yadiff.linux.files.cmake"
+  "/root/repo/build/files/yadifflib.linux.files.cmake"
+  "/root/repo/build/files/yadifflib_tests.linux.files.cmake"
+  "/root/repo/build/files/yafb2xml.linux.files.cmake"
+  "/root/repo/build/files/yaida32.linux.files.cmake"
+  "/root/repo/build/files/yaida64.linux.files.cmake"
+  "/root/repo/build/files/yatools.linux.files.cmake"
+  "/root/repo/build/files/yatools_tests.linux.files.cmake"
+  "/root/repo/build/files/yaxml2fb.linux.files.cmake"
+  "/root/repo/build/files/zlib.linux.files.cmake"
+  "/root/repo/build/flatbuffer.cmake"
+  "/root/repo/build/yadeps.cmake"
+  "/root/repo/build/yatools.cmake"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_generate.c"
+  "/root/repo/deps/libiconv-1.14/include/iconv.h.in"
+  "/root/repo/deps/libiconv-1.14/libcharset/include/localcharset.h.in"
+  "/root/repo/deps/libiconv-1.14/srclib/alloca.in.h"
+  "/root/repo/deps/libssh2-1.8.0/cmake/CheckNonblockingSocketSupport.cmake"
+  "/root/repo/deps/patches/libgit2-0.27.2-skip-worktree.patch"
+  "/root/repo/deps/swig-3.0.7/Source/Include/swigwarn.h"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "capstone.dir/build.list"
+  "charset.dir/build.list"
+  "farmhash.dir/build.list"
+  "flatbuffers.dir/build.list"
+  "flatc.dir/build.list"
+  "git2.dir/build.list"
+  "gtest.dir/build.list"
+  "http_parser.dir/build.list"
+  "iconv.dir/build.list"
+  "iconv_/config.h.in"
+  "integration_tests.dir/build.list"
+  "libcharset_/config.h.in"
+  "libxml2.dir/build.list"
+  "libxml2_/config.h.in"
+  "mbedtls.dir/build.list"
+  "regex.dir/build.list"
+  "ssh2.dir/build.list"
+  "ssh2_/libssh2_config.h.in"
+  "swig.dir/build.list"
+  "swig_/swigconfig.h.in"
+  "yacachegc.dir/build.list"
+  "yacachemerger.dir/build.list"
+  "yacacherelocate.dir/build.list"
+  "yadbcanon.dir/build.list"
+  "yadbtovector.dir/build.list"
+  "yadiff.dir/build.list"
+  "yadifflib.dir/build.list"
+  "yadifflib_tests.dir/build.list"
+  "yafb2xml.dir/build.list"
+  "yaida32.dir/build.list"
+  "yaida64.dir/build.list"
+  "yatools.dir/build.list"
+  "yatools_tests.dir/build.list"
+  "yaxml2fb.dir/build.list"
+  "zlib.dir/build.list"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindFrameworks.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckVariableExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonLibs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/UseSWIG.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "libcharset_/config.h"
+  "libcharset_/include/localcharset.h"
+  "/root/repo/build/files/charset.linux.files.cmake"
+  "iconv_/config.h"
+  "iconv_/config.h"
+  "iconv_/include/iconv.h"
+  "iconv_/alloca.h"
+  "/root/repo/build/files/iconv.linux.files.cmake"
+  "libxml2_/config.h"
+  "/root/repo/build/files/libxml2.linux.files.cmake"
+  "/root/repo/build/files/regex.linux.files.cmake"
+  "/root/repo/build/files/zlib.linux.files.cmake"
+  "/root/repo/build/files/http_parser.linux.files.cmake"
+  "/root/repo/build/files/mbedtls.linux.files.cmake"
+  "ssh2_/libssh2_config.h"
+  "/root/repo/build/files/ssh2.linux.files.cmake"
+  "/root/repo/build/files/git2.linux.files.cmake"
+  "git2_patched/src/diff_generate.c"
+  "/root/repo/build/files/flatc.linux.files.cmake"
+  "/root/repo/build/files/flatbuffers.linux.files.cmake"
+  "/root/repo/build/files/gtest.linux.files.cmake"
+  "swig_/swigwarn.h"
+  "swig_/swigconfig.h"
+  "/root/repo/build/files/swig.linux.files.cmake"
+  "/root/repo/build/files/farmhash.linux.files.cmake"
+  "/root/repo/build/files/capstone.linux.files.cmake"
+  "/root/repo/build/files/yatools.linux.files.cmake"
+  "/root/repo/build/files/yatools_tests.linux.files.cmake"
+  "/root/repo/build/files/yadifflib.linux.files.cmake"
+  "/root/repo/build/files/yadifflib_tests.linux.files.cmake"
+  "/root/repo/build/files/yadiff.linux.files.cmake"
+  "/root/repo/build/files/yaxml2fb.linux.files.cmake"
+  "/root/repo/build/files/yafb2xml.linux.files.cmake"
+  "/root/repo/build/files/yacachemerger.linux.files.cmake"
+  "/root/repo/build/files/yacachegc.linux.files.cmake"
+  "/root/repo/build/files/yacacherelocate.linux.files.cmake"
+  "/root/repo/build/files/yadbcanon.linux.files.cmake"
+  "/root/repo/build/files/yadbtovector.linux.files.cmake"
+  "/root/repo/build/files/yaida32.linux.files.cmake"
+  "/root/repo/build/files/yaida64.linux.files.cmake"
+  "/root/repo/build/files/integration_tests.linux.files.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/charset.dir/DependInfo.cmake"
+  "CMakeFiles/iconv.dir/DependInfo.cmake"
+  "CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "CMakeFiles/regex.dir/DependInfo.cmake"
+  "CMakeFiles/zlib.dir/DependInfo.cmake"
+  "CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "CMakeFiles/git2.dir/DependInfo.cmake"
+  "CMakeFiles/flatc.dir/DependInfo.cmake"
+  "CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "CMakeFiles/gtest.dir/DependInfo.cmake"
+  "CMakeFiles/swig.dir/DependInfo.cmake"
+  "CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "CMakeFiles/capstone.dir/DependInfo.cmake"
+  "CMakeFiles/yatools.dir/DependInfo.cmake"
+  "CMakeFiles/yatools_tests.dir/DependInfo.cmake"
+  "CMakeFiles/yadifflib.dir/DependInfo.cmake"
+  "CMakeFiles/yadifflib_tests.dir/DependInfo.cmake"
+  "CMakeFiles/yadiff.dir/DependInfo.cmake"
+  "CMakeFiles/yaxml2fb.dir/DependInfo.cmake"
+  "CMakeFiles/yafb2xml.dir/DependInfo.cmake"
+  "CMakeFiles/yacachemerger.dir/DependInfo.cmake"
+  "CMakeFiles/yacachegc.dir/DependInfo.cmake"
+  "CMakeFiles/yacacherelocate.dir/DependInfo.cmake"
+  "CMakeFiles/yadbcanon.dir/DependInfo.cmake"
+  "CMakeFiles/yadbtovector.dir/DependInfo.cmake"
+  "CMakeFiles/yaida32.dir/DependInfo.cmake"
+  "CMakeFiles/_yatools_py32.dir/DependInfo.cmake"
+  "CMakeFiles/yatools_py32_swig_compilation.dir/DependInfo.cmake"
+  "CMakeFiles/yaida64.dir/DependInfo.cmake"
+  "CMakeFiles/_yatools_py64.dir/DependInfo.cmake"
+  "CMakeFiles/yatools_py64_swig_compilation.dir/DependInfo.cmake"
+  "CMakeFiles/integration_tests.dir/DependInfo.cmake"
+  "CMakeFiles/bundle.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON_wrap.cxx" "CMakeFiles/_yatools_py32.dir/CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON_wrap.cxx.o" "gcc" "CMakeFiles/_yatools_py32.dir/CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON_wrap.cxx.o.d"
+  "/root/repo/YaLibs/YaToolsPy/YaSwig.cpp" "CMakeFiles/_yatools_py32.dir/root/repo/YaLibs/YaToolsPy/YaSwig.cpp.o" "gcc" "CMakeFiles/_yatools_py32.dir/root/repo/YaLibs/YaToolsPy/YaSwig.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yadifflib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yaida32.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/capstone.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yatools.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/_YaToolsPy64.pdb"
+  "/root/repo/bin/yaco_x64/YaTools/bin/_YaToolsPy64.so"
+  "CMakeFiles/_yatools_py64.dir/CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON_wrap.cxx.o"
+  "CMakeFiles/_yatools_py64.dir/CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON_wrap.cxx.o.d"
+  "CMakeFiles/_yatools_py64.dir/root/repo/YaLibs/YaToolsPy/YaSwig.cpp.o"
+  "CMakeFiles/_yatools_py64.dir/root/repo/YaLibs/YaToolsPy/YaSwig.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/_yatools_py64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,63 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/capstone-3.0.4/MCInst.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInst.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInst.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/MCInstrDesc.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInstrDesc.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInstrDesc.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/MCRegisterInfo.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCRegisterInfo.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCRegisterInfo.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/SStream.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/SStream.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/SStream.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64BaseInfo.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64BaseInfo.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64BaseInfo.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Disassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Disassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Disassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64InstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64InstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64InstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Mapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Mapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Mapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Module.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Module.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Module.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/ARM/ARMDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/ARM/ARMInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/ARM/ARMMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/ARM/ARMModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/M68K/M68KDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/M68K/M68KInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/M68K/M68KModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Mips/MipsDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Mips/MipsInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Mips/MipsMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Mips/MipsModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMCTargetDesc.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMCTargetDesc.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMCTargetDesc.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86ATTInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86ATTInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86ATTInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86Disassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Disassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Disassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86DisassemblerDecoder.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86DisassemblerDecoder.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86DisassemblerDecoder.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86IntelInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86IntelInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86IntelInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86Mapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Mapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Mapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/X86/X86Module.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Module.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Module.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreDisassembler.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreDisassembler.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreDisassembler.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreInstPrinter.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreInstPrinter.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreInstPrinter.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreMapping.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreMapping.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreMapping.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreModule.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreModule.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreModule.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/cs.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/cs.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/cs.c.o.d"
+  "/root/repo/deps/capstone-3.0.4/utils.c" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/utils.c.o" "gcc" "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
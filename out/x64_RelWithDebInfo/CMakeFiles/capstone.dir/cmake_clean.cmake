@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInst.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInst.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInstrDesc.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCInstrDesc.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCRegisterInfo.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/MCRegisterInfo.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/SStream.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/SStream.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64BaseInfo.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64BaseInfo.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Disassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Disassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64InstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64InstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Mapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Mapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Module.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/AArch64/AArch64Module.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/ARM/ARMModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/M68K/M68KModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Mips/MipsModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/PowerPC/PPCModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/Sparc/SparcModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMCTargetDesc.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMCTargetDesc.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/SystemZ/SystemZModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86ATTInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86ATTInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Disassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Disassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86DisassemblerDecoder.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86DisassemblerDecoder.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86IntelInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86IntelInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Mapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Mapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Module.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/X86/X86Module.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreDisassembler.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreDisassembler.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreInstPrinter.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreInstPrinter.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreMapping.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreMapping.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreModule.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/arch/XCore/XCoreModule.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/cs.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/cs.c.o.d"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/utils.c.o"
+  "CMakeFiles/capstone.dir/root/repo/deps/capstone-3.0.4/utils.c.o.d"
+  "libcapstone.a"
+  "libcapstone.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/capstone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
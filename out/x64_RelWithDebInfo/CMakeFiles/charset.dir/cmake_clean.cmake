@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/charset.dir/root/repo/deps/libiconv-1.14/libcharset/lib/localcharset.c.o"
+  "CMakeFiles/charset.dir/root/repo/deps/libiconv-1.14/libcharset/lib/localcharset.c.o.d"
+  "CMakeFiles/charset.dir/root/repo/deps/libiconv-1.14/libcharset/lib/relocatable.c.o"
+  "CMakeFiles/charset.dir/root/repo/deps/libiconv-1.14/libcharset/lib/relocatable.c.o.d"
+  "libcharset.a"
+  "libcharset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/charset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
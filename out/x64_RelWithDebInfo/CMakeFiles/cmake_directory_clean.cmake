@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON_wrap.cxx"
+  "YaToolsPy32.py"
+  "CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON.stamp"
+  "CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON_wrap.cxx"
+  "YaToolsPy64.py"
+  "CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON.stamp"
+)
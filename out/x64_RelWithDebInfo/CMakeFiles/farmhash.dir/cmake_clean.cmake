@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/farmhash.dir/root/repo/deps/farmhash-1.1/src/farmhash.cc.o"
+  "CMakeFiles/farmhash.dir/root/repo/deps/farmhash-1.1/src/farmhash.cc.o.d"
+  "libfarmhash.a"
+  "libfarmhash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/farmhash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o" "gcc" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o" "gcc" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o" "gcc" "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
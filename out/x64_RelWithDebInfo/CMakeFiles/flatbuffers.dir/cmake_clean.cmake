@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o"
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o.d"
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o"
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o.d"
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o"
+  "CMakeFiles/flatbuffers.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o.d"
+  "libflatbuffers.a"
+  "libflatbuffers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flatbuffers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
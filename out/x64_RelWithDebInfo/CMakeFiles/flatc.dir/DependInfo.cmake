@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/cpp_generator.cc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/cpp_generator.cc.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/cpp_generator.cc.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/go_generator.cc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/go_generator.cc.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/go_generator.cc.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/code_generators.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/code_generators.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/code_generators.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/flatc.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/flatc_main.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc_main.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc_main.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_cpp.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_cpp.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_cpp.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_fbs.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_fbs.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_fbs.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_general.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_general.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_general.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_go.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_go.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_go.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_grpc.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_grpc.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_grpc.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_js.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_js.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_js.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_json_schema.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_json_schema.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_json_schema.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_php.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_php.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_php.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_python.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_python.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_python.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o.d"
+  "/root/repo/deps/flatbuffers-1.8.0/src/util.cpp" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/util.cpp.o" "gcc" "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/cpp_generator.cc.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/cpp_generator.cc.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/go_generator.cc.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/grpc/src/compiler/go_generator.cc.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/code_generators.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/code_generators.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc_main.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/flatc_main.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_cpp.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_cpp.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_fbs.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_fbs.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_general.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_general.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_go.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_go.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_grpc.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_grpc.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_js.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_js.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_json_schema.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_json_schema.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_php.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_php.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_python.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_python.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_gen_text.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/idl_parser.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/reflection.cpp.o.d"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/util.cpp.o"
+  "CMakeFiles/flatc.dir/root/repo/deps/flatbuffers-1.8.0/src/util.cpp.o.d"
+  "flatc"
+  "flatc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flatc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
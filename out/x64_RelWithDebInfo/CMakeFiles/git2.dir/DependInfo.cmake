@@ -0,0 +1,167 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/out/x64_RelWithDebInfo/git2_patched/src/diff_generate.c" "CMakeFiles/git2.dir/git2_patched/src/diff_generate.c.o" "gcc" "CMakeFiles/git2.dir/git2_patched/src/diff_generate.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/annotated_commit.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/annotated_commit.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/annotated_commit.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/apply.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/apply.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/apply.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/attr.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/attr_file.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr_file.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr_file.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/attrcache.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attrcache.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attrcache.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/blame.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/blame_git.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame_git.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame_git.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/blob.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blob.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blob.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/branch.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/branch.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/branch.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/buf_text.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buf_text.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buf_text.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/buffer.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buffer.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buffer.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/cache.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cache.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cache.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/checkout.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/checkout.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/checkout.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/cherrypick.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cherrypick.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cherrypick.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/clone.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/clone.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/clone.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/commit.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/commit_list.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit_list.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit_list.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/config.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/config_cache.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_cache.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_cache.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/config_file.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_file.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_file.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/config_parse.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_parse.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_parse.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/crlf.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/crlf.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/crlf.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/date.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/date.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/date.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/delta.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/delta.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/delta.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/describe.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/describe.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/describe.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_driver.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_driver.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_driver.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_file.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_file.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_file.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_parse.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_parse.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_parse.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_print.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_print.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_print.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_stats.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_stats.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_stats.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_tform.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_tform.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_tform.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/diff_xdiff.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_xdiff.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_xdiff.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/errors.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/errors.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/errors.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/fetch.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetch.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetch.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/fetchhead.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetchhead.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetchhead.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/filebuf.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filebuf.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filebuf.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/fileops.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fileops.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fileops.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/filter.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filter.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filter.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/fnmatch.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fnmatch.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fnmatch.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/global.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/global.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/global.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/graph.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/graph.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/graph.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/hash.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/hash/hash_generic.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/hash_generic.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/hash_generic.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/sha1.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/sha1.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/sha1.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/ubc_check.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/ubc_check.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/ubc_check.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/hashsig.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hashsig.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hashsig.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/ident.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ident.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ident.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/idxmap.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/idxmap.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/idxmap.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/ignore.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ignore.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ignore.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/index.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/index.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/index.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/indexer.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/indexer.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/indexer.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/iterator.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/iterator.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/iterator.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/merge.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/merge_driver.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_driver.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_driver.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/merge_file.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_file.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_file.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/message.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/message.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/message.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/mwindow.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/mwindow.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/mwindow.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/netops.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/netops.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/netops.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/notes.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/notes.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/notes.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/object.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/object_api.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object_api.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object_api.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/odb.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/odb_loose.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_loose.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_loose.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/odb_mempack.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_mempack.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_mempack.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/odb_pack.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_pack.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_pack.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/offmap.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/offmap.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/offmap.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/oid.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oid.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oid.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/oidarray.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidarray.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidarray.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/oidmap.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidmap.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidmap.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/pack-objects.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack-objects.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack-objects.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/pack.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/parse.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/parse.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/parse.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/patch.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/patch_generate.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_generate.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_generate.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/patch_parse.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_parse.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_parse.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/path.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/path.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/path.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/pathspec.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pathspec.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pathspec.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/pool.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pool.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pool.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/posix.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/posix.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/posix.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/pqueue.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pqueue.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pqueue.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/proxy.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/proxy.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/proxy.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/push.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/push.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/push.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/rebase.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/rebase.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/rebase.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/refdb.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/refdb_fs.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb_fs.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb_fs.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/reflog.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reflog.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reflog.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/refs.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refs.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refs.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/refspec.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refspec.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refspec.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/remote.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/remote.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/remote.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/repository.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/repository.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/repository.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/reset.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reset.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reset.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/revert.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revert.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revert.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/revparse.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revparse.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revparse.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/revwalk.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revwalk.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revwalk.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/settings.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/settings.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/settings.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/sha1_lookup.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sha1_lookup.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sha1_lookup.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/signature.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/signature.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/signature.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/sortedcache.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sortedcache.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sortedcache.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/stash.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/stash.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/stash.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/status.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/status.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/status.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/streams/curl.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/curl.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/curl.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/streams/openssl.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/openssl.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/openssl.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/streams/socket.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/socket.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/socket.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/streams/tls.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/tls.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/tls.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/strmap.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/strmap.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/strmap.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/submodule.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/submodule.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/submodule.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/sysdir.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sysdir.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sysdir.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/tag.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tag.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tag.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/thread-utils.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/thread-utils.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/thread-utils.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/trace.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trace.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trace.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/trailer.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trailer.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trailer.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transaction.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transaction.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transaction.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transport.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transport.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transport.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/auth.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/auth.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/auth.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/cred.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/cred_helpers.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred_helpers.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred_helpers.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/git.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/git.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/git.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/http.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/http.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/http.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/local.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/local.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/local.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/smart.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/smart_pkt.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_pkt.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_pkt.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/smart_protocol.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_protocol.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_protocol.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/transports/ssh.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/ssh.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/ssh.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/tree-cache.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree-cache.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree-cache.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/tree.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/tsort.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tsort.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tsort.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/unix/map.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/map.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/map.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/unix/realpath.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/realpath.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/realpath.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/util.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/util.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/util.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/varint.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/varint.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/varint.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/vector.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/vector.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/vector.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/worktree.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/worktree.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/worktree.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xdiffi.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xdiffi.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xdiffi.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xemit.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xemit.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xemit.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xhistogram.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xhistogram.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xhistogram.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xmerge.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xmerge.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xmerge.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xpatience.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xpatience.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xpatience.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xprepare.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xprepare.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xprepare.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/xdiff/xutils.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xutils.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xutils.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/src/zstream.c" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/zstream.c.o" "gcc" "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/zstream.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,293 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/git2.dir/git2_patched/src/diff_generate.c.o"
+  "CMakeFiles/git2.dir/git2_patched/src/diff_generate.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/annotated_commit.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/annotated_commit.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/apply.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/apply.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr_file.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attr_file.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attrcache.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/attrcache.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame_git.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blame_git.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blob.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/blob.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/branch.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/branch.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buf_text.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buf_text.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buffer.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/buffer.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cache.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cache.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/checkout.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/checkout.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cherrypick.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/cherrypick.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/clone.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/clone.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit_list.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/commit_list.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_cache.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_cache.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_file.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_file.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_parse.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/config_parse.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/crlf.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/crlf.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/date.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/date.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/delta.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/delta.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/describe.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/describe.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_driver.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_driver.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_file.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_file.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_parse.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_parse.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_print.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_print.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_stats.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_stats.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_tform.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_tform.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_xdiff.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/diff_xdiff.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/errors.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/errors.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetch.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetch.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetchhead.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fetchhead.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filebuf.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filebuf.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fileops.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fileops.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filter.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/filter.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fnmatch.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/fnmatch.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/global.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/global.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/graph.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/graph.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/hash_generic.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/hash_generic.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/sha1.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/sha1.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/ubc_check.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hash/sha1dc/ubc_check.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hashsig.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/hashsig.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ident.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ident.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/idxmap.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/idxmap.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ignore.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/ignore.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/index.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/index.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/indexer.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/indexer.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/iterator.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/iterator.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_driver.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_driver.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_file.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/merge_file.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/message.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/message.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/mwindow.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/mwindow.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/netops.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/netops.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/notes.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/notes.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object_api.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/object_api.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_loose.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_loose.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_mempack.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_mempack.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_pack.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/odb_pack.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/offmap.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/offmap.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oid.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oid.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidarray.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidarray.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidmap.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/oidmap.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack-objects.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack-objects.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pack.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/parse.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/parse.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_generate.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_generate.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_parse.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/patch_parse.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/path.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/path.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pathspec.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pathspec.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pool.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pool.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/posix.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/posix.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pqueue.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/pqueue.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/proxy.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/proxy.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/push.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/push.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/rebase.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/rebase.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb_fs.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refdb_fs.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reflog.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reflog.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refs.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refs.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refspec.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/refspec.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/remote.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/remote.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/repository.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/repository.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reset.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/reset.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revert.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revert.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revparse.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revparse.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revwalk.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/revwalk.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/settings.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/settings.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sha1_lookup.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sha1_lookup.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/signature.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/signature.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sortedcache.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sortedcache.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/stash.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/stash.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/status.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/status.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/curl.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/curl.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/openssl.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/openssl.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/socket.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/socket.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/tls.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/streams/tls.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/strmap.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/strmap.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/submodule.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/submodule.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sysdir.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/sysdir.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tag.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tag.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/thread-utils.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/thread-utils.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trace.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trace.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trailer.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/trailer.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transaction.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transaction.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transport.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transport.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/auth.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/auth.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred_helpers.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/cred_helpers.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/git.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/git.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/http.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/http.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/local.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/local.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_pkt.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_pkt.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_protocol.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/smart_protocol.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/ssh.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/transports/ssh.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree-cache.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree-cache.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tree.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tsort.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/tsort.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/map.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/map.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/realpath.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/unix/realpath.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/util.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/util.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/varint.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/varint.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/vector.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/vector.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/worktree.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/worktree.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xdiffi.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xdiffi.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xemit.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xemit.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xhistogram.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xhistogram.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xmerge.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xmerge.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xpatience.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xpatience.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xprepare.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xprepare.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xutils.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/xdiff/xutils.c.o.d"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/zstream.c.o"
+  "CMakeFiles/git2.dir/root/repo/deps/libgit2-0.27.2/src/zstream.c.o.d"
+  "libgit2.a"
+  "libgit2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/git2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
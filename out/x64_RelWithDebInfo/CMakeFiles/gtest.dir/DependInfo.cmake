@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/gtest-1.7.0/src/gtest-death-test.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-death-test.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-death-test.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest-filepath.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-filepath.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-filepath.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest-port.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-port.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-port.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest-printers.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-printers.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-printers.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest-test-part.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-test-part.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-test-part.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest-typed-test.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-typed-test.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-typed-test.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest.cc.o.d"
+  "/root/repo/deps/gtest-1.7.0/src/gtest_main.cc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest_main.cc.o" "gcc" "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest_main.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-death-test.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-death-test.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-filepath.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-filepath.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-port.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-port.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-printers.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-printers.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-test-part.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-test-part.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-typed-test.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest-typed-test.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest.cc.o.d"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest_main.cc.o"
+  "CMakeFiles/gtest.dir/root/repo/deps/gtest-1.7.0/src/gtest_main.cc.o.d"
+  "libgtest.a"
+  "libgtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_parser.dir/root/repo/deps/libgit2-0.27.2/deps/http-parser/http_parser.c.o"
+  "CMakeFiles/http_parser.dir/root/repo/deps/libgit2-0.27.2/deps/http-parser/http_parser.c.o.d"
+  "libhttp_parser.a"
+  "libhttp_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/http_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/libiconv-1.14/lib/iconv.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/iconv.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/iconv.c.o.d"
+  "/root/repo/deps/libiconv-1.14/lib/relocatable.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/relocatable.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/relocatable.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/allocator.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/allocator.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/allocator.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/c-ctype.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/c-ctype.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/c-ctype.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/malloca.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/malloca.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/malloca.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/progname.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/progname.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/progname.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/relocatable.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/relocatable.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/relocatable.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/setenv.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/setenv.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/setenv.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/stdio-write.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/stdio-write.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/stdio-write.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/xmalloc.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xmalloc.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xmalloc.c.o.d"
+  "/root/repo/deps/libiconv-1.14/srclib/xstrdup.c" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xstrdup.c.o" "gcc" "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xstrdup.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/iconv.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/iconv.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/relocatable.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/lib/relocatable.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/allocator.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/allocator.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/c-ctype.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/c-ctype.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/malloca.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/malloca.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/progname.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/progname.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/relocatable.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/relocatable.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/setenv.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/setenv.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/stdio-write.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/stdio-write.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xmalloc.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xmalloc.c.o.d"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xstrdup.c.o"
+  "CMakeFiles/iconv.dir/root/repo/deps/libiconv-1.14/srclib/xstrdup.c.o.d"
+  "libiconv.a"
+  "libiconv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/YaLibs/tests/integration/integration.cpp" "CMakeFiles/integration_tests.dir/root/repo/YaLibs/tests/integration/integration.cpp.o" "gcc" "CMakeFiles/integration_tests.dir/root/repo/YaLibs/tests/integration/integration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yatools.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
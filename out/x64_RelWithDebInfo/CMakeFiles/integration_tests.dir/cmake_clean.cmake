@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integration_tests.dir/root/repo/YaLibs/tests/integration/integration.cpp.o"
+  "CMakeFiles/integration_tests.dir/root/repo/YaLibs/tests/integration/integration.cpp.o.d"
+  "integration_tests"
+  "integration_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integration_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
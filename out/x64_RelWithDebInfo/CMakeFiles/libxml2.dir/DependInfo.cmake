@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/libxml2-2.7.8/DOCBparser.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/DOCBparser.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/DOCBparser.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/HTMLparser.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLparser.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLparser.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/HTMLtree.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLtree.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLtree.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/SAX.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/SAX2.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX2.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX2.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/c14n.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/c14n.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/c14n.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/catalog.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/catalog.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/catalog.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/chvalid.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/chvalid.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/chvalid.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/debugXML.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/debugXML.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/debugXML.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/dict.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/dict.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/dict.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/encoding.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/encoding.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/encoding.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/entities.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/entities.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/entities.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/error.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/error.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/error.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/globals.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/globals.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/globals.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/hash.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/hash.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/hash.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/legacy.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/legacy.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/legacy.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/list.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/list.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/list.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/nanoftp.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanoftp.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanoftp.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/nanohttp.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanohttp.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanohttp.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/parser.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parser.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parser.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/parserInternals.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parserInternals.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parserInternals.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/pattern.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/pattern.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/pattern.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/relaxng.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/relaxng.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/relaxng.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/schematron.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/schematron.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/schematron.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/threads.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/threads.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/threads.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/tree.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/tree.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/tree.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/trionan.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/trionan.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/trionan.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/triostr.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/triostr.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/triostr.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/uri.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/uri.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/uri.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/valid.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/valid.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/valid.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xinclude.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xinclude.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xinclude.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xlink.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xlink.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xlink.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlIO.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlIO.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlIO.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlmemory.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmemory.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmemory.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlmodule.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmodule.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmodule.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlreader.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlreader.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlreader.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlregexp.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlregexp.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlregexp.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlsave.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlsave.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlsave.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlschemas.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemas.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemas.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlschemastypes.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemastypes.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemastypes.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlstring.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlstring.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlstring.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlunicode.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlunicode.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlunicode.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xmlwriter.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlwriter.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlwriter.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xpath.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpath.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpath.c.o.d"
+  "/root/repo/deps/libxml2-2.7.8/xpointer.c" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpointer.c.o" "gcc" "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpointer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
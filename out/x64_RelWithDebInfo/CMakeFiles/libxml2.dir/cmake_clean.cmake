@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/DOCBparser.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/DOCBparser.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLparser.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLparser.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLtree.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/HTMLtree.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX2.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/SAX2.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/c14n.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/c14n.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/catalog.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/catalog.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/chvalid.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/chvalid.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/debugXML.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/debugXML.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/dict.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/dict.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/encoding.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/encoding.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/entities.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/entities.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/error.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/error.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/globals.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/globals.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/hash.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/hash.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/legacy.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/legacy.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/list.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/list.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanoftp.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanoftp.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanohttp.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/nanohttp.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parser.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parser.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parserInternals.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/parserInternals.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/pattern.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/pattern.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/relaxng.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/relaxng.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/schematron.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/schematron.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/threads.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/threads.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/tree.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/tree.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/trionan.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/trionan.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/triostr.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/triostr.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/uri.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/uri.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/valid.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/valid.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xinclude.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xinclude.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xlink.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xlink.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlIO.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlIO.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmemory.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmemory.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmodule.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlmodule.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlreader.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlreader.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlregexp.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlregexp.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlsave.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlsave.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemas.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemas.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemastypes.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlschemastypes.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlstring.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlstring.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlunicode.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlunicode.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlwriter.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xmlwriter.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpath.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpath.c.o.d"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpointer.c.o"
+  "CMakeFiles/libxml2.dir/root/repo/deps/libxml2-2.7.8/xpointer.c.o.d"
+  "liblibxml2.a"
+  "liblibxml2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libxml2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
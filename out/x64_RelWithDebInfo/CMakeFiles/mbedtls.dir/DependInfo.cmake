@@ -0,0 +1,89 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/mbedtls-2.4.2/library/aes.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aes.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aes.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/aesni.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aesni.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aesni.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/arc4.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/arc4.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/arc4.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/asn1parse.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1parse.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1parse.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/asn1write.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1write.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1write.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/base64.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/base64.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/base64.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/bignum.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/bignum.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/bignum.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/blowfish.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/blowfish.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/blowfish.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/camellia.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/camellia.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/camellia.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ccm.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ccm.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ccm.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/certs.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/certs.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/certs.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/cipher.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/cipher_wrap.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher_wrap.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher_wrap.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/cmac.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cmac.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cmac.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ctr_drbg.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ctr_drbg.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ctr_drbg.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/debug.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/debug.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/debug.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/des.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/des.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/des.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/dhm.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/dhm.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/dhm.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ecdh.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdh.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdh.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ecdsa.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdsa.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdsa.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ecjpake.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecjpake.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecjpake.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ecp.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ecp_curves.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp_curves.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp_curves.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/entropy.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/entropy_poll.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy_poll.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy_poll.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/error.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/error.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/error.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/gcm.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/gcm.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/gcm.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/havege.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/havege.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/havege.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/hmac_drbg.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/hmac_drbg.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/hmac_drbg.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/md.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/md2.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md2.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md2.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/md4.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md4.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md4.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/md5.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md5.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md5.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/md_wrap.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md_wrap.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md_wrap.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/memory_buffer_alloc.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/memory_buffer_alloc.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/memory_buffer_alloc.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/net_sockets.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/net_sockets.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/net_sockets.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/oid.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/oid.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/oid.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/padlock.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/padlock.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/padlock.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pem.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pem.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pem.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pk.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pk_wrap.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk_wrap.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk_wrap.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pkcs11.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs11.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs11.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pkcs12.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs12.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs12.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pkcs5.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs5.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs5.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pkparse.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkparse.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkparse.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/pkwrite.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkwrite.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkwrite.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/platform.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/platform.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/platform.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ripemd160.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ripemd160.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ripemd160.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/rsa.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/rsa.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/rsa.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/sha1.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha1.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha1.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/sha256.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha256.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha256.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/sha512.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha512.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha512.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_cache.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cache.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cache.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_ciphersuites.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ciphersuites.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ciphersuites.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_cli.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cli.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cli.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_cookie.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cookie.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cookie.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_srv.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_srv.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_srv.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_ticket.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ticket.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ticket.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/ssl_tls.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_tls.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_tls.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/threading.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/threading.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/threading.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/timing.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/timing.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/timing.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/version.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/version_features.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version_features.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version_features.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509_create.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_create.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_create.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509_crl.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crl.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crl.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509_crt.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crt.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crt.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509_csr.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_csr.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_csr.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509write_crt.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_crt.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_crt.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/x509write_csr.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_csr.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_csr.c.o.d"
+  "/root/repo/deps/mbedtls-2.4.2/library/xtea.c" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/xtea.c.o" "gcc" "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/xtea.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,151 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aes.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aes.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aesni.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/aesni.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/arc4.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/arc4.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1parse.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1parse.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1write.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/asn1write.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/base64.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/base64.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/bignum.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/bignum.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/blowfish.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/blowfish.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/camellia.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/camellia.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ccm.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ccm.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/certs.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/certs.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher_wrap.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cipher_wrap.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cmac.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/cmac.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ctr_drbg.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ctr_drbg.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/debug.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/debug.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/des.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/des.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/dhm.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/dhm.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdh.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdh.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdsa.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecdsa.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecjpake.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecjpake.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp_curves.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ecp_curves.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy_poll.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/entropy_poll.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/error.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/error.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/gcm.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/gcm.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/havege.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/havege.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/hmac_drbg.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/hmac_drbg.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md2.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md2.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md4.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md4.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md5.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md5.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md_wrap.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/md_wrap.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/memory_buffer_alloc.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/memory_buffer_alloc.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/net_sockets.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/net_sockets.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/oid.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/oid.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/padlock.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/padlock.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pem.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pem.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk_wrap.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pk_wrap.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs11.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs11.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs12.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs12.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs5.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkcs5.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkparse.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkparse.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkwrite.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/pkwrite.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/platform.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/platform.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ripemd160.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ripemd160.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/rsa.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/rsa.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha1.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha1.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha256.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha256.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha512.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/sha512.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cache.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cache.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ciphersuites.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ciphersuites.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cli.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cli.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cookie.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_cookie.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_srv.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_srv.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ticket.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_ticket.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_tls.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/ssl_tls.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/threading.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/threading.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/timing.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/timing.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version_features.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/version_features.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_create.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_create.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crl.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crl.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crt.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_crt.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_csr.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509_csr.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_crt.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_crt.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_csr.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/x509write_csr.c.o.d"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/xtea.c.o"
+  "CMakeFiles/mbedtls.dir/root/repo/deps/mbedtls-2.4.2/library/xtea.c.o.d"
+  "libmbedtls.a"
+  "libmbedtls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mbedtls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/regex.dir/root/repo/deps/libgit2-0.27.2/deps/regex/regex.c.o"
+  "CMakeFiles/regex.dir/root/repo/deps/libgit2-0.27.2/deps/regex/regex.c.o.d"
+  "libregex.a"
+  "libregex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/regex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
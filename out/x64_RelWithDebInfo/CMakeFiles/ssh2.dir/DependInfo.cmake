@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/libssh2-1.8.0/src/agent.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/agent.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/agent.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/channel.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/channel.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/channel.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/comp.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/comp.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/comp.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/crypt.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/crypt.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/crypt.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/global.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/global.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/global.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/hostkey.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/hostkey.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/hostkey.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/keepalive.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/keepalive.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/keepalive.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/kex.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/kex.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/kex.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/knownhost.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/knownhost.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/knownhost.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/libgcrypt.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/libgcrypt.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/libgcrypt.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/mac.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mac.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mac.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/mbedtls.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mbedtls.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mbedtls.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/misc.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/misc.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/misc.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/openssl.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/openssl.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/openssl.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/os400qc3.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/os400qc3.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/os400qc3.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/packet.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/packet.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/packet.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/pem.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/pem.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/pem.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/publickey.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/publickey.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/publickey.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/scp.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/scp.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/scp.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/session.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/session.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/session.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/sftp.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/sftp.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/sftp.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/transport.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/transport.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/transport.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/userauth.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/userauth.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/userauth.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/version.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/version.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/version.c.o.d"
+  "/root/repo/deps/libssh2-1.8.0/src/wincng.c" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/wincng.c.o" "gcc" "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/wincng.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/agent.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/agent.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/channel.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/channel.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/comp.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/comp.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/crypt.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/crypt.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/global.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/global.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/hostkey.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/hostkey.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/keepalive.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/keepalive.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/kex.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/kex.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/knownhost.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/knownhost.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/libgcrypt.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/libgcrypt.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mac.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mac.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mbedtls.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/mbedtls.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/misc.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/misc.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/openssl.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/openssl.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/os400qc3.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/os400qc3.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/packet.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/packet.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/pem.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/pem.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/publickey.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/publickey.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/scp.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/scp.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/session.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/session.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/sftp.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/sftp.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/transport.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/transport.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/userauth.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/userauth.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/version.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/version.c.o.d"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/wincng.c.o"
+  "CMakeFiles/ssh2.dir/root/repo/deps/libssh2-1.8.0/src/wincng.c.o.d"
+  "libssh2.a"
+  "libssh2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ssh2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,89 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/swig-3.0.7/Source/CParse/cscanner.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/cscanner.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/cscanner.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/CParse/parser.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/parser.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/parser.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/CParse/templ.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/templ.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/templ.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/CParse/util.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/util.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/util.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/base.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/base.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/base.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/file.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/file.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/file.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/fio.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/fio.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/fio.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/hash.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/hash.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/hash.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/list.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/list.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/list.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/memory.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/memory.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/memory.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/string.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/string.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/string.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/DOH/void.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/void.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/void.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Preprocessor/cpp.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/cpp.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/cpp.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Preprocessor/expr.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/expr.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/expr.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/cwrap.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/cwrap.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/cwrap.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/deprecate.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/deprecate.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/deprecate.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/error.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/error.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/error.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/extend.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/extend.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/extend.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/fragment.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/fragment.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/fragment.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/getopt.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/getopt.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/getopt.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/include.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/include.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/include.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/misc.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/misc.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/misc.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/naming.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/naming.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/naming.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/parms.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/parms.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/parms.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/scanner.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/scanner.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/scanner.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/stype.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/stype.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/stype.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/symbol.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/symbol.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/symbol.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/tree.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/tree.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/tree.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/typemap.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typemap.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typemap.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/typeobj.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typeobj.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typeobj.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/typesys.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typesys.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typesys.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Swig/wrapfunc.c" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/wrapfunc.c.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/wrapfunc.c.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/allegrocl.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allegrocl.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allegrocl.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/allocate.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allocate.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allocate.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/browser.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/browser.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/browser.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/cffi.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/cffi.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/cffi.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/chicken.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/chicken.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/chicken.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/clisp.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/clisp.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/clisp.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/contract.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/contract.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/contract.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/csharp.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/csharp.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/csharp.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/d.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/d.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/d.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/directors.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/directors.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/directors.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/emit.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/emit.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/emit.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/go.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/go.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/go.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/guile.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/guile.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/guile.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/java.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/java.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/java.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/javascript.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/javascript.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/javascript.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/lang.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lang.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lang.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/lua.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lua.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lua.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/main.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/main.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/main.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/modula3.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/modula3.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/modula3.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/module.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/module.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/module.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/mzscheme.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/mzscheme.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/mzscheme.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/nested.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/nested.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/nested.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/ocaml.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ocaml.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ocaml.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/octave.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/octave.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/octave.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/overload.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/overload.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/overload.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/perl5.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/perl5.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/perl5.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/php.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/php.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/php.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/pike.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/pike.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/pike.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/python.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/python.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/python.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/r.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/r.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/r.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/ruby.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ruby.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ruby.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/s-exp.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/s-exp.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/s-exp.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/scilab.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/scilab.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/scilab.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/swigmain.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/swigmain.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/swigmain.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/tcl8.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/tcl8.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/tcl8.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/typepass.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/typepass.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/typepass.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/uffi.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/uffi.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/uffi.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/utils.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/utils.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/utils.cxx.o.d"
+  "/root/repo/deps/swig-3.0.7/Source/Modules/xml.cxx" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/xml.cxx.o" "gcc" "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/xml.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
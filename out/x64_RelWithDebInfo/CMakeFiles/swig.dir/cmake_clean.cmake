@@ -0,0 +1,151 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/cscanner.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/cscanner.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/parser.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/parser.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/templ.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/templ.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/util.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/CParse/util.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/base.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/base.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/file.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/file.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/fio.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/fio.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/hash.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/hash.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/list.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/list.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/memory.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/memory.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/string.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/string.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/void.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/DOH/void.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allegrocl.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allegrocl.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allocate.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/allocate.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/browser.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/browser.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/cffi.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/cffi.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/chicken.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/chicken.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/clisp.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/clisp.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/contract.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/contract.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/csharp.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/csharp.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/d.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/d.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/directors.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/directors.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/emit.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/emit.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/go.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/go.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/guile.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/guile.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/java.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/java.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/javascript.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/javascript.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lang.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lang.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lua.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/lua.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/main.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/main.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/modula3.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/modula3.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/module.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/module.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/mzscheme.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/mzscheme.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/nested.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/nested.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ocaml.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ocaml.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/octave.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/octave.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/overload.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/overload.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/perl5.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/perl5.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/php.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/php.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/pike.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/pike.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/python.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/python.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/r.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/r.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ruby.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/ruby.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/s-exp.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/s-exp.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/scilab.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/scilab.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/swigmain.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/swigmain.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/tcl8.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/tcl8.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/typepass.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/typepass.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/uffi.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/uffi.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/utils.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/utils.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/xml.cxx.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Modules/xml.cxx.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/cpp.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/cpp.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/expr.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Preprocessor/expr.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/cwrap.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/cwrap.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/deprecate.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/deprecate.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/error.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/error.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/extend.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/extend.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/fragment.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/fragment.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/getopt.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/getopt.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/include.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/include.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/misc.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/misc.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/naming.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/naming.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/parms.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/parms.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/scanner.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/scanner.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/stype.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/stype.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/symbol.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/symbol.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/tree.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/tree.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typemap.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typemap.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typeobj.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typeobj.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typesys.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/typesys.c.o.d"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/wrapfunc.c.o"
+  "CMakeFiles/swig.dir/root/repo/deps/swig-3.0.7/Source/Swig/wrapfunc.c.o.d"
+  "swig"
+  "swig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/swig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacachegc"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacachegc.pdb"
+  "CMakeFiles/yacachegc.dir/root/repo/YaToolsUtils/YaToolsCacheGc/CacheGc.cpp.o"
+  "CMakeFiles/yacachegc.dir/root/repo/YaToolsUtils/YaToolsCacheGc/CacheGc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yacachegc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacachemerger"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacachemerger.pdb"
+  "CMakeFiles/yacachemerger.dir/root/repo/YaToolsUtils/YaToolsCacheMerger/CacheMerger.cpp.o"
+  "CMakeFiles/yacachemerger.dir/root/repo/YaToolsUtils/YaToolsCacheMerger/CacheMerger.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yacachemerger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacacherelocate"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yacacherelocate.pdb"
+  "CMakeFiles/yacacherelocate.dir/root/repo/YaToolsUtils/YaToolsCacheRelocate/CacheRelocate.cpp.o"
+  "CMakeFiles/yacacherelocate.dir/root/repo/YaToolsUtils/YaToolsCacheRelocate/CacheRelocate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yacacherelocate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
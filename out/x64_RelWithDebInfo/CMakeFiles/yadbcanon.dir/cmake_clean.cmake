@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadbcanon"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadbcanon.pdb"
+  "CMakeFiles/yadbcanon.dir/root/repo/YaToolsUtils/YaToolsYaDBCanon/YaDBCanon.cpp.o"
+  "CMakeFiles/yadbcanon.dir/root/repo/YaToolsUtils/YaToolsYaDBCanon/YaDBCanon.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yadbcanon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadbtovector"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadbtovector.pdb"
+  "CMakeFiles/yadbtovector.dir/root/repo/YaToolsUtils/YaToolsYaDBToVectors/yadbtovectors.cpp.o"
+  "CMakeFiles/yadbtovector.dir/root/repo/YaToolsUtils/YaToolsYaDBToVectors/yadbtovectors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yadbtovector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadiff"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yadiff.pdb"
+  "CMakeFiles/yadiff.dir/root/repo/YaDiff/MergeYaDB.cpp.o"
+  "CMakeFiles/yadiff.dir/root/repo/YaDiff/MergeYaDB.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yadiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
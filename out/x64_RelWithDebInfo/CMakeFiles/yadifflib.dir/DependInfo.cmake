@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/YaDiff/YaDiffLib/Algo/Algo.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/Algo.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/Algo.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/CallerXRefMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/CallerXRefMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/CallerXRefMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/ExactMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExactMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExactMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/NameMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/NameMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/NameMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/TypeMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/TypeMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/TypeMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchMips.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchMips.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchMips.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchPpc.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchPpc.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchPpc.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchX86.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchX86.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchX86.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/IArch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/IArch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/IArch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/InstructionVector.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/InstructionVector.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/InstructionVector.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorDistance.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorDistance.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorDistance.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorHelpers.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorHelpers.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorHelpers.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorTypes.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorTypes.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorTypes.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/FunctionDiff.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/FunctionDiff.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/FunctionDiff.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Matching.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Matching.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Matching.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/MemoryBudget.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/MemoryBudget.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/MemoryBudget.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/Propagate.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Propagate.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Propagate.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/VersionRelation.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/VersionRelation.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/VersionRelation.cpp.o.d"
+  "/root/repo/YaDiff/YaDiffLib/YaDiff.cpp" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/YaDiff.cpp.o" "gcc" "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/YaDiff.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yatools.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/capstone.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
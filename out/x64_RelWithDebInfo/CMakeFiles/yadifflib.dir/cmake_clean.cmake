@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/Algo.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/Algo.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/CallerXRefMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/CallerXRefMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExactMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExactMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/ExternalMappingMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/NameMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/NameMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/TypeMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/TypeMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchArm.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchMips.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchMips.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchPpc.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchPpc.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchX86.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/ArchX86.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/IArch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/IArch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/InstructionVector.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/InstructionVector.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorDistance.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorDistance.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorHelpers.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorHelpers.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorTypes.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/VectorSign/VectorTypes.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Algo/XRefOffsetMatch.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/FunctionDiff.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/FunctionDiff.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Matching.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Matching.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/MemoryBudget.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/MemoryBudget.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Propagate.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/Propagate.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/VersionRelation.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/VersionRelation.cpp.o.d"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/YaDiff.cpp.o"
+  "CMakeFiles/yadifflib.dir/root/repo/YaDiff/YaDiffLib/YaDiff.cpp.o.d"
+  "libyadifflib.a"
+  "libyadifflib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yadifflib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_Algo.cpp.o"
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_Algo.cpp.o.d"
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_VersionRelation.cpp.o"
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_VersionRelation.cpp.o.d"
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_YaDiffLib.cpp.o"
+  "CMakeFiles/yadifflib_tests.dir/root/repo/YaDiff/tests/YaDiffLib_test/test_YaDiffLib.cpp.o.d"
+  "yadifflib_tests"
+  "yadifflib_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yadifflib_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
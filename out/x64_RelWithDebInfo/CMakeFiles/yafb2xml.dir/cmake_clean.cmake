@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yafb2xml"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yafb2xml.pdb"
+  "CMakeFiles/yafb2xml.dir/root/repo/YaToolsUtils/YaToolsFBToXML/FBToXML.cpp.o"
+  "CMakeFiles/yafb2xml.dir/root/repo/YaToolsUtils/YaToolsFBToXML/FBToXML.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yafb2xml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
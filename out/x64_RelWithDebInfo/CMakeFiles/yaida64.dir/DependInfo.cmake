@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/YaLibs/YaToolsIDALib/Events.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Events.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Events.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/Hooks.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Hooks.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Hooks.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/IdaDeleter.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaDeleter.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaDeleter.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/IdaModel.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaModel.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaModel.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/IdaVisitor.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaVisitor.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaVisitor.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/PluginArm.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/PluginArm.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/PluginArm.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/Repository.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Repository.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Repository.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/Strucs.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Strucs.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Strucs.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/YaCo.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaCo.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaCo.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsIDALib/YaHelpers.cpp" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaHelpers.cpp.o" "gcc" "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaHelpers.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yatools.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
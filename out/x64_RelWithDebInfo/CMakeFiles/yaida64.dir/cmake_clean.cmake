@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Events.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Events.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Hooks.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Hooks.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaDeleter.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaDeleter.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaModel.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaModel.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaVisitor.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/IdaVisitor.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/PluginArm.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/PluginArm.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Repository.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Repository.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Strucs.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/Strucs.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaCo.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaCo.cpp.o.d"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaHelpers.cpp.o"
+  "CMakeFiles/yaida64.dir/root/repo/YaLibs/YaToolsIDALib/YaHelpers.cpp.o.d"
+  "libyaida64.a"
+  "libyaida64.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yaida64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/YaLibs/YaToolsLib/BinHex.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/BinHex.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/BinHex.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/CacheDelta.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/CacheDelta.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/CacheDelta.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Canonical.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Canonical.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Canonical.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Configuration.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Configuration.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Configuration.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/FileUtils.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileUtils.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileUtils.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/FileWriter.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileWriter.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileWriter.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/FlatBufferModel.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferModel.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferModel.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/FlatBufferVisitor.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferVisitor.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferVisitor.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Gc.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Gc.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Gc.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Git.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Git.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Git.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/GitAsync.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/GitAsync.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/GitAsync.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/HSignature.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HSignature.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HSignature.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/HVersion.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HVersion.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HVersion.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Hash.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Hash.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Hash.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Logger.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Logger.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Logger.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/MemoryModel.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/MemoryModel.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/MemoryModel.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Merger.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Merger.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Merger.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Parallel.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Parallel.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Parallel.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Random.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Random.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Random.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/RelativeIds.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/RelativeIds.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/RelativeIds.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/SavePipeline.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/SavePipeline.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/SavePipeline.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Signature.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Signature.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Signature.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Utils.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Utils.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Utils.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/VersionRecord.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VersionRecord.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VersionRecord.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/VisitorCombinators.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VisitorCombinators.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VisitorCombinators.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/XmlAccept.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlAccept.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlAccept.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/XmlVisitor.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlVisitor.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlVisitor.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/YaTypes.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/YaTypes.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/YaTypes.cpp.o.d"
+  "/root/repo/YaLibs/YaToolsLib/Yatools.cpp" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Yatools.cpp.o" "gcc" "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Yatools.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
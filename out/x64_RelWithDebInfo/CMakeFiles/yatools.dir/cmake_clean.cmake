@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/BinHex.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/BinHex.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/CacheDelta.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/CacheDelta.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Canonical.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Canonical.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Configuration.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Configuration.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileUtils.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileUtils.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileWriter.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FileWriter.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferModel.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferModel.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferVisitor.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/FlatBufferVisitor.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Gc.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Gc.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Git.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Git.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/GitAsync.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/GitAsync.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HSignature.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HSignature.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HVersion.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/HVersion.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Hash.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Hash.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Logger.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Logger.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/MemoryModel.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/MemoryModel.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Merger.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Merger.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Parallel.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Parallel.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Random.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Random.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/RelativeIds.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/RelativeIds.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/SavePipeline.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/SavePipeline.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Signature.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Signature.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Utils.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Utils.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VersionRecord.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VersionRecord.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VisitorCombinators.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/VisitorCombinators.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlAccept.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlAccept.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlVisitor.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/XmlVisitor.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/YaTypes.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/YaTypes.cpp.o.d"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Yatools.cpp.o"
+  "CMakeFiles/yatools.dir/root/repo/YaLibs/YaToolsLib/Yatools.cpp.o.d"
+  "libyatools.a"
+  "libyatools.pdb"
+  "yadb_generated.h"
+  "yatools_/git_version.dependency"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yatools.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON.stamp"
+  "CMakeFiles/_yatools_py32.dir/YaToolsPy32PYTHON_wrap.cxx"
+  "CMakeFiles/yatools_py32_swig_compilation"
+  "YaToolsPy32.i"
+  "YaToolsPy32.py"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/yatools_py32_swig_compilation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
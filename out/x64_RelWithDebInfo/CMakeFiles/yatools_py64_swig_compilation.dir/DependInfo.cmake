@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "CXX"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_CXX
+  "/root/repo/out/x64_RelWithDebInfo/YaToolsPy64.i" "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON.stamp"
+  )
+set(CMAKE_CXX_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_CXX
+  "ARCH_X64"
+  )
+
+# The include file search paths:
+set(CMAKE_CXX_TARGET_INCLUDE_PATH
+  "yatools_"
+  "/root/repo/YaDiff/YaDiffLib"
+  "/root/repo/YaLibs/YaGitLib"
+  "/root/repo/YaLibs/YaToolsIDALib"
+  "/root/repo/YaLibs/YaToolsLib"
+  "/root/repo/YaLibs/YaToolsPy"
+  "/root/repo/deps/swig-3.0.7/Lib/python"
+  "/root/repo/deps/swig-3.0.7/Lib"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
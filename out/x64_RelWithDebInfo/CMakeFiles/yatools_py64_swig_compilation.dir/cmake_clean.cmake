@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON.stamp"
+  "CMakeFiles/_yatools_py64.dir/YaToolsPy64PYTHON_wrap.cxx"
+  "CMakeFiles/yatools_py64_swig_compilation"
+  "YaToolsPy64.i"
+  "YaToolsPy64.py"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/yatools_py64_swig_compilation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
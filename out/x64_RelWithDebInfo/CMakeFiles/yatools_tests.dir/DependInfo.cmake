@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/YaLibs/tests/YaToolsLib_test/ExporterValidatorVisitor.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/ExporterValidatorVisitor.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/ExporterValidatorVisitor.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_DatabaseModel.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_DatabaseModel.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_DatabaseModel.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_configuration.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_configuration.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_configuration.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_file_writer.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_file_writer.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_file_writer.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_gc.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_gc.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_gc.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_git.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_git.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_git.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp.o.d"
+  "/root/repo/YaLibs/tests/YaToolsLib_test/test_yatools.cpp" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_yatools.cpp.o" "gcc" "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_yatools.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/yatools.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/flatbuffers.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/git2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/http_parser.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/libxml2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/iconv.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/charset.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/ssh2.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/ExporterValidatorVisitor.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/ExporterValidatorVisitor.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_DatabaseModel.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_DatabaseModel.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_XMLDatabaseModel.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_configuration.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_configuration.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_file_writer.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_file_writer.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_gc.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_gc.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_git.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_git.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_relative_ids.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_save_pipeline.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_visitor_combinators.cpp.o.d"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_yatools.cpp.o"
+  "CMakeFiles/yatools_tests.dir/root/repo/YaLibs/tests/YaToolsLib_test/test_yatools.cpp.o.d"
+  "yatools_tests"
+  "yatools_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yatools_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/yaco_x64/YaTools/bin/yaxml2fb"
+  "/root/repo/bin/yaco_x64/YaTools/bin/yaxml2fb.pdb"
+  "CMakeFiles/yaxml2fb.dir/root/repo/YaToolsUtils/YaToolsXMLToFB/XMLToFB.cpp.o"
+  "CMakeFiles/yaxml2fb.dir/root/repo/YaToolsUtils/YaToolsXMLToFB/XMLToFB.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yaxml2fb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/adler32.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/adler32.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/adler32.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/crc32.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/crc32.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/crc32.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/deflate.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/deflate.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/deflate.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/infback.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/infback.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/infback.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/inffast.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inffast.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inffast.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/inflate.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inflate.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inflate.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/inftrees.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inftrees.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inftrees.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/trees.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/trees.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/trees.c.o.d"
+  "/root/repo/deps/libgit2-0.27.2/deps/zlib/zutil.c" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/zutil.c.o" "gcc" "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/out/x64_RelWithDebInfo/CMakeFiles/regex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
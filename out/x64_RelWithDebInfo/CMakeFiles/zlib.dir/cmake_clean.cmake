@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/adler32.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/adler32.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/crc32.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/crc32.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/deflate.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/deflate.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/infback.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/infback.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inffast.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inffast.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inflate.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inflate.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inftrees.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/inftrees.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/trees.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/trees.c.o.d"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/zutil.c.o"
+  "CMakeFiles/zlib.dir/root/repo/deps/libgit2-0.27.2/deps/zlib/zutil.c.o.d"
+  "libzlib.a"
+  "libzlib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,188 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/build
+# Build directory: /root/repo/out/x64_RelWithDebInfo
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(yatools_tests "/root/repo/out/x64_RelWithDebInfo/yatools_tests")
+set_tests_properties(yatools_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/build/common.cmake;457;add_test;/root/repo/build/common.cmake;484;make_target;/root/repo/build/yatools.cmake;102;add_target;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(yadifflib_tests "/root/repo/out/x64_RelWithDebInfo/yadifflib_tests")
+set_tests_properties(yadifflib_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/build/common.cmake;457;add_test;/root/repo/build/common.cmake;484;make_target;/root/repo/build/yatools.cmake;126;add_target;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(make_testdata_qt54_svg "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/make_testdata.py" "/root/repo/testdata/qt54_svg" "/root/repo/bin/yaco_x64/YaTools/bin" "/root/repo/tests/qt54_svg/Qt5Svgd.dll" "/tmp/fakeida2/ida64")
+set_tests_properties(make_testdata_qt54_svg PROPERTIES  WORKING_DIRECTORY "/root/repo/tests" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;269;add_test;/root/repo/build/yatools.cmake;275;make_testdata;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(make_testdata_qt54_svg_no_pdb "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/make_testdata.py" "--no-pdb" "/root/repo/testdata/qt54_svg_no_pdb" "/root/repo/bin/yaco_x64/YaTools/bin" "/root/repo/tests/qt54_svg/Qt5Svgd.dll" "/tmp/fakeida2/ida64")
+set_tests_properties(make_testdata_qt54_svg_no_pdb PROPERTIES  WORKING_DIRECTORY "/root/repo/tests" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;269;add_test;/root/repo/build/yatools.cmake;276;make_testdata;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(make_testdata_cmder "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/make_testdata.py" "/root/repo/testdata/cmder" "/root/repo/bin/yaco_x64/YaTools/bin" "/root/repo/tests/cmder/Cmder.exe" "/tmp/fakeida2/ida64")
+set_tests_properties(make_testdata_cmder PROPERTIES  WORKING_DIRECTORY "/root/repo/tests" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;269;add_test;/root/repo/build/yatools.cmake;277;make_testdata;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(make_testdata_vim_0197 "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/make_testdata.py" "/root/repo/testdata/vim_0197" "/root/repo/bin/yaco_x64/YaTools/bin" "/root/repo/tests/vim_0197/vim.basic" "/tmp/fakeida2/ida64")
+set_tests_properties(make_testdata_vim_0197 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;269;add_test;/root/repo/build/yatools.cmake;278;make_testdata;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(make_testdata_vim_1453 "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/make_testdata.py" "/root/repo/testdata/vim_1453" "/root/repo/bin/yaco_x64/YaTools/bin" "/root/repo/tests/vim_1453/vim.basic" "/tmp/fakeida2/ida64")
+set_tests_properties(make_testdata_vim_1453 PROPERTIES  WORKING_DIRECTORY "/root/repo/tests" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;269;add_test;/root/repo/build/yatools.cmake;279;make_testdata;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(integration_tests "/root/repo/out/x64_RelWithDebInfo/integration_tests")
+set_tests_properties(integration_tests PROPERTIES  DEPENDS "make_testdata_qt54_svg;make_testdata_qt54_svg_no_pdb" _BACKTRACE_TRIPLES "/root/repo/build/common.cmake;457;add_test;/root/repo/build/common.cmake;484;make_target;/root/repo/build/yatools.cmake;282;add_target;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_reference_views "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_reference_views.Fixture.test_reference_views" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_reference_views PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_apply_strucs "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_apply_strucs" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_apply_strucs PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_create_same_struc_independently "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_create_same_struc_independently" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_create_same_struc_independently PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_default_struc_fields "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_default_struc_fields" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_default_struc_fields PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_potential_struc_conflict "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_potential_struc_conflict" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_potential_struc_conflict PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_renamed_strucs_are_still_applied "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_renamed_strucs_are_still_applied" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_renamed_strucs_are_still_applied PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_shrink_strucs_with_default_fields "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_shrink_strucs_with_default_fields" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_shrink_strucs_with_default_fields PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_loop "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_struc_loop" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_loop PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_member_comments "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_struc_member_comments" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_member_comments PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_members "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_struc_members" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_members PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_strucs "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_strucs" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_strucs PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_sub_strucs "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs.Fixture.test_sub_strucs" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_sub_strucs PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_code_to_data_to_code "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_code_to_data_to_code" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_code_to_data_to_code PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_code_to_func_to_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_code_to_func_to_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_code_to_func_to_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_data_in_func_to_undef_and_back "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_data_in_func_to_undef_and_back" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_data_in_func_to_undef_and_back PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_data_to_func_to_code "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_data_to_func_to_code" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_data_to_func_to_code PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_func_to_code_to_undef_and_back "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_func_to_code_to_undef_and_back" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_func_to_code_to_undef_and_back PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_func_to_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_func_to_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_func_to_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_function_bgcolor "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_function_bgcolor" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_function_bgcolor PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_rename_and_undefine_func "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_rename_and_undefine_func" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_rename_and_undefine_func PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_rename_function "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_rename_function" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_rename_function PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_rename_stackframe_and_undefine_func "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_rename_stackframe_and_undefine_func" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_rename_stackframe_and_undefine_func PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_rename_stackframe_members "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_rename_stackframe_members" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_rename_stackframe_members PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_touch_function "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_functions.Fixture.test_touch_function" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_touch_function PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_server_less "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_server_less.Fixture.test_server_less" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_server_less PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_punch_data_hole_into_function "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_segments.Fixture.test_punch_data_hole_into_function" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_punch_data_hole_into_function PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_put_function_undefined_segment "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_segments.Fixture.test_put_function_undefined_segment" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_put_function_undefined_segment PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_segment_comments "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_segments.Fixture.test_segment_comments" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_segment_comments PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_full_all_items "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_get_all_items.Fixture.test_full_all_items" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_full_all_items PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_get_all_items_cmder "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_get_all_items.Fixture.test_get_all_items_cmder" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_get_all_items_cmder PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_get_all_items_qt54 "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_get_all_items.Fixture.test_get_all_items_qt54" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_get_all_items_qt54 PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_undefined_data_items "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_get_all_items.Fixture.test_undefined_data_items" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_undefined_data_items PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_function_prototype "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_prototypes.Fixture.test_function_prototype" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_function_prototype PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_prototypes "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_prototypes.Fixture.test_prototypes" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_prototypes PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_usercall "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_prototypes.Fixture.test_usercall" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_usercall PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_create_same_enum_independently "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_create_same_enum_independently" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_create_same_enum_independently PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_enum_bf "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_enum_bf" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_enum_bf PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_enum_cmt "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_enum_cmt" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_enum_cmt PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_enum_members "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_enum_members" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_enum_members PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_enum_types "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_enum_types" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_enum_types PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_enums "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_enums" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_enums PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_potential_enum_conflict "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_potential_enum_conflict" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_potential_enum_conflict PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_renamed_enums_are_still_applied "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_enums.Fixture.test_renamed_enums_are_still_applied" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_renamed_enums_are_still_applied PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_complex_struc "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs_complex.Fixture.test_complex_struc" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_complex_struc PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_create_struc_in_stack_vars "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs_complex.Fixture.test_create_struc_in_stack_vars" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_create_struc_in_stack_vars PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_field_prototypes "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs_complex.Fixture.test_field_prototypes" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_field_prototypes PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_fields "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_strucs_complex.Fixture.test_struc_fields" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_fields PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_operands "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_operands.Fixture.test_operands" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_operands PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_conflict_applied_struc "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_conflicts.Fixture.test_conflict_applied_struc" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_conflict_applied_struc PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_array_hole "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_arrays.Fixture.test_struc_array_hole" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_array_hole PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_arrays "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_arrays.Fixture.test_struc_arrays" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_arrays PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_git_conflict_version "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_git.Fixture.test_git_conflict_version" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_git_conflict_version PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_git_older_version "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_git.Fixture.test_git_older_version" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_git_older_version PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_git_submodule "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_git.Fixture.test_git_submodule" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_git_submodule PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_git_upgrade_version "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_git.Fixture.test_git_upgrade_version" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_git_upgrade_version PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_invalid_git "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_git.Fixture.test_invalid_git" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_invalid_git PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_align_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_align_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_align_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_bnot_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_bnot_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_bnot_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_cmt_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_cmt_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_cmt_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_data_types_only "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_data_types_only" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_data_types_only PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_extra_line_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_extra_line_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_extra_line_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_invsign_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_invsign_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_invsign_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_op_offset_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_op_offset_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_op_offset_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_op_type_on_data "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_data.Fixture.test_op_type_on_data" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_op_type_on_data PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_register_views "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_registers.Fixture.test_register_views" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_register_views PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_push_pull "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_push_pull.Fixture.test_push_pull" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_push_pull PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_comments "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_comments.Fixture.test_comments" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_comments PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_export_cmder "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_export.Fixture.test_export_cmder" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_export_cmder PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_export_qt54 "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_export.Fixture.test_export_qt54" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_export_qt54 PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_apply_type_delete_contained_items "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_types.Fixture.test_apply_type_delete_contained_items" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_apply_type_delete_contained_items PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_set_data_as_array_type "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_types.Fixture.test_set_data_as_array_type" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_set_data_as_array_type PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_unexplored_glitch "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_types.Fixture.test_unexplored_glitch" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_unexplored_glitch PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_conflicting_local_types "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_conflicting_local_types" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_conflicting_local_types PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_type_overwrite "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_type_overwrite" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_type_overwrite PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_type_reload "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_type_reload" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_type_reload PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_type_rename_conflict "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_type_rename_conflict" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_type_rename_conflict PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_type_renames "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_type_renames" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_type_renames PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_type_upgrades "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_type_upgrades" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_type_upgrades PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_types "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_types" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_types PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_local_types_missing_rename "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_local_types_missing_rename" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_local_types_missing_rename PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_struc_renames_with_imports "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_struc_renames_with_imports" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_struc_renames_with_imports PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(test_type_rename_on_stack_member "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/runtests.py" "-ftest_local_types.Fixture.test_type_rename_on_stack_member" "-b" "/root/repo/bin/yaco_x64/YaTools/bin")
+set_tests_properties(test_type_rename_on_stack_member PROPERTIES  DEPENDS "make_testdata_qt54_svg_no_pdb;make_testdata_cmder" WORKING_DIRECTORY "/root/repo/out/x64_RelWithDebInfo" _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;305;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
+add_test(merge_idb_tests "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/tests/test_yadiff.py" "/root/repo/bin/yaco_x64/YaTools/bin/.." "/root/.pyenv/versions/2.7.18/bin/python2.7" "/root/repo/testdata/vim_0197/vim.basic.i64" "/root/repo/testdata/vim_1453/vim.basic.i64")
+set_tests_properties(merge_idb_tests PROPERTIES  DEPENDS "make_testdata_vim_0197;make_testdata_vim_1453" ENVIRONMENT "YATOOLS_DIR=/root/repo/bin/yaco_x64/YaTools/bin/.." _BACKTRACE_TRIPLES "/root/repo/build/yatools.cmake;314;add_test;/root/repo/build/yatools.cmake;0;;/root/repo/build/CMakeLists.txt;17;include;/root/repo/build/CMakeLists.txt;0;")
@@ -0,0 +1,1505 @@
+/* config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Define to the number of bits in type 'ptrdiff_t'. */
+#undef BITSIZEOF_PTRDIFF_T
+
+/* Define to the number of bits in type 'sig_atomic_t'. */
+#undef BITSIZEOF_SIG_ATOMIC_T
+
+/* Define to the number of bits in type 'size_t'. */
+#undef BITSIZEOF_SIZE_T
+
+/* Define to the number of bits in type 'wchar_t'. */
+#undef BITSIZEOF_WCHAR_T
+
+/* Define to the number of bits in type 'wint_t'. */
+#undef BITSIZEOF_WINT_T
+
+/* Define to one of `_getb67', `GETB67', `getb67' for Cray-2 and Cray-YMP
+   systems. This function is required for `alloca.c' support on those systems.
+   */
+#undef CRAY_STACKSEG_END
+
+/* Define to 1 if using `alloca.c'. */
+#undef C_ALLOCA
+
+/* Define to 1 if // is a file system root distinct from /. */
+#undef DOUBLE_SLASH_IS_DISTINCT_ROOT
+
+/* Define as good substitute value for EILSEQ. */
+#undef EILSEQ
+
+/* Define to 1 to enable a few rarely used encodings. */
+#undef ENABLE_EXTRA
+
+/* Define to 1 if translation of program messages to the user's native
+   language is requested. */
+#undef ENABLE_NLS
+
+/* Define to 1 if the package shall run at any location in the file system. */
+#undef ENABLE_RELOCATABLE
+
+/* Define to 1 if realpath() can malloc memory, always gives an absolute path,
+   and handles trailing slash correctly. */
+#undef FUNC_REALPATH_WORKS
+
+/* Define to a C preprocessor expression that evaluates to 1 or 0, depending
+   whether the gnulib module canonicalize-lgpl shall be considered present. */
+#undef GNULIB_CANONICALIZE_LGPL
+
+/* Define to a C preprocessor expression that evaluates to 1 or 0, depending
+   whether the gnulib module sigpipe shall be considered present. */
+#undef GNULIB_SIGPIPE
+
+/* Define to a C preprocessor expression that evaluates to 1 or 0, depending
+   whether the gnulib module strerror shall be considered present. */
+#undef GNULIB_STRERROR
+
+/* Define to 1 when the gnulib module canonicalize_file_name should be tested.
+   */
+#undef GNULIB_TEST_CANONICALIZE_FILE_NAME
+
+/* Define to 1 when the gnulib module environ should be tested. */
+#undef GNULIB_TEST_ENVIRON
+
+/* Define to 1 when the gnulib module lstat should be tested. */
+#undef GNULIB_TEST_LSTAT
+
+/* Define to 1 when the gnulib module read should be tested. */
+#undef GNULIB_TEST_READ
+
+/* Define to 1 when the gnulib module readlink should be tested. */
+#undef GNULIB_TEST_READLINK
+
+/* Define to 1 when the gnulib module realpath should be tested. */
+#undef GNULIB_TEST_REALPATH
+
+/* Define to 1 when the gnulib module sigprocmask should be tested. */
+#undef GNULIB_TEST_SIGPROCMASK
+
+/* Define to 1 when the gnulib module stat should be tested. */
+#undef GNULIB_TEST_STAT
+
+/* Define to 1 when the gnulib module strerror should be tested. */
+#undef GNULIB_TEST_STRERROR
+
+/* Define to 1 if you have `alloca', as a function or macro. */
+#define HAVE_ALLOCA 0
+#if !HAVE_ALLOCA
+#undef HAVE_ALLOCA
+#endif
+
+/* Define to 1 if you have <alloca.h> and it should be used (not on Ultrix).
+   */
+#define HAVE_ALLOCA_H 0
+#if !HAVE_ALLOCA_H
+#undef HAVE_ALLOCA_H
+#endif
+
+/* Define to 1 if you have the `canonicalize_file_name' function. */
+#define HAVE_CANONICALIZE_FILE_NAME 1
+#if !HAVE_CANONICALIZE_FILE_NAME
+#undef HAVE_CANONICALIZE_FILE_NAME
+#endif
+
+/* Define to 1 if you have the MacOS X function CFLocaleCopyCurrent in the
+   CoreFoundation framework. */
+#define HAVE_CFLOCALECOPYCURRENT 0
+#if !HAVE_CFLOCALECOPYCURRENT
+#undef HAVE_CFLOCALECOPYCURRENT
+#endif
+
+/* Define to 1 if you have the MacOS X function CFPreferencesCopyAppValue in
+   the CoreFoundation framework. */
+#define HAVE_CFPREFERENCESCOPYAPPVALUE 0
+#if !HAVE_CFPREFERENCESCOPYAPPVALUE
+#undef HAVE_CFPREFERENCESCOPYAPPVALUE
+#endif
+
+/* Define if the GNU dcgettext() function is already present or preinstalled.
+   */
+#define HAVE_DCGETTEXT 0
+#if !HAVE_DCGETTEXT
+#undef HAVE_DCGETTEXT
+#endif
+
+/* Define to 1 if you have the declaration of `clearerr_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_CLEARERR_UNLOCKED 0
+#if !HAVE_DECL_CLEARERR_UNLOCKED
+#undef HAVE_DECL_CLEARERR_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `feof_unlocked', and to 0 if you
+   don't. */
+#define HAVE_DECL_FEOF_UNLOCKED 0
+#if !HAVE_DECL_FEOF_UNLOCKED
+#undef HAVE_DECL_FEOF_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `ferror_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FERROR_UNLOCKED 0
+#if !HAVE_DECL_FERROR_UNLOCKED
+#undef HAVE_DECL_FERROR_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fflush_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FFLUSH_UNLOCKED 0
+#if !HAVE_DECL_FFLUSH_UNLOCKED
+#undef HAVE_DECL_FFLUSH_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fgets_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FGETS_UNLOCKED 0
+#if !HAVE_DECL_FGETS_UNLOCKED
+#undef HAVE_DECL_FGETS_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fputc_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FPUTC_UNLOCKED 0
+#if !HAVE_DECL_FPUTC_UNLOCKED
+#undef HAVE_DECL_FPUTC_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fputs_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FPUTS_UNLOCKED 0
+#if !HAVE_DECL_FPUTS_UNLOCKED
+#undef HAVE_DECL_FPUTS_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fread_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FREAD_UNLOCKED 0
+#if !HAVE_DECL_FREAD_UNLOCKED
+#undef HAVE_DECL_FREAD_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `fwrite_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_FWRITE_UNLOCKED 0
+#if !HAVE_DECL_FWRITE_UNLOCKED
+#undef HAVE_DECL_FWRITE_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `getchar_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_GETCHAR_UNLOCKED 0
+#if !HAVE_DECL_GETCHAR_UNLOCKED
+#undef HAVE_DECL_GETCHAR_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `getc_unlocked', and to 0 if you
+   don't. */
+#define HAVE_DECL_GETC_UNLOCKED 0
+#if !HAVE_DECL_GETC_UNLOCKED
+#undef HAVE_DECL_GETC_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `program_invocation_name', and
+   to 0 if you don't. */
+#define HAVE_DECL_PROGRAM_INVOCATION_NAME 0
+#if !HAVE_DECL_PROGRAM_INVOCATION_NAME
+#undef HAVE_DECL_PROGRAM_INVOCATION_NAME
+#endif
+
+/* Define to 1 if you have the declaration of `program_invocation_short_name',
+   and to 0 if you don't. */
+#define HAVE_DECL_PROGRAM_INVOCATION_SHORT_NAME 0
+#if !HAVE_DECL_PROGRAM_INVOCATION_SHORT_NAME
+#undef HAVE_DECL_PROGRAM_INVOCATION_SHORT_NAME
+#endif
+
+/* Define to 1 if you have the declaration of `putchar_unlocked', and to 0 if
+   you don't. */
+#define HAVE_DECL_PUTCHAR_UNLOCKED 0
+#if !HAVE_DECL_PUTCHAR_UNLOCKED
+#undef HAVE_DECL_PUTCHAR_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `putc_unlocked', and to 0 if you
+   don't. */
+#define HAVE_DECL_PUTC_UNLOCKED 0
+#if !HAVE_DECL_PUTC_UNLOCKED
+#undef HAVE_DECL_PUTC_UNLOCKED
+#endif
+
+/* Define to 1 if you have the declaration of `setenv', and to 0 if you don't.
+   */
+#define HAVE_DECL_SETENV 0
+#if !HAVE_DECL_SETENV
+#undef HAVE_DECL_SETENV
+#endif
+
+/* Define to 1 if you have the declaration of `strerror_r', and to 0 if you
+   don't. */
+#define HAVE_DECL_STRERROR_R 0
+#if !HAVE_DECL_STRERROR_R
+#undef HAVE_DECL_STRERROR_R
+#endif
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define HAVE_DLFCN_H 1
+#if !HAVE_DLFCN_H
+#undef HAVE_DLFCN_H
+#endif
+
+/* Define if you have the declaration of environ. */
+#define HAVE_ENVIRON_DECL 0
+#if !HAVE_ENVIRON_DECL
+#undef HAVE_ENVIRON_DECL
+#endif
+
+/* Define to 1 if you have the `getcwd' function. */
+#define HAVE_GETCWD 1
+#if !HAVE_GETCWD
+#undef HAVE_GETCWD
+#endif
+
+/* Define to 1 if you have the `getc_unlocked' function. */
+#define HAVE_GETC_UNLOCKED 1
+#if !HAVE_GETC_UNLOCKED
+#undef HAVE_GETC_UNLOCKED
+#endif
+
+/* Define if the GNU gettext() function is already present or preinstalled. */
+#define HAVE_GETTEXT 0
+#if !HAVE_GETTEXT
+#undef HAVE_GETTEXT
+#endif
+
+/* Define if you have the iconv() function and it works. */
+#define HAVE_ICONV 0
+#if !HAVE_ICONV
+#undef HAVE_ICONV
+#endif
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+#if !HAVE_INTTYPES_H
+#undef HAVE_INTTYPES_H
+#endif
+
+/* Define if you have <langinfo.h> and nl_langinfo(CODESET). */
+#define HAVE_LANGINFO_CODESET 0
+#if !HAVE_LANGINFO_CODESET
+#undef HAVE_LANGINFO_CODESET
+#endif
+
+/* Define to 1 if the system has the type `long long int'. */
+#define HAVE_LONG_LONG_INT 1
+#if !HAVE_LONG_LONG_INT
+#undef HAVE_LONG_LONG_INT
+#endif
+
+/* Define to 1 if you have the `lstat' function. */
+#define HAVE_LSTAT 1
+#if !HAVE_LSTAT
+#undef HAVE_LSTAT
+#endif
+
+/* Define to 1 if you have the <mach-o/dyld.h> header file. */
+#define HAVE_MACH_O_DYLD_H 0
+#if !HAVE_MACH_O_DYLD_H
+#undef HAVE_MACH_O_DYLD_H
+#endif
+
+/* Define to 1 if you have the `mbrtowc' function. */
+#define HAVE_MBRTOWC 1
+#if !HAVE_MBRTOWC
+#undef HAVE_MBRTOWC
+#endif
+
+/* Define to 1 if you have the `mbsinit' function. */
+#define HAVE_MBSINIT 1
+#if !HAVE_MBSINIT
+#undef HAVE_MBSINIT
+#endif
+
+/* Define to 1 if <wchar.h> declares mbstate_t. */
+#define HAVE_MBSTATE_T 1
+#if !HAVE_MBSTATE_T
+#undef HAVE_MBSTATE_T
+#endif
+
+/* Define to 1 if you have the `memmove' function. */
+#define HAVE_MEMMOVE 1
+#if !HAVE_MEMMOVE
+#undef HAVE_MEMMOVE
+#endif
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H 1
+#if !HAVE_MEMORY_H
+#undef HAVE_MEMORY_H
+#endif
+
+/* Define to 1 if atoll is declared even after undefining macros. */
+#define HAVE_RAW_DECL_ATOLL 0
+#if !HAVE_RAW_DECL_ATOLL
+#undef HAVE_RAW_DECL_ATOLL
+#endif
+
+/* Define to 1 if canonicalize_file_name is declared even after undefining
+   macros. */
+#define HAVE_RAW_DECL_CANONICALIZE_FILE_NAME 0
+#if !HAVE_RAW_DECL_CANONICALIZE_FILE_NAME
+#undef HAVE_RAW_DECL_CANONICALIZE_FILE_NAME
+#endif
+
+/* Define to 1 if chown is declared even after undefining macros. */
+#define HAVE_RAW_DECL_CHOWN 0
+#if !HAVE_RAW_DECL_CHOWN
+#undef HAVE_RAW_DECL_CHOWN
+#endif
+
+/* Define to 1 if dprintf is declared even after undefining macros. */
+#define HAVE_RAW_DECL_DPRINTF 0
+#if !HAVE_RAW_DECL_DPRINTF
+#undef HAVE_RAW_DECL_DPRINTF
+#endif
+
+/* Define to 1 if dup2 is declared even after undefining macros. */
+#define HAVE_RAW_DECL_DUP2 0
+#if !HAVE_RAW_DECL_DUP2
+#undef HAVE_RAW_DECL_DUP2
+#endif
+
+/* Define to 1 if dup3 is declared even after undefining macros. */
+#define HAVE_RAW_DECL_DUP3 0
+#if !HAVE_RAW_DECL_DUP3
+#undef HAVE_RAW_DECL_DUP3
+#endif
+
+/* Define to 1 if endusershell is declared even after undefining macros. */
+#define HAVE_RAW_DECL_ENDUSERSHELL 0
+#if !HAVE_RAW_DECL_ENDUSERSHELL
+#undef HAVE_RAW_DECL_ENDUSERSHELL
+#endif
+
+/* Define to 1 if environ is declared even after undefining macros. */
+#define HAVE_RAW_DECL_ENVIRON 0
+#if !HAVE_RAW_DECL_ENVIRON
+#undef HAVE_RAW_DECL_ENVIRON
+#endif
+
+/* Define to 1 if euidaccess is declared even after undefining macros. */
+#define HAVE_RAW_DECL_EUIDACCESS 0
+#if !HAVE_RAW_DECL_EUIDACCESS
+#undef HAVE_RAW_DECL_EUIDACCESS
+#endif
+
+/* Define to 1 if faccessat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FACCESSAT 0
+#if !HAVE_RAW_DECL_FACCESSAT
+#undef HAVE_RAW_DECL_FACCESSAT
+#endif
+
+/* Define to 1 if fchdir is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FCHDIR 0
+#if !HAVE_RAW_DECL_FCHDIR
+#undef HAVE_RAW_DECL_FCHDIR
+#endif
+
+/* Define to 1 if fchmodat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FCHMODAT 0
+#if !HAVE_RAW_DECL_FCHMODAT
+#undef HAVE_RAW_DECL_FCHMODAT
+#endif
+
+/* Define to 1 if fchownat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FCHOWNAT 0
+#if !HAVE_RAW_DECL_FCHOWNAT
+#undef HAVE_RAW_DECL_FCHOWNAT
+#endif
+
+/* Define to 1 if fcntl is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FCNTL 0
+#if !HAVE_RAW_DECL_FCNTL
+#undef HAVE_RAW_DECL_FCNTL
+#endif
+
+/* Define to 1 if ffsl is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FFSL 0
+#if !HAVE_RAW_DECL_FFSL
+#undef HAVE_RAW_DECL_FFSL
+#endif
+
+/* Define to 1 if ffsll is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FFSLL 0
+#if !HAVE_RAW_DECL_FFSLL
+#undef HAVE_RAW_DECL_FFSLL
+#endif
+
+/* Define to 1 if fpurge is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FPURGE 0
+#if !HAVE_RAW_DECL_FPURGE
+#undef HAVE_RAW_DECL_FPURGE
+#endif
+
+/* Define to 1 if fseeko is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FSEEKO 0
+#if !HAVE_RAW_DECL_FSEEKO
+#undef HAVE_RAW_DECL_FSEEKO
+#endif
+
+/* Define to 1 if fstatat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FSTATAT 0
+#if !HAVE_RAW_DECL_FSTATAT
+#undef HAVE_RAW_DECL_FSTATAT
+#endif
+
+/* Define to 1 if fsync is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FSYNC 0
+#if !HAVE_RAW_DECL_FSYNC
+#undef HAVE_RAW_DECL_FSYNC
+#endif
+
+/* Define to 1 if ftello is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FTELLO 0
+#if !HAVE_RAW_DECL_FTELLO
+#undef HAVE_RAW_DECL_FTELLO
+#endif
+
+/* Define to 1 if ftruncate is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FTRUNCATE 0
+#if !HAVE_RAW_DECL_FTRUNCATE
+#undef HAVE_RAW_DECL_FTRUNCATE
+#endif
+
+/* Define to 1 if futimens is declared even after undefining macros. */
+#define HAVE_RAW_DECL_FUTIMENS 0
+#if !HAVE_RAW_DECL_FUTIMENS
+#undef HAVE_RAW_DECL_FUTIMENS
+#endif
+
+/* Define to 1 if getcwd is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETCWD 0
+#if !HAVE_RAW_DECL_GETCWD
+#undef HAVE_RAW_DECL_GETCWD
+#endif
+
+/* Define to 1 if getdelim is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETDELIM 0
+#if !HAVE_RAW_DECL_GETDELIM
+#undef HAVE_RAW_DECL_GETDELIM
+#endif
+
+/* Define to 1 if getdomainname is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETDOMAINNAME 0
+#if !HAVE_RAW_DECL_GETDOMAINNAME
+#undef HAVE_RAW_DECL_GETDOMAINNAME
+#endif
+
+/* Define to 1 if getdtablesize is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETDTABLESIZE 0
+#if !HAVE_RAW_DECL_GETDTABLESIZE
+#undef HAVE_RAW_DECL_GETDTABLESIZE
+#endif
+
+/* Define to 1 if getgroups is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETGROUPS 0
+#if !HAVE_RAW_DECL_GETGROUPS
+#undef HAVE_RAW_DECL_GETGROUPS
+#endif
+
+/* Define to 1 if gethostname is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETHOSTNAME 0
+#if !HAVE_RAW_DECL_GETHOSTNAME
+#undef HAVE_RAW_DECL_GETHOSTNAME
+#endif
+
+/* Define to 1 if getline is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETLINE 0
+#if !HAVE_RAW_DECL_GETLINE
+#undef HAVE_RAW_DECL_GETLINE
+#endif
+
+/* Define to 1 if getloadavg is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETLOADAVG 0
+#if !HAVE_RAW_DECL_GETLOADAVG
+#undef HAVE_RAW_DECL_GETLOADAVG
+#endif
+
+/* Define to 1 if getlogin is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETLOGIN 0
+#if !HAVE_RAW_DECL_GETLOGIN
+#undef HAVE_RAW_DECL_GETLOGIN
+#endif
+
+/* Define to 1 if getlogin_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETLOGIN_R 0
+#if !HAVE_RAW_DECL_GETLOGIN_R
+#undef HAVE_RAW_DECL_GETLOGIN_R
+#endif
+
+/* Define to 1 if getpagesize is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETPAGESIZE 0
+#if !HAVE_RAW_DECL_GETPAGESIZE
+#undef HAVE_RAW_DECL_GETPAGESIZE
+#endif
+
+/* Define to 1 if getsubopt is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETSUBOPT 0
+#if !HAVE_RAW_DECL_GETSUBOPT
+#undef HAVE_RAW_DECL_GETSUBOPT
+#endif
+
+/* Define to 1 if getusershell is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GETUSERSHELL 0
+#if !HAVE_RAW_DECL_GETUSERSHELL
+#undef HAVE_RAW_DECL_GETUSERSHELL
+#endif
+
+/* Define to 1 if grantpt is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GRANTPT 0
+#if !HAVE_RAW_DECL_GRANTPT
+#undef HAVE_RAW_DECL_GRANTPT
+#endif
+
+/* Define to 1 if group_member is declared even after undefining macros. */
+#define HAVE_RAW_DECL_GROUP_MEMBER 0
+#if !HAVE_RAW_DECL_GROUP_MEMBER
+#undef HAVE_RAW_DECL_GROUP_MEMBER
+#endif
+
+/* Define to 1 if initstat_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_INITSTAT_R 0
+#if !HAVE_RAW_DECL_INITSTAT_R
+#undef HAVE_RAW_DECL_INITSTAT_R
+#endif
+
+/* Define to 1 if lchmod is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LCHMOD 0
+#if !HAVE_RAW_DECL_LCHMOD
+#undef HAVE_RAW_DECL_LCHMOD
+#endif
+
+/* Define to 1 if lchown is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LCHOWN 0
+#if !HAVE_RAW_DECL_LCHOWN
+#undef HAVE_RAW_DECL_LCHOWN
+#endif
+
+/* Define to 1 if link is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LINK 0
+#if !HAVE_RAW_DECL_LINK
+#undef HAVE_RAW_DECL_LINK
+#endif
+
+/* Define to 1 if linkat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LINKAT 0
+#if !HAVE_RAW_DECL_LINKAT
+#undef HAVE_RAW_DECL_LINKAT
+#endif
+
+/* Define to 1 if lseek is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LSEEK 0
+#if !HAVE_RAW_DECL_LSEEK
+#undef HAVE_RAW_DECL_LSEEK
+#endif
+
+/* Define to 1 if lstat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_LSTAT 0
+#if !HAVE_RAW_DECL_LSTAT
+#undef HAVE_RAW_DECL_LSTAT
+#endif
+
+/* Define to 1 if memmem is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MEMMEM 0
+#if !HAVE_RAW_DECL_MEMMEM
+#undef HAVE_RAW_DECL_MEMMEM
+#endif
+
+/* Define to 1 if mempcpy is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MEMPCPY 0
+#if !HAVE_RAW_DECL_MEMPCPY
+#undef HAVE_RAW_DECL_MEMPCPY
+#endif
+
+/* Define to 1 if memrchr is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MEMRCHR 0
+#if !HAVE_RAW_DECL_MEMRCHR
+#undef HAVE_RAW_DECL_MEMRCHR
+#endif
+
+/* Define to 1 if mkdirat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKDIRAT 0
+#if !HAVE_RAW_DECL_MKDIRAT
+#undef HAVE_RAW_DECL_MKDIRAT
+#endif
+
+/* Define to 1 if mkdtemp is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKDTEMP 0
+#if !HAVE_RAW_DECL_MKDTEMP
+#undef HAVE_RAW_DECL_MKDTEMP
+#endif
+
+/* Define to 1 if mkfifo is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKFIFO 0
+#if !HAVE_RAW_DECL_MKFIFO
+#undef HAVE_RAW_DECL_MKFIFO
+#endif
+
+/* Define to 1 if mkfifoat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKFIFOAT 0
+#if !HAVE_RAW_DECL_MKFIFOAT
+#undef HAVE_RAW_DECL_MKFIFOAT
+#endif
+
+/* Define to 1 if mknod is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKNOD 0
+#if !HAVE_RAW_DECL_MKNOD
+#undef HAVE_RAW_DECL_MKNOD
+#endif
+
+/* Define to 1 if mknodat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKNODAT 0
+#if !HAVE_RAW_DECL_MKNODAT
+#undef HAVE_RAW_DECL_MKNODAT
+#endif
+
+/* Define to 1 if mkostemp is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKOSTEMP 0
+#if !HAVE_RAW_DECL_MKOSTEMP
+#undef HAVE_RAW_DECL_MKOSTEMP
+#endif
+
+/* Define to 1 if mkostemps is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKOSTEMPS 0
+#if !HAVE_RAW_DECL_MKOSTEMPS
+#undef HAVE_RAW_DECL_MKOSTEMPS
+#endif
+
+/* Define to 1 if mkstemp is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKSTEMP 0
+#if !HAVE_RAW_DECL_MKSTEMP
+#undef HAVE_RAW_DECL_MKSTEMP
+#endif
+
+/* Define to 1 if mkstemps is declared even after undefining macros. */
+#define HAVE_RAW_DECL_MKSTEMPS 0
+#if !HAVE_RAW_DECL_MKSTEMPS
+#undef HAVE_RAW_DECL_MKSTEMPS
+#endif
+
+/* Define to 1 if openat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_OPENAT 0
+#if !HAVE_RAW_DECL_OPENAT
+#undef HAVE_RAW_DECL_OPENAT
+#endif
+
+/* Define to 1 if pipe is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PIPE 0
+#if !HAVE_RAW_DECL_PIPE
+#undef HAVE_RAW_DECL_PIPE
+#endif
+
+/* Define to 1 if pipe2 is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PIPE2 0
+#if !HAVE_RAW_DECL_PIPE2
+#undef HAVE_RAW_DECL_PIPE2
+#endif
+
+/* Define to 1 if popen is declared even after undefining macros. */
+#define HAVE_RAW_DECL_POPEN 0
+#if !HAVE_RAW_DECL_POPEN
+#undef HAVE_RAW_DECL_POPEN
+#endif
+
+/* Define to 1 if pread is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PREAD 0
+#if !HAVE_RAW_DECL_PREAD
+#undef HAVE_RAW_DECL_PREAD
+#endif
+
+/* Define to 1 if pthread_sigmask is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PTHREAD_SIGMASK 0
+#if !HAVE_RAW_DECL_PTHREAD_SIGMASK
+#undef HAVE_RAW_DECL_PTHREAD_SIGMASK
+#endif
+
+/* Define to 1 if ptsname is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PTSNAME 0
+#if !HAVE_RAW_DECL_PTSNAME
+#undef HAVE_RAW_DECL_PTSNAME
+#endif
+
+/* Define to 1 if pwrite is declared even after undefining macros. */
+#define HAVE_RAW_DECL_PWRITE 0
+#if !HAVE_RAW_DECL_PWRITE
+#undef HAVE_RAW_DECL_PWRITE
+#endif
+
+/* Define to 1 if random_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_RANDOM_R 0
+#if !HAVE_RAW_DECL_RANDOM_R
+#undef HAVE_RAW_DECL_RANDOM_R
+#endif
+
+/* Define to 1 if rawmemchr is declared even after undefining macros. */
+#define HAVE_RAW_DECL_RAWMEMCHR 0
+#if !HAVE_RAW_DECL_RAWMEMCHR
+#undef HAVE_RAW_DECL_RAWMEMCHR
+#endif
+
+/* Define to 1 if readlink is declared even after undefining macros. */
+#define HAVE_RAW_DECL_READLINK 0
+#if !HAVE_RAW_DECL_READLINK
+#undef HAVE_RAW_DECL_READLINK
+#endif
+
+/* Define to 1 if readlinkat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_READLINKAT 0
+#if !HAVE_RAW_DECL_READLINKAT
+#undef HAVE_RAW_DECL_READLINKAT
+#endif
+
+/* Define to 1 if realpath is declared even after undefining macros. */
+#define HAVE_RAW_DECL_REALPATH 0
+#if !HAVE_RAW_DECL_REALPATH
+#undef HAVE_RAW_DECL_REALPATH
+#endif
+
+/* Define to 1 if renameat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_RENAMEAT 0
+#if !HAVE_RAW_DECL_RENAMEAT
+#undef HAVE_RAW_DECL_RENAMEAT
+#endif
+
+/* Define to 1 if rmdir is declared even after undefining macros. */
+#define HAVE_RAW_DECL_RMDIR 0
+#if !HAVE_RAW_DECL_RMDIR
+#undef HAVE_RAW_DECL_RMDIR
+#endif
+
+/* Define to 1 if rpmatch is declared even after undefining macros. */
+#define HAVE_RAW_DECL_RPMATCH 0
+#if !HAVE_RAW_DECL_RPMATCH
+#undef HAVE_RAW_DECL_RPMATCH
+#endif
+
+/* Define to 1 if setenv is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SETENV 0
+#if !HAVE_RAW_DECL_SETENV
+#undef HAVE_RAW_DECL_SETENV
+#endif
+
+/* Define to 1 if setstate_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SETSTATE_R 0
+#if !HAVE_RAW_DECL_SETSTATE_R
+#undef HAVE_RAW_DECL_SETSTATE_R
+#endif
+
+/* Define to 1 if setusershell is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SETUSERSHELL 0
+#if !HAVE_RAW_DECL_SETUSERSHELL
+#undef HAVE_RAW_DECL_SETUSERSHELL
+#endif
+
+/* Define to 1 if sigaction is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGACTION 0
+#if !HAVE_RAW_DECL_SIGACTION
+#undef HAVE_RAW_DECL_SIGACTION
+#endif
+
+/* Define to 1 if sigaddset is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGADDSET 0
+#if !HAVE_RAW_DECL_SIGADDSET
+#undef HAVE_RAW_DECL_SIGADDSET
+#endif
+
+/* Define to 1 if sigdelset is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGDELSET 0
+#if !HAVE_RAW_DECL_SIGDELSET
+#undef HAVE_RAW_DECL_SIGDELSET
+#endif
+
+/* Define to 1 if sigemptyset is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGEMPTYSET 0
+#if !HAVE_RAW_DECL_SIGEMPTYSET
+#undef HAVE_RAW_DECL_SIGEMPTYSET
+#endif
+
+/* Define to 1 if sigfillset is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGFILLSET 0
+#if !HAVE_RAW_DECL_SIGFILLSET
+#undef HAVE_RAW_DECL_SIGFILLSET
+#endif
+
+/* Define to 1 if sigismember is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGISMEMBER 0
+#if !HAVE_RAW_DECL_SIGISMEMBER
+#undef HAVE_RAW_DECL_SIGISMEMBER
+#endif
+
+/* Define to 1 if sigpending is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGPENDING 0
+#if !HAVE_RAW_DECL_SIGPENDING
+#undef HAVE_RAW_DECL_SIGPENDING
+#endif
+
+/* Define to 1 if sigprocmask is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SIGPROCMASK 0
+#if !HAVE_RAW_DECL_SIGPROCMASK
+#undef HAVE_RAW_DECL_SIGPROCMASK
+#endif
+
+/* Define to 1 if sleep is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SLEEP 0
+#if !HAVE_RAW_DECL_SLEEP
+#undef HAVE_RAW_DECL_SLEEP
+#endif
+
+/* Define to 1 if snprintf is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SNPRINTF 0
+#if !HAVE_RAW_DECL_SNPRINTF
+#undef HAVE_RAW_DECL_SNPRINTF
+#endif
+
+/* Define to 1 if srandom_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SRANDOM_R 0
+#if !HAVE_RAW_DECL_SRANDOM_R
+#undef HAVE_RAW_DECL_SRANDOM_R
+#endif
+
+/* Define to 1 if stat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STAT 0
+#if !HAVE_RAW_DECL_STAT
+#undef HAVE_RAW_DECL_STAT
+#endif
+
+/* Define to 1 if stpcpy is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STPCPY 0
+#if !HAVE_RAW_DECL_STPCPY
+#undef HAVE_RAW_DECL_STPCPY
+#endif
+
+/* Define to 1 if stpncpy is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STPNCPY 0
+#if !HAVE_RAW_DECL_STPNCPY
+#undef HAVE_RAW_DECL_STPNCPY
+#endif
+
+/* Define to 1 if strcasestr is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRCASESTR 0
+#if !HAVE_RAW_DECL_STRCASESTR
+#undef HAVE_RAW_DECL_STRCASESTR
+#endif
+
+/* Define to 1 if strchrnul is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRCHRNUL 0
+#if !HAVE_RAW_DECL_STRCHRNUL
+#undef HAVE_RAW_DECL_STRCHRNUL
+#endif
+
+/* Define to 1 if strdup is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRDUP 0
+#if !HAVE_RAW_DECL_STRDUP
+#undef HAVE_RAW_DECL_STRDUP
+#endif
+
+/* Define to 1 if strerror_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRERROR_R 0
+#if !HAVE_RAW_DECL_STRERROR_R
+#undef HAVE_RAW_DECL_STRERROR_R
+#endif
+
+/* Define to 1 if strncat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRNCAT 0
+#if !HAVE_RAW_DECL_STRNCAT
+#undef HAVE_RAW_DECL_STRNCAT
+#endif
+
+/* Define to 1 if strndup is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRNDUP 0
+#if !HAVE_RAW_DECL_STRNDUP
+#undef HAVE_RAW_DECL_STRNDUP
+#endif
+
+/* Define to 1 if strnlen is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRNLEN 0
+#if !HAVE_RAW_DECL_STRNLEN
+#undef HAVE_RAW_DECL_STRNLEN
+#endif
+
+/* Define to 1 if strpbrk is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRPBRK 0
+#if !HAVE_RAW_DECL_STRPBRK
+#undef HAVE_RAW_DECL_STRPBRK
+#endif
+
+/* Define to 1 if strsep is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRSEP 0
+#if !HAVE_RAW_DECL_STRSEP
+#undef HAVE_RAW_DECL_STRSEP
+#endif
+
+/* Define to 1 if strsignal is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRSIGNAL 0
+#if !HAVE_RAW_DECL_STRSIGNAL
+#undef HAVE_RAW_DECL_STRSIGNAL
+#endif
+
+/* Define to 1 if strtod is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRTOD 0
+#if !HAVE_RAW_DECL_STRTOD
+#undef HAVE_RAW_DECL_STRTOD
+#endif
+
+/* Define to 1 if strtok_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRTOK_R 0
+#if !HAVE_RAW_DECL_STRTOK_R
+#undef HAVE_RAW_DECL_STRTOK_R
+#endif
+
+/* Define to 1 if strtoll is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRTOLL 0
+#if !HAVE_RAW_DECL_STRTOLL
+#undef HAVE_RAW_DECL_STRTOLL
+#endif
+
+/* Define to 1 if strtoull is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRTOULL 0
+#if !HAVE_RAW_DECL_STRTOULL
+#undef HAVE_RAW_DECL_STRTOULL
+#endif
+
+/* Define to 1 if strverscmp is declared even after undefining macros. */
+#define HAVE_RAW_DECL_STRVERSCMP 0
+#if !HAVE_RAW_DECL_STRVERSCMP
+#undef HAVE_RAW_DECL_STRVERSCMP
+#endif
+
+/* Define to 1 if symlink is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SYMLINK 0
+#if !HAVE_RAW_DECL_SYMLINK
+#undef HAVE_RAW_DECL_SYMLINK
+#endif
+
+/* Define to 1 if symlinkat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_SYMLINKAT 0
+#if !HAVE_RAW_DECL_SYMLINKAT
+#undef HAVE_RAW_DECL_SYMLINKAT
+#endif
+
+/* Define to 1 if tmpfile is declared even after undefining macros. */
+#define HAVE_RAW_DECL_TMPFILE 0
+#if !HAVE_RAW_DECL_TMPFILE
+#undef HAVE_RAW_DECL_TMPFILE
+#endif
+
+/* Define to 1 if ttyname_r is declared even after undefining macros. */
+#define HAVE_RAW_DECL_TTYNAME_R 0
+#if !HAVE_RAW_DECL_TTYNAME_R
+#undef HAVE_RAW_DECL_TTYNAME_R
+#endif
+
+/* Define to 1 if unlink is declared even after undefining macros. */
+#define HAVE_RAW_DECL_UNLINK 0
+#if !HAVE_RAW_DECL_UNLINK
+#undef HAVE_RAW_DECL_UNLINK
+#endif
+
+/* Define to 1 if unlinkat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_UNLINKAT 0
+#if !HAVE_RAW_DECL_UNLINKAT
+#undef HAVE_RAW_DECL_UNLINKAT
+#endif
+
+/* Define to 1 if unlockpt is declared even after undefining macros. */
+#define HAVE_RAW_DECL_UNLOCKPT 0
+#if !HAVE_RAW_DECL_UNLOCKPT
+#undef HAVE_RAW_DECL_UNLOCKPT
+#endif
+
+/* Define to 1 if unsetenv is declared even after undefining macros. */
+#define HAVE_RAW_DECL_UNSETENV 0
+#if !HAVE_RAW_DECL_UNSETENV
+#undef HAVE_RAW_DECL_UNSETENV
+#endif
+
+/* Define to 1 if usleep is declared even after undefining macros. */
+#define HAVE_RAW_DECL_USLEEP 0
+#if !HAVE_RAW_DECL_USLEEP
+#undef HAVE_RAW_DECL_USLEEP
+#endif
+
+/* Define to 1 if utimensat is declared even after undefining macros. */
+#define HAVE_RAW_DECL_UTIMENSAT 0
+#if !HAVE_RAW_DECL_UTIMENSAT
+#undef HAVE_RAW_DECL_UTIMENSAT
+#endif
+
+/* Define to 1 if vdprintf is declared even after undefining macros. */
+#define HAVE_RAW_DECL_VDPRINTF 0
+#if !HAVE_RAW_DECL_VDPRINTF
+#undef HAVE_RAW_DECL_VDPRINTF
+#endif
+
+/* Define to 1 if vsnprintf is declared even after undefining macros. */
+#define HAVE_RAW_DECL_VSNPRINTF 0
+#if !HAVE_RAW_DECL_VSNPRINTF
+#undef HAVE_RAW_DECL_VSNPRINTF
+#endif
+
+/* Define to 1 if _Exit is declared even after undefining macros. */
+#define HAVE_RAW_DECL__EXIT 0
+#if !HAVE_RAW_DECL__EXIT
+#undef HAVE_RAW_DECL__EXIT
+#endif
+
+/* Define to 1 if you have the `readlink' function. */
+#define HAVE_READLINK 1
+#if !HAVE_READLINK
+#undef HAVE_READLINK
+#endif
+
+/* Define to 1 if you have the `readlinkat' function. */
+#define HAVE_READLINKAT 1
+#if !HAVE_READLINKAT
+#undef HAVE_READLINKAT
+#endif
+
+/* Define to 1 if you have the `realpath' function. */
+#define HAVE_REALPATH 1
+#if !HAVE_REALPATH
+#undef HAVE_REALPATH
+#endif
+
+/* Define to 1 if you have the <search.h> header file. */
+#define HAVE_SEARCH_H 1
+#if !HAVE_SEARCH_H
+#undef HAVE_SEARCH_H
+#endif
+
+/* Define to 1 if you have the `setenv' function. */
+#define HAVE_SETENV 1
+#if !HAVE_SETENV
+#undef HAVE_SETENV
+#endif
+
+/* Define to 1 if you have the `setlocale' function. */
+#define HAVE_SETLOCALE 1
+#if !HAVE_SETLOCALE
+#undef HAVE_SETLOCALE
+#endif
+
+/* Define to 1 if 'sig_atomic_t' is a signed integer type. */
+#define HAVE_SIGNED_SIG_ATOMIC_T 0
+#if !HAVE_SIGNED_SIG_ATOMIC_T
+#undef HAVE_SIGNED_SIG_ATOMIC_T
+#endif
+
+/* Define to 1 if 'wchar_t' is a signed integer type. */
+#define HAVE_SIGNED_WCHAR_T 0
+#if !HAVE_SIGNED_WCHAR_T
+#undef HAVE_SIGNED_WCHAR_T
+#endif
+
+/* Define to 1 if 'wint_t' is a signed integer type. */
+#define HAVE_SIGNED_WINT_T 0
+#if !HAVE_SIGNED_WINT_T
+#undef HAVE_SIGNED_WINT_T
+#endif
+
+/* Define to 1 if the system has the type `sigset_t'. */
+#define HAVE_SIGSET_T 1
+#if !HAVE_SIGSET_T
+#undef HAVE_SIGSET_T
+#endif
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+#if !HAVE_STDINT_H
+#undef HAVE_STDINT_H
+#endif
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+#if !HAVE_STDLIB_H
+#undef HAVE_STDLIB_H
+#endif
+
+/* Define to 1 if you have the `strerror_r' function. */
+#define HAVE_STRERROR_R 1
+#if !HAVE_STRERROR_R
+#undef HAVE_STRERROR_R
+#endif
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+#if !HAVE_STRINGS_H
+#undef HAVE_STRINGS_H
+#endif
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+#if !HAVE_STRING_H
+#undef HAVE_STRING_H
+#endif
+
+/* Define to 1 if you have the <sys/bitypes.h> header file. */
+#define HAVE_SYS_BITYPES_H 1
+#if !HAVE_SYS_BITYPES_H
+#undef HAVE_SYS_BITYPES_H
+#endif
+
+/* Define to 1 if you have the <sys/inttypes.h> header file. */
+#define HAVE_SYS_INTTYPES_H 0
+#if !HAVE_SYS_INTTYPES_H
+#undef HAVE_SYS_INTTYPES_H
+#endif
+
+/* Define to 1 if you have the <sys/param.h> header file. */
+#define HAVE_SYS_PARAM_H 1
+#if !HAVE_SYS_PARAM_H
+#undef HAVE_SYS_PARAM_H
+#endif
+
+/* Define to 1 if you have the <sys/socket.h> header file. */
+#define HAVE_SYS_SOCKET_H 1
+#if !HAVE_SYS_SOCKET_H
+#undef HAVE_SYS_SOCKET_H
+#endif
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+#if !HAVE_SYS_STAT_H
+#undef HAVE_SYS_STAT_H
+#endif
+
+/* Define to 1 if you have the <sys/time.h> header file. */
+#define HAVE_SYS_TIME_H 1
+#if !HAVE_SYS_TIME_H
+#undef HAVE_SYS_TIME_H
+#endif
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+#if !HAVE_SYS_TYPES_H
+#undef HAVE_SYS_TYPES_H
+#endif
+
+/* Define to 1 if you have the `tsearch' function. */
+#define HAVE_TSEARCH 1
+#if !HAVE_TSEARCH
+#undef HAVE_TSEARCH
+#endif
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+#if !HAVE_UNISTD_H
+#undef HAVE_UNISTD_H
+#endif
+
+/* Define to 1 if the system has the type `unsigned long long int'. */
+#define HAVE_UNSIGNED_LONG_LONG_INT 1
+#if !HAVE_UNSIGNED_LONG_LONG_INT
+#undef HAVE_UNSIGNED_LONG_LONG_INT
+#endif
+
+/* Define to 1 or 0, depending whether the compiler supports simple visibility
+   declarations. */
+#define HAVE_VISIBILITY 0
+#if !HAVE_VISIBILITY
+#undef HAVE_VISIBILITY
+#endif
+
+/* Define to 1 if you have the <wchar.h> header file. */
+#define HAVE_WCHAR_H 1
+#if !HAVE_WCHAR_H
+#undef HAVE_WCHAR_H
+#endif
+
+/* Define if you have the 'wchar_t' type. */
+#define HAVE_WCHAR_T 1
+#if !HAVE_WCHAR_T
+#undef HAVE_WCHAR_T
+#endif
+
+/* Define to 1 if you have the `wcrtomb' function. */
+#define HAVE_WCRTOMB 1
+#if !HAVE_WCRTOMB
+#undef HAVE_WCRTOMB
+#endif
+
+/* Define to 1 if you have the <winsock2.h> header file. */
+#define HAVE_WINSOCK2_H 0
+#if !HAVE_WINSOCK2_H
+#undef HAVE_WINSOCK2_H
+#endif
+
+/* Define to 1 if O_NOATIME works. */
+#define HAVE_WORKING_O_NOATIME 0
+#if !HAVE_WORKING_O_NOATIME
+#undef HAVE_WORKING_O_NOATIME
+#endif
+
+/* Define to 1 if O_NOFOLLOW works. */
+#define HAVE_WORKING_O_NOFOLLOW 0
+#if !HAVE_WORKING_O_NOFOLLOW
+#undef HAVE_WORKING_O_NOFOLLOW
+#endif
+
+/* Define to 1 if the system has the type `_Bool'. */
+#define HAVE__BOOL 1
+#if !HAVE__BOOL
+#undef HAVE__BOOL
+#endif
+
+/* Define to 1 if you have the `_NSGetExecutablePath' function. */
+#define HAVE__NSGETEXECUTABLEPATH 0
+#if !HAVE__NSGETEXECUTABLEPATH
+#undef HAVE__NSGETEXECUTABLEPATH
+#endif
+
+/* Define as const if the declaration of iconv() needs const. */
+#undef ICONV_CONST
+
+/* Define to the value of , as a string. */
+#undef INSTALLPREFIX
+
+/* Define to 1 if `lstat' dereferences a symlink specified with a trailing
+   slash. */
+#undef LSTAT_FOLLOWS_SLASHED_SYMLINK
+
+/* Define to the sub-directory in which libtool stores uninstalled libraries.
+   */
+#undef LT_OBJDIR
+
+/* If malloc(0) is != NULL, define this to 1. Otherwise define this to 0. */
+#undef MALLOC_0_IS_NONNULL
+
+/* Define to 1 if your C compiler doesn't accept -c and -o together. */
+#undef NO_MINUS_C_MINUS_O
+
+/* Name of package */
+#undef PACKAGE
+
+/* Define to the address where bug reports for this package should be sent. */
+#undef PACKAGE_BUGREPORT
+
+/* Define to the full name of this package. */
+#undef PACKAGE_NAME
+
+/* Define to the full name and version of this package. */
+#undef PACKAGE_STRING
+
+/* Define to the one symbol short name of this package. */
+#undef PACKAGE_TARNAME
+
+/* Define to the home page for this package. */
+#undef PACKAGE_URL
+
+/* Define to the version of this package. */
+#undef PACKAGE_VERSION
+
+/* Define to l, ll, u, ul, ull, etc., as suitable for constants of type
+   'ptrdiff_t'. */
+#undef PTRDIFF_T_SUFFIX
+
+/* Define to 1 if readlink fails to recognize a trailing slash. */
+#undef READLINK_TRAILING_SLASH_BUG
+
+/* Define to 1 if stat needs help when passed a directory name with a trailing
+   slash */
+#undef REPLACE_FUNC_STAT_DIR
+
+/* Define to 1 if stat needs help when passed a file name with a trailing
+   slash */
+#undef REPLACE_FUNC_STAT_FILE
+
+/* Define to 1 if strerror(0) does not return a message implying success. */
+#undef REPLACE_STRERROR_0
+
+/* Define to l, ll, u, ul, ull, etc., as suitable for constants of type
+   'sig_atomic_t'. */
+#undef SIG_ATOMIC_T_SUFFIX
+
+/* Define to l, ll, u, ul, ull, etc., as suitable for constants of type
+   'size_t'. */
+#undef SIZE_T_SUFFIX
+
+/* If using the C implementation of alloca, define if you know the
+   direction of stack growth for your system otherwise it will be
+   automatically deduced at runtime.
+	STACK_DIRECTION > 0 => grows toward higher addresses
+	STACK_DIRECTION < 0 => grows toward lower addresses
+	STACK_DIRECTION = 0 => direction of growth unknown */
+#undef STACK_DIRECTION
+
+/* Define to 1 if the `S_IS*' macros in <sys/stat.h> do not work properly. */
+#undef STAT_MACROS_BROKEN
+
+/* Define to 1 if you have the ANSI C header files. */
+#undef STDC_HEADERS
+
+/* Define to 1 if strerror_r returns char *. */
+#undef STRERROR_R_CHAR_P
+
+/* Define to the prefix of C symbols at the assembler and linker level, either
+   an underscore or empty. */
+#undef USER_LABEL_PREFIX
+
+/* Define to 1 if you want getc etc. to use unlocked I/O if available.
+   Unlocked I/O can improve performance in unithreaded apps, but it is not
+   safe for multithreaded apps. */
+#undef USE_UNLOCKED_IO
+
+/* Version number of package */
+#undef VERSION
+
+/* Define to l, ll, u, ul, ull, etc., as suitable for constants of type
+   'wchar_t'. */
+#undef WCHAR_T_SUFFIX
+
+/* Define to l, ll, u, ul, ull, etc., as suitable for constants of type
+   'wint_t'. */
+#undef WINT_T_SUFFIX
+
+/* Define if the machine's byte ordering is little endian. */
+#undef WORDS_LITTLEENDIAN
+
+/* Define to 1 if on MINIX. */
+#undef _MINIX
+
+/* The _Noreturn keyword of draft C1X.  */
+#ifndef _Noreturn
+# if (3 <= __GNUC__ || (__GNUC__ == 2 && 8 <= __GNUC_MINOR__) \
+      || 0x5110 <= __SUNPRO_C)
+#  define _Noreturn __attribute__ ((__noreturn__))
+# elif 1200 <= _MSC_VER
+#  define _Noreturn __declspec (noreturn)
+# else
+#  define _Noreturn
+# endif
+#endif
+
+
+/* Define to 2 if the system does not provide POSIX.1 features except with
+   this defined. */
+#undef _POSIX_1_SOURCE
+
+/* Define to 1 if you need to in order for `stat' and other things to work. */
+#undef _POSIX_SOURCE
+
+/* Define to 500 only on HP-UX. */
+#undef _XOPEN_SOURCE
+
+/* Enable extensions on AIX 3, Interix.  */
+#ifndef _ALL_SOURCE
+# undef _ALL_SOURCE
+#endif
+/* Enable general extensions on MacOS X.  */
+#ifndef _DARWIN_C_SOURCE
+# undef _DARWIN_C_SOURCE
+#endif
+/* Enable GNU extensions on systems that have them.  */
+#ifndef _GNU_SOURCE
+# undef _GNU_SOURCE
+#endif
+/* Enable threading extensions on Solaris.  */
+#ifndef _POSIX_PTHREAD_SEMANTICS
+# undef _POSIX_PTHREAD_SEMANTICS
+#endif
+/* Enable extensions on HP NonStop.  */
+#ifndef _TANDEM_SOURCE
+# undef _TANDEM_SOURCE
+#endif
+/* Enable general extensions on Solaris.  */
+#ifndef __EXTENSIONS__
+# undef __EXTENSIONS__
+#endif
+
+
+/* Define to `int' if <sys/types.h> doesn't define. */
+#undef gid_t
+
+/* Define to `__inline__' or `__inline' if that's what the C compiler
+   calls it, or to nothing if 'inline' is not supported under any name.  */
+#ifndef __cplusplus
+#undef inline
+#endif
+
+/* Work around a bug in Apple GCC 4.0.1 build 5465: In C99 mode, it supports
+   the ISO C 99 semantics of 'extern inline' (unlike the GNU C semantics of
+   earlier versions), but does not display it by setting __GNUC_STDC_INLINE__.
+   __APPLE__ && __MACH__ test for MacOS X.
+   __APPLE_CC__ tests for the Apple compiler and its version.
+   __STDC_VERSION__ tests for the C99 mode.  */
+#if defined __APPLE__ && defined __MACH__ && __APPLE_CC__ >= 5465 && !defined __cplusplus && __STDC_VERSION__ >= 199901L && !defined __GNUC_STDC_INLINE__
+# define __GNUC_STDC_INLINE__ 1
+#endif
+
+/* Define to a type if <wchar.h> does not define. */
+#undef mbstate_t
+
+/* Define to the type of st_nlink in struct stat, or a supertype. */
+#undef nlink_t
+
+/* Define to the equivalent of the C99 'restrict' keyword, or to
+   nothing if this is not supported.  Do not define if restrict is
+   supported directly.  */
+#undef restrict
+/* Work around a bug in Sun C++: it does not support _Restrict or
+   __restrict__, even though the corresponding Sun C compiler ends up with
+   "#define restrict _Restrict" or "#define restrict __restrict__" in the
+   previous line.  Perhaps some future version of Sun C++ will work with
+   restrict if so, hopefully it defines __RESTRICT like Sun C does.  */
+#if defined __SUNPRO_CC && !defined __RESTRICT
+# define _Restrict
+# define __restrict__
+#endif
+
+/* Define to `unsigned int' if <sys/types.h> does not define. */
+#undef size_t
+
+/* Define as a signed type of the same size as size_t. */
+#undef ssize_t
+
+/* Define to `int' if <sys/types.h> doesn't define. */
+#undef uid_t
+
+/* Define as a marker that can be attached to declarations that might not
+    be used.  This helps to reduce warnings, such as from
+    GCC -Wunused-parameter.  */
+#if __GNUC__ >= 3 || (__GNUC__ == 2 && __GNUC_MINOR__ >= 7)
+# define _GL_UNUSED __attribute__ ((__unused__))
+#else
+# define _GL_UNUSED
+#endif
+/* The name _UNUSED_PARAMETER_ is an earlier spelling, although the name
+   is a misnomer outside of parameter lists.  */
+#define _UNUSED_PARAMETER_ _GL_UNUSED
+
+/* The __pure__ attribute was added in gcc 2.96.  */
+#if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ >= 96)
+# define _GL_ATTRIBUTE_PURE __attribute__ ((__pure__))
+#else
+# define _GL_ATTRIBUTE_PURE /* empty */
+#endif
+
+/* The __const__ attribute was added in gcc 2.95.  */
+#if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ >= 95)
+# define _GL_ATTRIBUTE_CONST __attribute__ ((__const__))
+#else
+# define _GL_ATTRIBUTE_CONST /* empty */
+#endif
+
+
+
+/* On Windows, variables that may be in a DLL must be marked specially.  */
+#if defined _MSC_VER && defined _DLL
+# define DLL_VARIABLE __declspec (dllimport)
+#else
+# define DLL_VARIABLE
+#endif
+
+ 
+#define EILSEQ      64 
+#define ICONV_CONST const
@@ -0,0 +1,583 @@
+/* config.h.in.  Generated from configure.in by autoheader.  */
+#undef PACKAGE
+#undef VERSION
+#define HAVE_LIBZ 0
+#if !HAVE_LIBZ
+#undef HAVE_LIBZ
+#endif
+#define HAVE_LIBM 0
+#if !HAVE_LIBM
+#undef HAVE_LIBM
+#endif
+#define HAVE_ISINF 0
+#if !HAVE_ISINF
+#undef HAVE_ISINF
+#endif
+#define HAVE_ISNAN 0
+#if !HAVE_ISNAN
+#undef HAVE_ISNAN
+#endif
+#define HAVE_LIBHISTORY 0
+#if !HAVE_LIBHISTORY
+#undef HAVE_LIBHISTORY
+#endif
+#define HAVE_LIBREADLINE 0
+#if !HAVE_LIBREADLINE
+#undef HAVE_LIBREADLINE
+#endif
+#define HAVE_LIBPTHREAD 0
+#if !HAVE_LIBPTHREAD
+#undef HAVE_LIBPTHREAD
+#endif
+#define HAVE_PTHREAD_H 0
+#if !HAVE_PTHREAD_H
+#undef HAVE_PTHREAD_H
+#endif
+
+/* Define if IPV6 support is there */
+#undef SUPPORT_IP6
+
+/* Define if getaddrinfo is there */
+#define HAVE_GETADDRINFO 0
+#if !HAVE_GETADDRINFO
+#undef HAVE_GETADDRINFO
+#endif
+
+/* Define to 1 if you have the <ansidecl.h> header file. */
+#define HAVE_ANSIDECL_H 0
+#if !HAVE_ANSIDECL_H
+#undef HAVE_ANSIDECL_H
+#endif
+
+/* Define to 1 if you have the <arpa/inet.h> header file. */
+#define HAVE_ARPA_INET_H 1
+#if !HAVE_ARPA_INET_H
+#undef HAVE_ARPA_INET_H
+#endif
+
+/* Define to 1 if you have the <arpa/nameser.h> header file. */
+#define HAVE_ARPA_NAMESER_H 1
+#if !HAVE_ARPA_NAMESER_H
+#undef HAVE_ARPA_NAMESER_H
+#endif
+
+/* Whether struct sockaddr::__ss_family exists */
+#define HAVE_BROKEN_SS_FAMILY 0
+#if !HAVE_BROKEN_SS_FAMILY
+#undef HAVE_BROKEN_SS_FAMILY
+#endif
+
+/* Define to 1 if you have the `class' function. */
+#define HAVE_CLASS 0
+#if !HAVE_CLASS
+#undef HAVE_CLASS
+#endif
+
+/* Define to 1 if you have the <ctype.h> header file. */
+#define HAVE_CTYPE_H 1
+#if !HAVE_CTYPE_H
+#undef HAVE_CTYPE_H
+#endif
+
+/* Define to 1 if you have the <dirent.h> header file. */
+#define HAVE_DIRENT_H 1
+#if !HAVE_DIRENT_H
+#undef HAVE_DIRENT_H
+#endif
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define HAVE_DLFCN_H 1
+#if !HAVE_DLFCN_H
+#undef HAVE_DLFCN_H
+#endif
+
+/* Have dlopen based dso */
+#define HAVE_DLOPEN 0
+#if !HAVE_DLOPEN
+#undef HAVE_DLOPEN
+#endif
+
+/* Define to 1 if you have the <dl.h> header file. */
+#define HAVE_DL_H 0
+#if !HAVE_DL_H
+#undef HAVE_DL_H
+#endif
+
+/* Define to 1 if you have the <errno.h> header file. */
+#define HAVE_ERRNO_H 1
+#if !HAVE_ERRNO_H
+#undef HAVE_ERRNO_H
+#endif
+
+/* Define to 1 if you have the <fcntl.h> header file. */
+#define HAVE_FCNTL_H 1
+#if !HAVE_FCNTL_H
+#undef HAVE_FCNTL_H
+#endif
+
+/* Define to 1 if you have the `finite' function. */
+#define HAVE_FINITE 1
+#if !HAVE_FINITE
+#undef HAVE_FINITE
+#endif
+
+/* Define to 1 if you have the <float.h> header file. */
+#define HAVE_FLOAT_H 1
+#if !HAVE_FLOAT_H
+#undef HAVE_FLOAT_H
+#endif
+
+/* Define to 1 if you have the `fpclass' function. */
+#define HAVE_FPCLASS 0
+#if !HAVE_FPCLASS
+#undef HAVE_FPCLASS
+#endif
+
+/* Define to 1 if you have the `fprintf' function. */
+#define HAVE_FPRINTF 1
+#if !HAVE_FPRINTF
+#undef HAVE_FPRINTF
+#endif
+
+/* Define to 1 if you have the `fp_class' function. */
+#define HAVE_FP_CLASS 0
+#if !HAVE_FP_CLASS
+#undef HAVE_FP_CLASS
+#endif
+
+/* Define to 1 if you have the <fp_class.h> header file. */
+#define HAVE_FP_CLASS_H 0
+#if !HAVE_FP_CLASS_H
+#undef HAVE_FP_CLASS_H
+#endif
+
+/* Define to 1 if you have the `ftime' function. */
+#define HAVE_FTIME 1
+#if !HAVE_FTIME
+#undef HAVE_FTIME
+#endif
+
+/* Define if getaddrinfo is there */
+#define HAVE_GETADDRINFO 0
+#if !HAVE_GETADDRINFO
+#undef HAVE_GETADDRINFO
+#endif
+
+/* Define to 1 if you have the `gettimeofday' function. */
+#define HAVE_GETTIMEOFDAY 1
+#if !HAVE_GETTIMEOFDAY
+#undef HAVE_GETTIMEOFDAY
+#endif
+
+/* Define to 1 if you have the <ieeefp.h> header file. */
+#define HAVE_IEEEFP_H 0
+#if !HAVE_IEEEFP_H
+#undef HAVE_IEEEFP_H
+#endif
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+#if !HAVE_INTTYPES_H
+#undef HAVE_INTTYPES_H
+#endif
+
+/* Define to 1 if you have the <inttypes.h.h> header file. */
+#define HAVE_INTTYPES_H_H 0
+#if !HAVE_INTTYPES_H_H
+#undef HAVE_INTTYPES_H_H
+#endif
+
+/* Define if isinf is there */
+#define HAVE_ISINF 0
+#if !HAVE_ISINF
+#undef HAVE_ISINF
+#endif
+
+/* Define if isnan is there */
+#define HAVE_ISNAN 0
+#if !HAVE_ISNAN
+#undef HAVE_ISNAN
+#endif
+
+/* Define to 1 if you have the `isnand' function. */
+#define HAVE_ISNAND 0
+#if !HAVE_ISNAND
+#undef HAVE_ISNAND
+#endif
+
+/* Define if history library is there (-lhistory) */
+#define HAVE_LIBHISTORY 0
+#if !HAVE_LIBHISTORY
+#undef HAVE_LIBHISTORY
+#endif
+
+/* Define if pthread library is there (-lpthread) */
+#define HAVE_LIBPTHREAD 0
+#if !HAVE_LIBPTHREAD
+#undef HAVE_LIBPTHREAD
+#endif
+
+/* Define if readline library is there (-lreadline) */
+#define HAVE_LIBREADLINE 0
+#if !HAVE_LIBREADLINE
+#undef HAVE_LIBREADLINE
+#endif
+
+/* Have compression library */
+#define HAVE_LIBZ 0
+#if !HAVE_LIBZ
+#undef HAVE_LIBZ
+#endif
+
+/* Define to 1 if you have the <limits.h> header file. */
+#define HAVE_LIMITS_H 1
+#if !HAVE_LIMITS_H
+#undef HAVE_LIMITS_H
+#endif
+
+/* Define to 1 if you have the `localtime' function. */
+#define HAVE_LOCALTIME 1
+#if !HAVE_LOCALTIME
+#undef HAVE_LOCALTIME
+#endif
+
+/* Define to 1 if you have the <malloc.h> header file. */
+#define HAVE_MALLOC_H 1
+#if !HAVE_MALLOC_H
+#undef HAVE_MALLOC_H
+#endif
+
+/* Define to 1 if you have the <math.h> header file. */
+#define HAVE_MATH_H 1
+#if !HAVE_MATH_H
+#undef HAVE_MATH_H
+#endif
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H 1
+#if !HAVE_MEMORY_H
+#undef HAVE_MEMORY_H
+#endif
+
+/* Define to 1 if you have the <nan.h> header file. */
+#define HAVE_NAN_H 0
+#if !HAVE_NAN_H
+#undef HAVE_NAN_H
+#endif
+
+/* Define to 1 if you have the <ndir.h> header file, and it defines `DIR'. */
+#define HAVE_NDIR_H 0
+#if !HAVE_NDIR_H
+#undef HAVE_NDIR_H
+#endif
+
+/* Define to 1 if you have the <netdb.h> header file. */
+#define HAVE_NETDB_H 1
+#if !HAVE_NETDB_H
+#undef HAVE_NETDB_H
+#endif
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define HAVE_NETINET_IN_H 1
+#if !HAVE_NETINET_IN_H
+#undef HAVE_NETINET_IN_H
+#endif
+
+/* Define to 1 if you have the <poll.h> header file. */
+#define HAVE_POLL_H 1
+#if !HAVE_POLL_H
+#undef HAVE_POLL_H
+#endif
+
+/* Define to 1 if you have the `printf' function. */
+#define HAVE_PRINTF 1
+#if !HAVE_PRINTF
+#undef HAVE_PRINTF
+#endif
+
+/* Define if <pthread.h> is there */
+#define HAVE_PTHREAD_H 0
+#if !HAVE_PTHREAD_H
+#undef HAVE_PTHREAD_H
+#endif
+
+/* Define to 1 if you have the <resolv.h> header file. */
+#define HAVE_RESOLV_H 1
+#if !HAVE_RESOLV_H
+#undef HAVE_RESOLV_H
+#endif
+
+/* Have shl_load based dso */
+#define HAVE_SHLLOAD 0
+#if !HAVE_SHLLOAD
+#undef HAVE_SHLLOAD
+#endif
+
+/* Define to 1 if you have the `signal' function. */
+#define HAVE_SIGNAL 1
+#if !HAVE_SIGNAL
+#undef HAVE_SIGNAL
+#endif
+
+/* Define to 1 if you have the <signal.h> header file. */
+#define HAVE_SIGNAL_H 1
+#if !HAVE_SIGNAL_H
+#undef HAVE_SIGNAL_H
+#endif
+
+/* Define to 1 if you have the `snprintf' function. */
+#define HAVE_SNPRINTF 1
+#if !HAVE_SNPRINTF
+#undef HAVE_SNPRINTF
+#endif
+
+/* Define to 1 if you have the `sprintf' function. */
+#define HAVE_SPRINTF 1
+#if !HAVE_SPRINTF
+#undef HAVE_SPRINTF
+#endif
+
+/* Define to 1 if you have the `sscanf' function. */
+#define HAVE_SSCANF 1
+#if !HAVE_SSCANF
+#undef HAVE_SSCANF
+#endif
+
+/* Define to 1 if you have the `stat' function. */
+#define HAVE_STAT 1
+#if !HAVE_STAT
+#undef HAVE_STAT
+#endif
+
+/* Define to 1 if you have the <stdarg.h> header file. */
+#define HAVE_STDARG_H 1
+#if !HAVE_STDARG_H
+#undef HAVE_STDARG_H
+#endif
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+#if !HAVE_STDINT_H
+#undef HAVE_STDINT_H
+#endif
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+#if !HAVE_STDLIB_H
+#undef HAVE_STDLIB_H
+#endif
+
+/* Define to 1 if you have the `strdup' function. */
+#define HAVE_STRDUP 1
+#if !HAVE_STRDUP
+#undef HAVE_STRDUP
+#endif
+
+/* Define to 1 if you have the `strerror' function. */
+#define HAVE_STRERROR 1
+#if !HAVE_STRERROR
+#undef HAVE_STRERROR
+#endif
+
+/* Define to 1 if you have the `strftime' function. */
+#define HAVE_STRFTIME 1
+#if !HAVE_STRFTIME
+#undef HAVE_STRFTIME
+#endif
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+#if !HAVE_STRINGS_H
+#undef HAVE_STRINGS_H
+#endif
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+#if !HAVE_STRING_H
+#undef HAVE_STRING_H
+#endif
+
+/* Define to 1 if you have the `strndup' function. */
+#define HAVE_STRNDUP 1
+#if !HAVE_STRNDUP
+#undef HAVE_STRNDUP
+#endif
+
+/* Define to 1 if you have the <sys/dir.h> header file, and it defines `DIR'.
+   */
+#define HAVE_SYS_DIR_H 1
+#if !HAVE_SYS_DIR_H
+#undef HAVE_SYS_DIR_H
+#endif
+
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#define HAVE_SYS_MMAN_H 1
+#if !HAVE_SYS_MMAN_H
+#undef HAVE_SYS_MMAN_H
+#endif
+
+/* Define to 1 if you have the <sys/ndir.h> header file, and it defines `DIR'.
+   */
+#define HAVE_SYS_NDIR_H 0
+#if !HAVE_SYS_NDIR_H
+#undef HAVE_SYS_NDIR_H
+#endif
+
+/* Define to 1 if you have the <sys/select.h> header file. */
+#define HAVE_SYS_SELECT_H 1
+#if !HAVE_SYS_SELECT_H
+#undef HAVE_SYS_SELECT_H
+#endif
+
+/* Define to 1 if you have the <sys/socket.h> header file. */
+#define HAVE_SYS_SOCKET_H 1
+#if !HAVE_SYS_SOCKET_H
+#undef HAVE_SYS_SOCKET_H
+#endif
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+#if !HAVE_SYS_STAT_H
+#undef HAVE_SYS_STAT_H
+#endif
+
+/* Define to 1 if you have the <sys/timeb.h> header file. */
+#define HAVE_SYS_TIMEB_H 1
+#if !HAVE_SYS_TIMEB_H
+#undef HAVE_SYS_TIMEB_H
+#endif
+
+/* Define to 1 if you have the <sys/time.h> header file. */
+#define HAVE_SYS_TIME_H 1
+#if !HAVE_SYS_TIME_H
+#undef HAVE_SYS_TIME_H
+#endif
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+#if !HAVE_SYS_TYPES_H
+#undef HAVE_SYS_TYPES_H
+#endif
+
+/* Define to 1 if you have the <time.h> header file. */
+#define HAVE_TIME_H 1
+#if !HAVE_TIME_H
+#undef HAVE_TIME_H
+#endif
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+#if !HAVE_UNISTD_H
+#undef HAVE_UNISTD_H
+#endif
+
+/* Whether va_copy() is available */
+#define HAVE_VA_COPY 0
+#if !HAVE_VA_COPY
+#undef HAVE_VA_COPY
+#endif
+
+/* Define to 1 if you have the `vfprintf' function. */
+#define HAVE_VFPRINTF 1
+#if !HAVE_VFPRINTF
+#undef HAVE_VFPRINTF
+#endif
+
+/* Define to 1 if you have the `vsnprintf' function. */
+#define HAVE_VSNPRINTF 1
+#if !HAVE_VSNPRINTF
+#undef HAVE_VSNPRINTF
+#endif
+
+/* Define to 1 if you have the `vsprintf' function. */
+#define HAVE_VSPRINTF 1
+#if !HAVE_VSPRINTF
+#undef HAVE_VSPRINTF
+#endif
+
+/* Define to 1 if you have the <zlib.h> header file. */
+#define HAVE_ZLIB_H 1
+#if !HAVE_ZLIB_H
+#undef HAVE_ZLIB_H
+#endif
+
+/* Define to 1 if you have the `_stat' function. */
+#define HAVE__STAT 0
+#if !HAVE__STAT
+#undef HAVE__STAT
+#endif
+
+/* Whether __va_copy() is available */
+#define HAVE___VA_COPY 0
+#if !HAVE___VA_COPY
+#undef HAVE___VA_COPY
+#endif
+
+/* Define as const if the declaration of iconv() needs const. */
+#undef ICONV_CONST
+
+/* Define to the sub-directory in which libtool stores uninstalled libraries.
+   */
+#undef LT_OBJDIR
+
+/* Name of package */
+#undef PACKAGE
+
+/* Define to the address where bug reports for this package should be sent. */
+#undef PACKAGE_BUGREPORT
+
+/* Define to the full name of this package. */
+#undef PACKAGE_NAME
+
+/* Define to the full name and version of this package. */
+#undef PACKAGE_STRING
+
+/* Define to the one symbol short name of this package. */
+#undef PACKAGE_TARNAME
+
+/* Define to the home page for this package. */
+#undef PACKAGE_URL
+
+/* Define to the version of this package. */
+#undef PACKAGE_VERSION
+
+/* Define to 1 if the C compiler supports function prototypes. */
+#undef PROTOTYPES
+
+/* Define to 1 if you have the ANSI C header files. */
+#undef STDC_HEADERS
+
+/* Support for IPv6 */
+#undef SUPPORT_IP6
+
+/* Version number of package */
+#undef VERSION
+
+/* Determine what socket length (socklen_t) data type is */
+#undef XML_SOCKLEN_T
+
+/* Using the Win32 Socket implementation */
+#undef _WINSOCKAPI_
+
+/* Define like PROTOTYPES this can be used by system headers. */
+#undef __PROTOTYPES
+
+/* Win32 Std C name mangling work-around */
+#undef snprintf
+
+/* ss_family is not defined here, use __ss_family instead */
+#undef ss_family
+
+/* Win32 Std C name mangling work-around */
+#undef vsnprintf
+ 
+#define ICONV_CONST const 
+#define HAVE_VA_COPY 1 
+#undef  HAVE_ZLIB_H 
+#if defined(WIN32) && defined(NEED_SOCKETS) 
+#include <wsockcompat.h> 
+#endif 
+#undef  HAVE_PTHREAD_H 
+#define HAVE_PTHREAD_H 1 
+#undef  HAVE_LIBPTHREAD 
+#define HAVE_LIBPTHREAD 1
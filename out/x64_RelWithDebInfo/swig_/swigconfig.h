@@ -0,0 +1,10 @@
+
+#include <stdbool.h>
+#define HAVE_BOOL
+
+#define PACKAGE_BUGREPORT   "nobody"
+#define PACKAGE_VERSION     "3.0.7"
+#define SWIG_CXX            "GNU"
+#define SWIG_LIB            ""
+#define SWIG_LIB_WIN_UNIX   ""
+#define SWIG_PLATFORM       "Linux"
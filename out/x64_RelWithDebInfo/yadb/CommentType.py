@@ -0,0 +1,12 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+class CommentType(object):
+    Unknown = 0
+    Repeatable = 1
+    NonRepeatable = 2
+    Anterior = 3
+    Posterior = 4
+    Bookmark = 5
+
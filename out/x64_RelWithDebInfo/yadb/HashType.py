@@ -0,0 +1,10 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+class HashType(object):
+    Unknown = 0
+    None = 1
+    Crc32 = 2
+    Md5 = 3
+
@@ -0,0 +1,27 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+import flatbuffers
+
+class HiddenArea(object):
+    __slots__ = ['_tab']
+
+    # HiddenArea
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # HiddenArea
+    def Offset(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(0))
+    # HiddenArea
+    def AreaSize(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(8))
+    # HiddenArea
+    def Value(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(16))
+
+def CreateHiddenArea(builder, offset, areaSize, value):
+    builder.Prep(8, 24)
+    builder.Pad(4)
+    builder.PrependUint32(value)
+    builder.PrependUint64(areaSize)
+    builder.PrependUint64(offset)
+    return builder.Offset()
@@ -0,0 +1,13 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: yadb
+
+class SignatureMethod(object):
+    Unknown = 0
+    FirstByte = 1
+    Full = 2
+    Invariants = 3
+    OpCode = 4
+    IntraGraph = 5
+    String = 6
+
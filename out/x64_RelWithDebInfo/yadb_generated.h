@@ -0,0 +1,1106 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_YADB_YADB_H_
+#define FLATBUFFERS_GENERATED_YADB_YADB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace yadb {
+
+struct Comment;
+
+struct ValueView;
+
+struct RegisterView;
+
+struct HiddenArea;
+
+struct UserName;
+
+struct Attribute;
+
+struct Blob;
+
+struct Xref;
+
+struct Signature;
+
+struct FunctionSummary;
+
+struct Version;
+
+struct Root;
+
+enum HashType {
+  HashType_Unknown = 0,
+  HashType_None = 1,
+  HashType_Crc32 = 2,
+  HashType_Md5 = 3,
+  HashType_MIN = HashType_Unknown,
+  HashType_MAX = HashType_Md5
+};
+
+inline HashType (&EnumValuesHashType())[4] {
+  static HashType values[] = {
+    HashType_Unknown,
+    HashType_None,
+    HashType_Crc32,
+    HashType_Md5
+  };
+  return values;
+}
+
+inline const char **EnumNamesHashType() {
+  static const char *names[] = {
+    "Unknown",
+    "None",
+    "Crc32",
+    "Md5",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameHashType(HashType e) {
+  const size_t index = static_cast<int>(e);
+  return EnumNamesHashType()[index];
+}
+
+enum SignatureMethod {
+  SignatureMethod_Unknown = 0,
+  SignatureMethod_FirstByte = 1,
+  SignatureMethod_Full = 2,
+  SignatureMethod_Invariants = 3,
+  SignatureMethod_OpCode = 4,
+  SignatureMethod_IntraGraph = 5,
+  SignatureMethod_String = 6,
+  SignatureMethod_MIN = SignatureMethod_Unknown,
+  SignatureMethod_MAX = SignatureMethod_String
+};
+
+inline SignatureMethod (&EnumValuesSignatureMethod())[7] {
+  static SignatureMethod values[] = {
+    SignatureMethod_Unknown,
+    SignatureMethod_FirstByte,
+    SignatureMethod_Full,
+    SignatureMethod_Invariants,
+    SignatureMethod_OpCode,
+    SignatureMethod_IntraGraph,
+    SignatureMethod_String
+  };
+  return values;
+}
+
+inline const char **EnumNamesSignatureMethod() {
+  static const char *names[] = {
+    "Unknown",
+    "FirstByte",
+    "Full",
+    "Invariants",
+    "OpCode",
+    "IntraGraph",
+    "String",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameSignatureMethod(SignatureMethod e) {
+  const size_t index = static_cast<int>(e);
+  return EnumNamesSignatureMethod()[index];
+}
+
+enum CommentType {
+  CommentType_Unknown = 0,
+  CommentType_Repeatable = 1,
+  CommentType_NonRepeatable = 2,
+  CommentType_Anterior = 3,
+  CommentType_Posterior = 4,
+  CommentType_Bookmark = 5,
+  CommentType_MIN = CommentType_Unknown,
+  CommentType_MAX = CommentType_Bookmark
+};
+
+inline CommentType (&EnumValuesCommentType())[6] {
+  static CommentType values[] = {
+    CommentType_Unknown,
+    CommentType_Repeatable,
+    CommentType_NonRepeatable,
+    CommentType_Anterior,
+    CommentType_Posterior,
+    CommentType_Bookmark
+  };
+  return values;
+}
+
+inline const char **EnumNamesCommentType() {
+  static const char *names[] = {
+    "Unknown",
+    "Repeatable",
+    "NonRepeatable",
+    "Anterior",
+    "Posterior",
+    "Bookmark",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCommentType(CommentType e) {
+  const size_t index = static_cast<int>(e);
+  return EnumNamesCommentType()[index];
+}
+
+MANUALLY_ALIGNED_STRUCT(8) Comment FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t offset_;
+  uint32_t value_;
+  int8_t type_;
+  int8_t padding0__;  int16_t padding1__;
+
+ public:
+  Comment() {
+    memset(this, 0, sizeof(Comment));
+  }
+  Comment(uint64_t _offset, uint32_t _value, CommentType _type)
+      : offset_(flatbuffers::EndianScalar(_offset)),
+        value_(flatbuffers::EndianScalar(_value)),
+        type_(flatbuffers::EndianScalar(static_cast<int8_t>(_type))),
+        padding0__(0),
+        padding1__(0) {
+    (void)padding0__;    (void)padding1__;
+  }
+  uint64_t offset() const {
+    return flatbuffers::EndianScalar(offset_);
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+  CommentType type() const {
+    return static_cast<CommentType>(flatbuffers::EndianScalar(type_));
+  }
+};
+STRUCT_END(Comment, 16);
+
+MANUALLY_ALIGNED_STRUCT(8) ValueView FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t offset_;
+  uint32_t value_;
+  uint8_t operand_;
+  int8_t padding0__;  int16_t padding1__;
+
+ public:
+  ValueView() {
+    memset(this, 0, sizeof(ValueView));
+  }
+  ValueView(uint64_t _offset, uint32_t _value, uint8_t _operand)
+      : offset_(flatbuffers::EndianScalar(_offset)),
+        value_(flatbuffers::EndianScalar(_value)),
+        operand_(flatbuffers::EndianScalar(_operand)),
+        padding0__(0),
+        padding1__(0) {
+    (void)padding0__;    (void)padding1__;
+  }
+  uint64_t offset() const {
+    return flatbuffers::EndianScalar(offset_);
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+  uint8_t operand() const {
+    return flatbuffers::EndianScalar(operand_);
+  }
+};
+STRUCT_END(ValueView, 16);
+
+MANUALLY_ALIGNED_STRUCT(8) RegisterView FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t offset_;
+  uint64_t end_offset_;
+  uint32_t register_name_;
+  uint32_t register_new_name_;
+
+ public:
+  RegisterView() {
+    memset(this, 0, sizeof(RegisterView));
+  }
+  RegisterView(uint64_t _offset, uint64_t _end_offset, uint32_t _register_name, uint32_t _register_new_name)
+      : offset_(flatbuffers::EndianScalar(_offset)),
+        end_offset_(flatbuffers::EndianScalar(_end_offset)),
+        register_name_(flatbuffers::EndianScalar(_register_name)),
+        register_new_name_(flatbuffers::EndianScalar(_register_new_name)) {
+  }
+  uint64_t offset() const {
+    return flatbuffers::EndianScalar(offset_);
+  }
+  uint64_t end_offset() const {
+    return flatbuffers::EndianScalar(end_offset_);
+  }
+  uint32_t register_name() const {
+    return flatbuffers::EndianScalar(register_name_);
+  }
+  uint32_t register_new_name() const {
+    return flatbuffers::EndianScalar(register_new_name_);
+  }
+};
+STRUCT_END(RegisterView, 24);
+
+MANUALLY_ALIGNED_STRUCT(8) HiddenArea FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t offset_;
+  uint64_t area_size_;
+  uint32_t value_;
+  int32_t padding0__;
+
+ public:
+  HiddenArea() {
+    memset(this, 0, sizeof(HiddenArea));
+  }
+  HiddenArea(uint64_t _offset, uint64_t _area_size, uint32_t _value)
+      : offset_(flatbuffers::EndianScalar(_offset)),
+        area_size_(flatbuffers::EndianScalar(_area_size)),
+        value_(flatbuffers::EndianScalar(_value)),
+        padding0__(0) {
+    (void)padding0__;
+  }
+  uint64_t offset() const {
+    return flatbuffers::EndianScalar(offset_);
+  }
+  uint64_t area_size() const {
+    return flatbuffers::EndianScalar(area_size_);
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+};
+STRUCT_END(HiddenArea, 24);
+
+MANUALLY_ALIGNED_STRUCT(4) UserName FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t flags_;
+  uint32_t value_;
+
+ public:
+  UserName() {
+    memset(this, 0, sizeof(UserName));
+  }
+  UserName(uint32_t _flags, uint32_t _value)
+      : flags_(flatbuffers::EndianScalar(_flags)),
+        value_(flatbuffers::EndianScalar(_value)) {
+  }
+  uint32_t flags() const {
+    return flatbuffers::EndianScalar(flags_);
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+};
+STRUCT_END(UserName, 8);
+
+MANUALLY_ALIGNED_STRUCT(4) Attribute FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t key_;
+  uint32_t value_;
+
+ public:
+  Attribute() {
+    memset(this, 0, sizeof(Attribute));
+  }
+  Attribute(uint32_t _key, uint32_t _value)
+      : key_(flatbuffers::EndianScalar(_key)),
+        value_(flatbuffers::EndianScalar(_value)) {
+  }
+  uint32_t key() const {
+    return flatbuffers::EndianScalar(key_);
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+};
+STRUCT_END(Attribute, 8);
+
+MANUALLY_ALIGNED_STRUCT(4) Signature FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t value_;
+  int8_t type_;
+  int8_t method_;
+  int16_t padding0__;
+
+ public:
+  Signature() {
+    memset(this, 0, sizeof(Signature));
+  }
+  Signature(uint32_t _value, HashType _type, SignatureMethod _method)
+      : value_(flatbuffers::EndianScalar(_value)),
+        type_(flatbuffers::EndianScalar(static_cast<int8_t>(_type))),
+        method_(flatbuffers::EndianScalar(static_cast<int8_t>(_method))),
+        padding0__(0) {
+    (void)padding0__;
+  }
+  uint32_t value() const {
+    return flatbuffers::EndianScalar(value_);
+  }
+  HashType type() const {
+    return static_cast<HashType>(flatbuffers::EndianScalar(type_));
+  }
+  SignatureMethod method() const {
+    return static_cast<SignatureMethod>(flatbuffers::EndianScalar(method_));
+  }
+};
+STRUCT_END(Signature, 8);
+
+MANUALLY_ALIGNED_STRUCT(8) FunctionSummary FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t size_;
+  uint64_t frame_size_;
+  uint32_t basic_blocks_;
+  uint32_t edges_;
+  uint32_t callees_;
+  uint32_t callers_;
+
+ public:
+  FunctionSummary() {
+    memset(this, 0, sizeof(FunctionSummary));
+  }
+  FunctionSummary(uint64_t _size, uint64_t _frame_size, uint32_t _basic_blocks, uint32_t _edges, uint32_t _callees, uint32_t _callers)
+      : size_(flatbuffers::EndianScalar(_size)),
+        frame_size_(flatbuffers::EndianScalar(_frame_size)),
+        basic_blocks_(flatbuffers::EndianScalar(_basic_blocks)),
+        edges_(flatbuffers::EndianScalar(_edges)),
+        callees_(flatbuffers::EndianScalar(_callees)),
+        callers_(flatbuffers::EndianScalar(_callers)) {
+  }
+  uint64_t size() const {
+    return flatbuffers::EndianScalar(size_);
+  }
+  uint64_t frame_size() const {
+    return flatbuffers::EndianScalar(frame_size_);
+  }
+  uint32_t basic_blocks() const {
+    return flatbuffers::EndianScalar(basic_blocks_);
+  }
+  uint32_t edges() const {
+    return flatbuffers::EndianScalar(edges_);
+  }
+  uint32_t callees() const {
+    return flatbuffers::EndianScalar(callees_);
+  }
+  uint32_t callers() const {
+    return flatbuffers::EndianScalar(callers_);
+  }
+};
+STRUCT_END(FunctionSummary, 32);
+
+struct Blob FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_OFFSET = 4,
+    VT_DATA = 6
+  };
+  uint64_t offset() const {
+    return GetField<uint64_t>(VT_OFFSET, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_OFFSET) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.Verify(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlobBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_offset(uint64_t offset) {
+    fbb_.AddElement<uint64_t>(Blob::VT_OFFSET, offset, 0);
+  }
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(Blob::VT_DATA, data);
+  }
+  explicit BlobBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BlobBuilder &operator=(const BlobBuilder &);
+  flatbuffers::Offset<Blob> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Blob>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Blob> CreateBlob(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t offset = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  BlobBuilder builder_(_fbb);
+  builder_.add_offset(offset);
+  builder_.add_data(data);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Blob> CreateBlobDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t offset = 0,
+    const std::vector<uint8_t> *data = nullptr) {
+  return yadb::CreateBlob(
+      _fbb,
+      offset,
+      data ? _fbb.CreateVector<uint8_t>(*data) : 0);
+}
+
+struct Xref FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_OFFSET = 4,
+    VT_ID = 6,
+    VT_OPERAND = 8,
+    VT_ATTRIBUTES = 10
+  };
+  uint64_t offset() const {
+    return GetField<uint64_t>(VT_OFFSET, 0);
+  }
+  uint64_t id() const {
+    return GetField<uint64_t>(VT_ID, 0);
+  }
+  uint8_t operand() const {
+    return GetField<uint8_t>(VT_OPERAND, 0);
+  }
+  const flatbuffers::Vector<const Attribute *> *attributes() const {
+    return GetPointer<const flatbuffers::Vector<const Attribute *> *>(VT_ATTRIBUTES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_OFFSET) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           VerifyField<uint8_t>(verifier, VT_OPERAND) &&
+           VerifyOffset(verifier, VT_ATTRIBUTES) &&
+           verifier.Verify(attributes()) &&
+           verifier.EndTable();
+  }
+};
+
+struct XrefBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_offset(uint64_t offset) {
+    fbb_.AddElement<uint64_t>(Xref::VT_OFFSET, offset, 0);
+  }
+  void add_id(uint64_t id) {
+    fbb_.AddElement<uint64_t>(Xref::VT_ID, id, 0);
+  }
+  void add_operand(uint8_t operand) {
+    fbb_.AddElement<uint8_t>(Xref::VT_OPERAND, operand, 0);
+  }
+  void add_attributes(flatbuffers::Offset<flatbuffers::Vector<const Attribute *>> attributes) {
+    fbb_.AddOffset(Xref::VT_ATTRIBUTES, attributes);
+  }
+  explicit XrefBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  XrefBuilder &operator=(const XrefBuilder &);
+  flatbuffers::Offset<Xref> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Xref>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Xref> CreateXref(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t offset = 0,
+    uint64_t id = 0,
+    uint8_t operand = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Attribute *>> attributes = 0) {
+  XrefBuilder builder_(_fbb);
+  builder_.add_id(id);
+  builder_.add_offset(offset);
+  builder_.add_attributes(attributes);
+  builder_.add_operand(operand);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Xref> CreateXrefDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t offset = 0,
+    uint64_t id = 0,
+    uint8_t operand = 0,
+    const std::vector<const Attribute *> *attributes = nullptr) {
+  return yadb::CreateXref(
+      _fbb,
+      offset,
+      id,
+      operand,
+      attributes ? _fbb.CreateVector<const Attribute *>(*attributes) : 0);
+}
+
+struct Version FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_OBJECT_ID = 4,
+    VT_PARENT_ID = 6,
+    VT_ADDRESS = 8,
+    VT_FLAGS = 10,
+    VT_PROTOTYPE = 12,
+    VT_SIZE = 14,
+    VT_USERNAME = 16,
+    VT_HEADER_COMMENT_REPEATABLE = 18,
+    VT_HEADER_COMMENT_NONREPEATABLE = 20,
+    VT_STRING_TYPE = 22,
+    VT_ATTRIBUTES = 24,
+    VT_BLOBS = 26,
+    VT_COMMENTS = 28,
+    VT_VALUEVIEWS = 30,
+    VT_REGISTERVIEWS = 32,
+    VT_HIDDENAREAS = 34,
+    VT_XREFS = 36,
+    VT_SIGNATURES = 38
+  };
+  uint64_t object_id() const {
+    return GetField<uint64_t>(VT_OBJECT_ID, 0);
+  }
+  uint64_t parent_id() const {
+    return GetField<uint64_t>(VT_PARENT_ID, 0);
+  }
+  uint64_t address() const {
+    return GetField<uint64_t>(VT_ADDRESS, 0);
+  }
+  uint32_t flags() const {
+    return GetField<uint32_t>(VT_FLAGS, 0);
+  }
+  uint32_t prototype() const {
+    return GetField<uint32_t>(VT_PROTOTYPE, 0);
+  }
+  uint32_t size() const {
+    return GetField<uint32_t>(VT_SIZE, 0);
+  }
+  const UserName *username() const {
+    return GetStruct<const UserName *>(VT_USERNAME);
+  }
+  uint32_t header_comment_repeatable() const {
+    return GetField<uint32_t>(VT_HEADER_COMMENT_REPEATABLE, 0);
+  }
+  uint32_t header_comment_nonrepeatable() const {
+    return GetField<uint32_t>(VT_HEADER_COMMENT_NONREPEATABLE, 0);
+  }
+  uint8_t string_type() const {
+    return GetField<uint8_t>(VT_STRING_TYPE, 0);
+  }
+  const flatbuffers::Vector<const Attribute *> *attributes() const {
+    return GetPointer<const flatbuffers::Vector<const Attribute *> *>(VT_ATTRIBUTES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Blob>> *blobs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Blob>> *>(VT_BLOBS);
+  }
+  const flatbuffers::Vector<const Comment *> *comments() const {
+    return GetPointer<const flatbuffers::Vector<const Comment *> *>(VT_COMMENTS);
+  }
+  const flatbuffers::Vector<const ValueView *> *valueviews() const {
+    return GetPointer<const flatbuffers::Vector<const ValueView *> *>(VT_VALUEVIEWS);
+  }
+  const flatbuffers::Vector<const RegisterView *> *registerviews() const {
+    return GetPointer<const flatbuffers::Vector<const RegisterView *> *>(VT_REGISTERVIEWS);
+  }
+  const flatbuffers::Vector<const HiddenArea *> *hiddenareas() const {
+    return GetPointer<const flatbuffers::Vector<const HiddenArea *> *>(VT_HIDDENAREAS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Xref>> *xrefs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Xref>> *>(VT_XREFS);
+  }
+  const flatbuffers::Vector<const Signature *> *signatures() const {
+    return GetPointer<const flatbuffers::Vector<const Signature *> *>(VT_SIGNATURES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_OBJECT_ID) &&
+           VerifyField<uint64_t>(verifier, VT_PARENT_ID) &&
+           VerifyField<uint64_t>(verifier, VT_ADDRESS) &&
+           VerifyField<uint32_t>(verifier, VT_FLAGS) &&
+           VerifyField<uint32_t>(verifier, VT_PROTOTYPE) &&
+           VerifyField<uint32_t>(verifier, VT_SIZE) &&
+           VerifyField<UserName>(verifier, VT_USERNAME) &&
+           VerifyField<uint32_t>(verifier, VT_HEADER_COMMENT_REPEATABLE) &&
+           VerifyField<uint32_t>(verifier, VT_HEADER_COMMENT_NONREPEATABLE) &&
+           VerifyField<uint8_t>(verifier, VT_STRING_TYPE) &&
+           VerifyOffset(verifier, VT_ATTRIBUTES) &&
+           verifier.Verify(attributes()) &&
+           VerifyOffset(verifier, VT_BLOBS) &&
+           verifier.Verify(blobs()) &&
+           verifier.VerifyVectorOfTables(blobs()) &&
+           VerifyOffset(verifier, VT_COMMENTS) &&
+           verifier.Verify(comments()) &&
+           VerifyOffset(verifier, VT_VALUEVIEWS) &&
+           verifier.Verify(valueviews()) &&
+           VerifyOffset(verifier, VT_REGISTERVIEWS) &&
+           verifier.Verify(registerviews()) &&
+           VerifyOffset(verifier, VT_HIDDENAREAS) &&
+           verifier.Verify(hiddenareas()) &&
+           VerifyOffset(verifier, VT_XREFS) &&
+           verifier.Verify(xrefs()) &&
+           verifier.VerifyVectorOfTables(xrefs()) &&
+           VerifyOffset(verifier, VT_SIGNATURES) &&
+           verifier.Verify(signatures()) &&
+           verifier.EndTable();
+  }
+};
+
+struct VersionBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_object_id(uint64_t object_id) {
+    fbb_.AddElement<uint64_t>(Version::VT_OBJECT_ID, object_id, 0);
+  }
+  void add_parent_id(uint64_t parent_id) {
+    fbb_.AddElement<uint64_t>(Version::VT_PARENT_ID, parent_id, 0);
+  }
+  void add_address(uint64_t address) {
+    fbb_.AddElement<uint64_t>(Version::VT_ADDRESS, address, 0);
+  }
+  void add_flags(uint32_t flags) {
+    fbb_.AddElement<uint32_t>(Version::VT_FLAGS, flags, 0);
+  }
+  void add_prototype(uint32_t prototype) {
+    fbb_.AddElement<uint32_t>(Version::VT_PROTOTYPE, prototype, 0);
+  }
+  void add_size(uint32_t size) {
+    fbb_.AddElement<uint32_t>(Version::VT_SIZE, size, 0);
+  }
+  void add_username(const UserName *username) {
+    fbb_.AddStruct(Version::VT_USERNAME, username);
+  }
+  void add_header_comment_repeatable(uint32_t header_comment_repeatable) {
+    fbb_.AddElement<uint32_t>(Version::VT_HEADER_COMMENT_REPEATABLE, header_comment_repeatable, 0);
+  }
+  void add_header_comment_nonrepeatable(uint32_t header_comment_nonrepeatable) {
+    fbb_.AddElement<uint32_t>(Version::VT_HEADER_COMMENT_NONREPEATABLE, header_comment_nonrepeatable, 0);
+  }
+  void add_string_type(uint8_t string_type) {
+    fbb_.AddElement<uint8_t>(Version::VT_STRING_TYPE, string_type, 0);
+  }
+  void add_attributes(flatbuffers::Offset<flatbuffers::Vector<const Attribute *>> attributes) {
+    fbb_.AddOffset(Version::VT_ATTRIBUTES, attributes);
+  }
+  void add_blobs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Blob>>> blobs) {
+    fbb_.AddOffset(Version::VT_BLOBS, blobs);
+  }
+  void add_comments(flatbuffers::Offset<flatbuffers::Vector<const Comment *>> comments) {
+    fbb_.AddOffset(Version::VT_COMMENTS, comments);
+  }
+  void add_valueviews(flatbuffers::Offset<flatbuffers::Vector<const ValueView *>> valueviews) {
+    fbb_.AddOffset(Version::VT_VALUEVIEWS, valueviews);
+  }
+  void add_registerviews(flatbuffers::Offset<flatbuffers::Vector<const RegisterView *>> registerviews) {
+    fbb_.AddOffset(Version::VT_REGISTERVIEWS, registerviews);
+  }
+  void add_hiddenareas(flatbuffers::Offset<flatbuffers::Vector<const HiddenArea *>> hiddenareas) {
+    fbb_.AddOffset(Version::VT_HIDDENAREAS, hiddenareas);
+  }
+  void add_xrefs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Xref>>> xrefs) {
+    fbb_.AddOffset(Version::VT_XREFS, xrefs);
+  }
+  void add_signatures(flatbuffers::Offset<flatbuffers::Vector<const Signature *>> signatures) {
+    fbb_.AddOffset(Version::VT_SIGNATURES, signatures);
+  }
+  explicit VersionBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  VersionBuilder &operator=(const VersionBuilder &);
+  flatbuffers::Offset<Version> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Version>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Version> CreateVersion(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t object_id = 0,
+    uint64_t parent_id = 0,
+    uint64_t address = 0,
+    uint32_t flags = 0,
+    uint32_t prototype = 0,
+    uint32_t size = 0,
+    const UserName *username = 0,
+    uint32_t header_comment_repeatable = 0,
+    uint32_t header_comment_nonrepeatable = 0,
+    uint8_t string_type = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Attribute *>> attributes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Blob>>> blobs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Comment *>> comments = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const ValueView *>> valueviews = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const RegisterView *>> registerviews = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const HiddenArea *>> hiddenareas = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Xref>>> xrefs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Signature *>> signatures = 0) {
+  VersionBuilder builder_(_fbb);
+  builder_.add_address(address);
+  builder_.add_parent_id(parent_id);
+  builder_.add_object_id(object_id);
+  builder_.add_signatures(signatures);
+  builder_.add_xrefs(xrefs);
+  builder_.add_hiddenareas(hiddenareas);
+  builder_.add_registerviews(registerviews);
+  builder_.add_valueviews(valueviews);
+  builder_.add_comments(comments);
+  builder_.add_blobs(blobs);
+  builder_.add_attributes(attributes);
+  builder_.add_header_comment_nonrepeatable(header_comment_nonrepeatable);
+  builder_.add_header_comment_repeatable(header_comment_repeatable);
+  builder_.add_username(username);
+  builder_.add_size(size);
+  builder_.add_prototype(prototype);
+  builder_.add_flags(flags);
+  builder_.add_string_type(string_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Version> CreateVersionDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t object_id = 0,
+    uint64_t parent_id = 0,
+    uint64_t address = 0,
+    uint32_t flags = 0,
+    uint32_t prototype = 0,
+    uint32_t size = 0,
+    const UserName *username = 0,
+    uint32_t header_comment_repeatable = 0,
+    uint32_t header_comment_nonrepeatable = 0,
+    uint8_t string_type = 0,
+    const std::vector<const Attribute *> *attributes = nullptr,
+    const std::vector<flatbuffers::Offset<Blob>> *blobs = nullptr,
+    const std::vector<const Comment *> *comments = nullptr,
+    const std::vector<const ValueView *> *valueviews = nullptr,
+    const std::vector<const RegisterView *> *registerviews = nullptr,
+    const std::vector<const HiddenArea *> *hiddenareas = nullptr,
+    const std::vector<flatbuffers::Offset<Xref>> *xrefs = nullptr,
+    const std::vector<const Signature *> *signatures = nullptr) {
+  return yadb::CreateVersion(
+      _fbb,
+      object_id,
+      parent_id,
+      address,
+      flags,
+      prototype,
+      size,
+      username,
+      header_comment_repeatable,
+      header_comment_nonrepeatable,
+      string_type,
+      attributes ? _fbb.CreateVector<const Attribute *>(*attributes) : 0,
+      blobs ? _fbb.CreateVector<flatbuffers::Offset<Blob>>(*blobs) : 0,
+      comments ? _fbb.CreateVector<const Comment *>(*comments) : 0,
+      valueviews ? _fbb.CreateVector<const ValueView *>(*valueviews) : 0,
+      registerviews ? _fbb.CreateVector<const RegisterView *>(*registerviews) : 0,
+      hiddenareas ? _fbb.CreateVector<const HiddenArea *>(*hiddenareas) : 0,
+      xrefs ? _fbb.CreateVector<flatbuffers::Offset<Xref>>(*xrefs) : 0,
+      signatures ? _fbb.CreateVector<const Signature *>(*signatures) : 0);
+}
+
+struct Root FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_BINARIES = 4,
+    VT_STRUCTS = 6,
+    VT_STRUCT_MEMBERS = 8,
+    VT_ENUMS = 10,
+    VT_ENUM_MEMBERS = 12,
+    VT_SEGMENTS = 14,
+    VT_SEGMENT_CHUNKS = 16,
+    VT_FUNCTIONS = 18,
+    VT_STACKFRAMES = 20,
+    VT_STACKFRAME_MEMBERS = 22,
+    VT_REFERENCE_INFOS = 24,
+    VT_CODES = 26,
+    VT_DATAS = 28,
+    VT_BASIC_BLOCKS = 30,
+    VT_LOCAL_TYPES = 32,
+    VT_STRINGS = 34,
+    VT_FUNCTION_SUMMARIES = 36
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *binaries() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_BINARIES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *structs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_STRUCTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *struct_members() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_STRUCT_MEMBERS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *enums() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_ENUMS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *enum_members() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_ENUM_MEMBERS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *segments() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_SEGMENTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *segment_chunks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_SEGMENT_CHUNKS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *functions() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_FUNCTIONS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *stackframes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_STACKFRAMES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *stackframe_members() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_STACKFRAME_MEMBERS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *reference_infos() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_REFERENCE_INFOS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *codes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_CODES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *datas() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_DATAS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *basic_blocks() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_BASIC_BLOCKS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Version>> *local_types() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Version>> *>(VT_LOCAL_TYPES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *strings() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_STRINGS);
+  }
+  const flatbuffers::Vector<const FunctionSummary *> *function_summaries() const {
+    return GetPointer<const flatbuffers::Vector<const FunctionSummary *> *>(VT_FUNCTION_SUMMARIES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BINARIES) &&
+           verifier.Verify(binaries()) &&
+           verifier.VerifyVectorOfTables(binaries()) &&
+           VerifyOffset(verifier, VT_STRUCTS) &&
+           verifier.Verify(structs()) &&
+           verifier.VerifyVectorOfTables(structs()) &&
+           VerifyOffset(verifier, VT_STRUCT_MEMBERS) &&
+           verifier.Verify(struct_members()) &&
+           verifier.VerifyVectorOfTables(struct_members()) &&
+           VerifyOffset(verifier, VT_ENUMS) &&
+           verifier.Verify(enums()) &&
+           verifier.VerifyVectorOfTables(enums()) &&
+           VerifyOffset(verifier, VT_ENUM_MEMBERS) &&
+           verifier.Verify(enum_members()) &&
+           verifier.VerifyVectorOfTables(enum_members()) &&
+           VerifyOffset(verifier, VT_SEGMENTS) &&
+           verifier.Verify(segments()) &&
+           verifier.VerifyVectorOfTables(segments()) &&
+           VerifyOffset(verifier, VT_SEGMENT_CHUNKS) &&
+           verifier.Verify(segment_chunks()) &&
+           verifier.VerifyVectorOfTables(segment_chunks()) &&
+           VerifyOffset(verifier, VT_FUNCTIONS) &&
+           verifier.Verify(functions()) &&
+           verifier.VerifyVectorOfTables(functions()) &&
+           VerifyOffset(verifier, VT_STACKFRAMES) &&
+           verifier.Verify(stackframes()) &&
+           verifier.VerifyVectorOfTables(stackframes()) &&
+           VerifyOffset(verifier, VT_STACKFRAME_MEMBERS) &&
+           verifier.Verify(stackframe_members()) &&
+           verifier.VerifyVectorOfTables(stackframe_members()) &&
+           VerifyOffset(verifier, VT_REFERENCE_INFOS) &&
+           verifier.Verify(reference_infos()) &&
+           verifier.VerifyVectorOfTables(reference_infos()) &&
+           VerifyOffset(verifier, VT_CODES) &&
+           verifier.Verify(codes()) &&
+           verifier.VerifyVectorOfTables(codes()) &&
+           VerifyOffset(verifier, VT_DATAS) &&
+           verifier.Verify(datas()) &&
+           verifier.VerifyVectorOfTables(datas()) &&
+           VerifyOffset(verifier, VT_BASIC_BLOCKS) &&
+           verifier.Verify(basic_blocks()) &&
+           verifier.VerifyVectorOfTables(basic_blocks()) &&
+           VerifyOffset(verifier, VT_LOCAL_TYPES) &&
+           verifier.Verify(local_types()) &&
+           verifier.VerifyVectorOfTables(local_types()) &&
+           VerifyOffset(verifier, VT_STRINGS) &&
+           verifier.Verify(strings()) &&
+           verifier.VerifyVectorOfStrings(strings()) &&
+           VerifyOffset(verifier, VT_FUNCTION_SUMMARIES) &&
+           verifier.Verify(function_summaries()) &&
+           verifier.EndTable();
+  }
+};
+
+struct RootBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_binaries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> binaries) {
+    fbb_.AddOffset(Root::VT_BINARIES, binaries);
+  }
+  void add_structs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> structs) {
+    fbb_.AddOffset(Root::VT_STRUCTS, structs);
+  }
+  void add_struct_members(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> struct_members) {
+    fbb_.AddOffset(Root::VT_STRUCT_MEMBERS, struct_members);
+  }
+  void add_enums(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> enums) {
+    fbb_.AddOffset(Root::VT_ENUMS, enums);
+  }
+  void add_enum_members(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> enum_members) {
+    fbb_.AddOffset(Root::VT_ENUM_MEMBERS, enum_members);
+  }
+  void add_segments(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> segments) {
+    fbb_.AddOffset(Root::VT_SEGMENTS, segments);
+  }
+  void add_segment_chunks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> segment_chunks) {
+    fbb_.AddOffset(Root::VT_SEGMENT_CHUNKS, segment_chunks);
+  }
+  void add_functions(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> functions) {
+    fbb_.AddOffset(Root::VT_FUNCTIONS, functions);
+  }
+  void add_stackframes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> stackframes) {
+    fbb_.AddOffset(Root::VT_STACKFRAMES, stackframes);
+  }
+  void add_stackframe_members(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> stackframe_members) {
+    fbb_.AddOffset(Root::VT_STACKFRAME_MEMBERS, stackframe_members);
+  }
+  void add_reference_infos(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> reference_infos) {
+    fbb_.AddOffset(Root::VT_REFERENCE_INFOS, reference_infos);
+  }
+  void add_codes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> codes) {
+    fbb_.AddOffset(Root::VT_CODES, codes);
+  }
+  void add_datas(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> datas) {
+    fbb_.AddOffset(Root::VT_DATAS, datas);
+  }
+  void add_basic_blocks(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> basic_blocks) {
+    fbb_.AddOffset(Root::VT_BASIC_BLOCKS, basic_blocks);
+  }
+  void add_local_types(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> local_types) {
+    fbb_.AddOffset(Root::VT_LOCAL_TYPES, local_types);
+  }
+  void add_strings(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> strings) {
+    fbb_.AddOffset(Root::VT_STRINGS, strings);
+  }
+  void add_function_summaries(flatbuffers::Offset<flatbuffers::Vector<const FunctionSummary *>> function_summaries) {
+    fbb_.AddOffset(Root::VT_FUNCTION_SUMMARIES, function_summaries);
+  }
+  explicit RootBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  RootBuilder &operator=(const RootBuilder &);
+  flatbuffers::Offset<Root> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Root>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Root> CreateRoot(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> binaries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> structs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> struct_members = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> enums = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> enum_members = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> segments = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> segment_chunks = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> functions = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> stackframes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> stackframe_members = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> reference_infos = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> codes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> datas = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> basic_blocks = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Version>>> local_types = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> strings = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const FunctionSummary *>> function_summaries = 0) {
+  RootBuilder builder_(_fbb);
+  builder_.add_function_summaries(function_summaries);
+  builder_.add_strings(strings);
+  builder_.add_local_types(local_types);
+  builder_.add_basic_blocks(basic_blocks);
+  builder_.add_datas(datas);
+  builder_.add_codes(codes);
+  builder_.add_reference_infos(reference_infos);
+  builder_.add_stackframe_members(stackframe_members);
+  builder_.add_stackframes(stackframes);
+  builder_.add_functions(functions);
+  builder_.add_segment_chunks(segment_chunks);
+  builder_.add_segments(segments);
+  builder_.add_enum_members(enum_members);
+  builder_.add_enums(enums);
+  builder_.add_struct_members(struct_members);
+  builder_.add_structs(structs);
+  builder_.add_binaries(binaries);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Root> CreateRootDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<Version>> *binaries = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *structs = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *struct_members = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *enums = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *enum_members = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *segments = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *segment_chunks = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *functions = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *stackframes = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *stackframe_members = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *reference_infos = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *codes = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *datas = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *basic_blocks = nullptr,
+    const std::vector<flatbuffers::Offset<Version>> *local_types = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *strings = nullptr,
+    const std::vector<const FunctionSummary *> *function_summaries = nullptr) {
+  return yadb::CreateRoot(
+      _fbb,
+      binaries ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*binaries) : 0,
+      structs ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*structs) : 0,
+      struct_members ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*struct_members) : 0,
+      enums ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*enums) : 0,
+      enum_members ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*enum_members) : 0,
+      segments ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*segments) : 0,
+      segment_chunks ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*segment_chunks) : 0,
+      functions ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*functions) : 0,
+      stackframes ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*stackframes) : 0,
+      stackframe_members ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*stackframe_members) : 0,
+      reference_infos ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*reference_infos) : 0,
+      codes ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*codes) : 0,
+      datas ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*datas) : 0,
+      basic_blocks ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*basic_blocks) : 0,
+      local_types ? _fbb.CreateVector<flatbuffers::Offset<Version>>(*local_types) : 0,
+      strings ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*strings) : 0,
+      function_summaries ? _fbb.CreateVector<const FunctionSummary *>(*function_summaries) : 0);
+}
+
+inline const yadb::Root *GetRoot(const void *buf) {
+  return flatbuffers::GetRoot<yadb::Root>(buf);
+}
+
+inline const char *RootIdentifier() {
+  return "YADB";
+}
+
+inline bool RootBufferHasIdentifier(const void *buf) {
+  return flatbuffers::BufferHasIdentifier(
+      buf, RootIdentifier());
+}
+
+inline bool VerifyRootBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<yadb::Root>(RootIdentifier());
+}
+
+inline const char *RootExtension() {
+  return "yadb";
+}
+
+inline void FinishRootBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<yadb::Root> root) {
+  fbb.Finish(root, RootIdentifier());
+}
+
+}  // namespace yadb
+
+#endif  // FLATBUFFERS_GENERATED_YADB_YADB_H_
@@ -0,0 +1,12 @@
+
+        execute_process(COMMAND
+            /usr/bin/git describe --dirty --tags --long
+            WORKING_DIRECTORY "/root/repo"
+            OUTPUT_VARIABLE GIT_VERSION
+            RESULT_VARIABLE retcode
+            OUTPUT_STRIP_TRAILING_WHITESPACE)
+        if(NOT "${retcode}" STREQUAL "0")
+            set(GIT_VERSION "v0.0-0-g0")
+        endif()
+        configure_file("${SRC}" "${DST}" @ONLY)
+    
\ No newline at end of file
@@ -0,0 +1,4 @@
+
+        static const char GitVersion[] = "v0.0-0-g0";
+        #define GIT_VERSION() "v0.0-0-g0"
+    